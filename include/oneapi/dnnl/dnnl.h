@@ -240,6 +240,72 @@ dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_primitive_destroy(dnnl_primitive_t primitive);
 
+/// Starts creating a primitive asynchronously.
+///
+/// The primitive is created on a library-managed pool of background threads
+/// and the function returns immediately. The creations that have not started
+/// by the program exit are cancelled.
+///
+/// @param primitive_future Output primitive future.
+/// @param primitive_desc Primitive descriptor used to create the primitive.
+///     The primitive future keeps a copy of it, so it can be destroyed right
+///     away. The engine of the primitive descriptor must not be destroyed
+///     until the creation is completed.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_create_async(
+        dnnl_primitive_future_t *primitive_future,
+        const_dnnl_primitive_desc_t primitive_desc);
+
+/// Checks whether an asynchronous primitive creation is completed.
+///
+/// @param primitive_future Primitive future.
+/// @param is_ready Output value, which is set to 1 if the creation is
+///     completed and to 0 otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_is_ready(
+        const_dnnl_primitive_future_t primitive_future, int *is_ready);
+
+/// Waits for an asynchronous primitive creation to complete and returns the
+/// created primitive.
+///
+/// @param primitive_future Primitive future.
+/// @param primitive Output primitive. The primitive can be obtained from a
+///     primitive future only once.
+/// @returns #dnnl_success on success and the status of the primitive
+///     creation, #dnnl_runtime_error if the creation was cancelled, or a
+///     status describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_get(
+        dnnl_primitive_future_t primitive_future, dnnl_primitive_t *primitive);
+
+/// Destroys a primitive future.
+///
+/// @note The function waits for the primitive creation to complete. The
+///     primitive is destroyed if it has not been obtained from the future.
+///
+/// @param primitive_future The primitive future to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_future_destroy(
+        dnnl_primitive_future_t primitive_future);
+
+/// Creates primitives for multiple primitive descriptors in parallel.
+///
+/// The primitives are created on the library-managed pool of background
+/// threads, which allows to warm up the primitive cache at an application
+/// start-up.
+///
+/// @param primitives Output array of @p n primitives. On failure, no
+///     primitives are returned.
+/// @param n Number of primitives to create.
+/// @param primitive_descs Array of @p n primitive descriptors used to create
+///     the primitives.
+/// @returns #dnnl_success on success and the status of the first failed
+///     primitive creation or a status describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_create_batch(dnnl_primitive_t *primitives,
+        int n, const const_dnnl_primitive_desc_t *primitive_descs);
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -362,6 +428,101 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_accumulation_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_accumulation_mode(
         dnnl_primitive_attr_t attr, dnnl_accumulation_mode_t mode);
 
+/// Returns the gating primitive attribute parameters.
+///
+/// @param attr Primitive attributes.
+/// @param alg_kind Output gate activation algorithm kind. The value is
+///     #dnnl_alg_kind_undef if the gating is not set.
+/// @param alpha Output alpha parameter of the gate activation.
+/// @param beta Output beta parameter of the gate activation.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_gating(
+        const_dnnl_primitive_attr_t attr, dnnl_alg_kind_t *alg_kind,
+        float *alpha, float *beta);
+
+/// Sets the gating primitive attribute. The attribute is supported by the
+/// matmul primitive only.
+///
+/// With the gating set, the weights tensor holds the gate and the up
+/// projections concatenated along the N dimension, so its N dimension is
+/// twice as large as the one of the destination tensor, and the primitive
+/// computes `dst = act(src * weights_gate) * (src * weights_up)`, where `act`
+/// is the eltwise operation defined by @p alg_kind, @p alpha and @p beta,
+/// e.g. #dnnl_eltwise_swish with alpha equal to 1 for SwiGLU or
+/// #dnnl_eltwise_gelu_tanh for GeGLU.
+///
+/// @param attr Primitive attributes.
+/// @param alg_kind Gate activation algorithm kind. Must be one of the
+///     forward eltwise algorithms, or #dnnl_alg_kind_undef to reset the
+///     gating.
+/// @param alpha Alpha parameter of the gate activation.
+/// @param beta Beta parameter of the gate activation.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_gating(
+        dnnl_primitive_attr_t attr, dnnl_alg_kind_t alg_kind, float alpha,
+        float beta);
+
+/// Returns the data type the source tensor is dynamically quantized to.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Output data type. The value is #dnnl_data_type_undef if
+///     the dynamic quantization is not set.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_src_dynamic_quantization(
+        const_dnnl_primitive_attr_t attr, dnnl_data_type_t *data_type);
+
+/// Sets the dynamic quantization of the source tensor. The attribute is
+/// supported by the matmul primitive with floating point source and
+/// destination and int8 weights only.
+///
+/// With the dynamic quantization set, each row of the source tensor (a
+/// token) is quantized at the execution time with a scale equal to the
+/// maximum absolute value of the row divided by the maximum value of
+/// @p data_type, and the product is computed in integer arithmetic. The
+/// result is then multiplied by the row scale and by the weights scales, if
+/// any.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Quantized source data type. Must be #dnnl_s8, or
+///     #dnnl_data_type_undef to reset the dynamic quantization.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_dynamic_quantization(
+        dnnl_primitive_attr_t attr, dnnl_data_type_t data_type);
+
+/// Returns the data type the destination tensor is dynamically quantized to.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Output data type. The value is #dnnl_data_type_undef if
+///     the dynamic quantization is not set.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dst_dynamic_quantization(
+        const_dnnl_primitive_attr_t attr, dnnl_data_type_t *data_type);
+
+/// Sets the dynamic quantization of the destination tensor. The attribute is
+/// supported by the reorder primitive with floating point source and int8
+/// destination only.
+///
+/// With the dynamic quantization set, the destination scales are computed
+/// at the execution time: each scale is equal to the maximum absolute value
+/// of the source slice it applies to divided by the maximum value of
+/// @p data_type. The scales are written to the memory passed as the
+/// #DNNL_ARG_ATTR_SCALES | #DNNL_ARG_DST execution argument, which is an
+/// output of the primitive in this case. The destination scales mask must be
+/// set.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Quantized destination data type. Must be #dnnl_s8, or
+///     #dnnl_data_type_undef to reset the dynamic quantization.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dst_dynamic_quantization(
+        dnnl_primitive_attr_t attr, dnnl_data_type_t data_type);
+
 /// Returns the primitive attributes scratchpad mode.
 ///
 /// @param attr Primitive attributes.
@@ -690,7 +851,8 @@ dnnl_status_t DNNL_API dnnl_post_ops_get_params_dw(
 /// broadcast semantics for a second operand.
 ///
 /// @param post_ops Post-ops.
-/// @param alg_kind Binary algorithm for the post-op.
+/// @param alg_kind Binary algorithm for the post-op. The
+///     #dnnl_binary_select algorithm is not supported.
 /// @param src1_desc Memory descriptor of a second operand.
 /// @returns #dnnl_success on success and a status describing the error
 ///     otherwise.
@@ -1190,6 +1352,32 @@ dnnl_status_t DNNL_API dnnl_memory_create_v2(dnnl_memory_t *memory,
         int nhandles, void **handles);
 #endif
 
+/// Creates a memory object over a file mapped into the address space of the
+/// process, e.g. a file with pre-trained weights.
+///
+/// The file is mapped privately: its pages are read on the first access and
+/// stay shared through the page cache with the other processes mapping the
+/// same file until they are written to, so the changes of the memory object
+/// are not written back to the file. The library owns the mapping, which is
+/// released when the memory object is destroyed.
+///
+/// The function is supported for CPU engines on POSIX systems only.
+///
+/// @param memory Output memory object.
+/// @param memory_desc Memory descriptor, which must not be sparse.
+/// @param engine Engine to use.
+/// @param path Path to the file.
+/// @param offset Offset of the memory object data in the file, in bytes. It
+///     must be a multiple of 64, so that the data is aligned as the data of
+///     the memory objects allocated by the library, but it does not need to
+///     be page aligned, which allows to skip a header of the file or to map a
+///     single tensor of a file with multiple ones.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_create_from_file(dnnl_memory_t *memory,
+        const_dnnl_memory_desc_t memory_desc, dnnl_engine_t engine,
+        const char *path, size_t offset);
+
 /// Returns the memory descriptor for a memory object.
 ///
 /// @param memory Memory object.
@@ -1465,6 +1653,42 @@ dnnl_status_t DNNL_API dnnl_binary_primitive_desc_create(
         const_dnnl_memory_desc_t src1_desc, const_dnnl_memory_desc_t dst_desc,
         const_dnnl_primitive_attr_t attr);
 
+/// Creates a primitive descriptor for a binary primitive with support of
+/// ternary operators.
+///
+/// @note
+///     Memory descriptors @p src1_desc and @p dst_desc are alloweded to be
+///     initialized with #dnnl_format_tag_any or with format_kind set to
+///     #dnnl_format_kind_any.
+///
+/// @note
+///     All memory descriptors must have the same number of dimensions.
+///     Element broadcasting is supported for memory descriptors @p src1_desc
+///     and @p src2_desc and are applied to their dimensions that have size
+///     equal to 1.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Algorithm kind. Valid values are #dnnl_binary_add,
+///     #dnnl_binary_mul, #dnnl_binary_max, #dnnl_binary_min, #dnnl_binary_div,
+///     #dnnl_binary_sub, #dnnl_binary_ge, #dnnl_binary_gt, #dnnl_binary_le,
+///     #dnnl_binary_lt, #dnnl_binary_eq, #dnnl_binary_ne and
+///     #dnnl_binary_select.
+/// @param src0_desc Source 0 memory descriptor.
+/// @param src1_desc Source 1 memory descriptor.
+/// @param src2_desc Source memory descriptor for the condition of the
+///     #dnnl_binary_select algorithm. Must be NULL or a zero memory
+///     descriptor for the other algorithms.
+/// @param dst_desc Destination memory descriptor.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_binary_primitive_desc_create_v2(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src0_desc,
+        const_dnnl_memory_desc_t src1_desc, const_dnnl_memory_desc_t src2_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
 /// @} dnnl_api_binary
 
 /// @addtogroup dnnl_api_convolution
@@ -3486,6 +3710,110 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+/// @{
+
+/// Creates a primitive descriptor for an embedding bag primitive.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Pooling algorithm applied to the rows of a bag. Possible
+///     values: #dnnl_reduction_sum, #dnnl_reduction_mean, #dnnl_reduction_max.
+/// @param src_desc Embedding table memory descriptor.
+/// @param indices_desc Indices memory descriptor.
+/// @param offsets_desc Offsets memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_embedding_bag_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_embedding_bag
+
+/// @addtogroup dnnl_api_rope RoPE
+/// @{
+
+/// Creates a primitive descriptor for a rotary position embedding (RoPE)
+/// primitive.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @note
+///     Both @p cos_desc and @p sin_desc can be NULL or zero memory
+///     descriptors. In this case, the cosine and sine values are computed by
+///     the primitive from @p base with the position of a row being its index
+///     in the second to last dimension of the source.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind RoPE algorithm kind. Possible values:
+///     #dnnl_rope_interleaved, #dnnl_rope_half_split.
+/// @param src_desc Source memory descriptor.
+/// @param cos_desc Cosine table memory descriptor (can be NULL).
+/// @param sin_desc Sine table memory descriptor (can be NULL).
+/// @param dst_desc Destination memory descriptor.
+/// @param base The base of the rotation frequencies. Used only when the
+///     cosine and sine tables are not passed.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_rope_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t cos_desc, const_dnnl_memory_desc_t sin_desc,
+        const_dnnl_memory_desc_t dst_desc, float base,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_rope
+
+/// @addtogroup dnnl_api_top_k Top-k
+/// @{
+
+/// Creates a primitive descriptor for a top-k primitive.
+///
+/// @note
+///     Destination and indices memory descriptors are allowed to be
+///     initialized with #dnnl_format_tag_any or with format_kind set to
+///     #dnnl_format_kind_any.
+///
+/// @note
+///     The number of selected elements `k` is the size of @p axis of the
+///     destination. The other dimensions of the source and destination must
+///     match.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Top-k algorithm kind. Possible values:
+///     #dnnl_reduction_max selects the largest elements,
+///     #dnnl_reduction_min selects the smallest ones.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination (values) memory descriptor.
+/// @param indices_desc Destination (indices) memory descriptor. Must have the
+///     same dimensions as @p dst_desc and the #dnnl_s32 data type.
+/// @param axis The axis along which the elements are selected.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_top_k_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t indices_desc, int axis,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_top_k
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -3514,6 +3842,27 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Creates primitives for multiple primitive descriptors in parallel and
+/// puts them into the primitive cache.
+///
+/// Creating the primitives of a model ahead of time, for example from the
+/// primitive descriptors recorded at a previous run, removes the primitive
+/// creation cost from the first execution of the model. The primitives are
+/// created on the same library-managed pool of background threads as by
+/// #dnnl_primitive_create_batch(), but no primitive objects are returned, so
+/// no resources such as scratchpads are allocated for the primitives.
+///
+/// @note The function has no effect on the primitive cache if it is
+///     disabled, and the primitives above the cache capacity evict the ones
+///     created earlier.
+///
+/// @param n Number of primitive descriptors.
+/// @param primitive_descs Array of @p n primitive descriptors.
+/// @returns #dnnl_success on success and the status of the first failed
+///     primitive creation or a status describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_cache_warm_up(
+        int n, const const_dnnl_primitive_desc_t *primitive_descs);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
@@ -85,6 +85,13 @@ struct handle_traits<dnnl_primitive_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_primitive_future_t> {
+    static dnnl_status_t destructor(dnnl_primitive_future_t p) {
+        return dnnl_primitive_future_destroy(p);
+    }
+};
+
 /// @endcond
 
 /// @} dnnl_api_utils
@@ -148,6 +155,12 @@ struct primitive : public handle<dnnl_primitive_t> {
         layer_normalization = dnnl_layer_normalization,
         /// A group normalization primitive
         group_normalization = dnnl_group_normalization,
+        /// An embedding bag primitive.
+        embedding_bag = dnnl_embedding_bag,
+        /// A rotary position embedding (RoPE) primitive.
+        rope = dnnl_rope,
+        /// A top-k primitive.
+        top_k = dnnl_top_k,
     };
 
     using handle::handle;
@@ -453,6 +466,8 @@ enum class algorithm {
     binary_eq = dnnl_binary_eq,
     /// Binary not equal
     binary_ne = dnnl_binary_ne,
+    /// Binary select
+    binary_select = dnnl_binary_select,
     /// Nearest Neighbor resampling method
     resampling_nearest = dnnl_resampling_nearest,
     /// Linear (Bilinear, Trilinear) resampling method
@@ -479,6 +494,11 @@ enum class algorithm {
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
     softmax_log = dnnl_softmax_log,
+    /// RoPE rotating the pairs of adjacent elements
+    rope_interleaved = dnnl_rope_interleaved,
+    /// RoPE rotating the elements of the first half with the elements of the
+    /// second half
+    rope_half_split = dnnl_rope_half_split,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -530,6 +550,12 @@ enum class normalization_flags : unsigned {
     /// On training, normalization will require the workspace to implement
     /// backward propagation. On inference, the workspace is not required.
     fuse_norm_add_relu = dnnl_fuse_norm_add_relu,
+
+    /// Use Root Mean Square (RMS) normalization. If specified, the mean is
+    /// considered to be zero on both forward and backward propagation, and
+    /// the library only computes, outputs or takes the variance, which is the
+    /// mean of squares in this case. Only supported by layer normalization.
+    rms_norm = dnnl_rms_norm,
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -3337,6 +3363,31 @@ struct memory : public handle<dnnl_memory_t> {
         : memory(md, aengine, DNNL_MEMORY_ALLOCATE) {}
 #endif
 
+    /// Creates a memory object over a file mapped into the address space of
+    /// the process, e.g. a file with pre-trained weights.
+    ///
+    /// The file is mapped privately: its pages are read on the first access
+    /// and stay shared through the page cache with the other processes
+    /// mapping the same file until they are written to. The mapping is
+    /// released when the memory object is destroyed.
+    ///
+    /// The function is supported for CPU engines on POSIX systems only.
+    ///
+    /// @param md Memory descriptor, which must not be sparse.
+    /// @param aengine Engine to store the data on.
+    /// @param path Path to the file.
+    /// @param offset Offset of the memory object data in the file, in bytes.
+    ///     It must be a multiple of 64, but does not need to be page aligned.
+    /// @returns Memory object.
+    static memory create_from_file(const desc &md, const engine &aengine,
+            const std::string &path, size_t offset = 0) {
+        dnnl_memory_t result;
+        error::wrap_c_api(dnnl_memory_create_from_file(&result, md.get(),
+                                  aengine.get(), path.c_str(), offset),
+                "could not create a memory object from a file");
+        return memory(result);
+    }
+
     /// Returns the associated memory descriptor.
     desc get_desc() const {
         const_dnnl_memory_desc_t cdesc;
@@ -3775,7 +3826,8 @@ struct post_ops : public handle<dnnl_post_ops_t> {
     /// where binary_op is configured with the given parameters. binary_op
     /// supports broadcast semantics for a second operand.
     ///
-    /// @param aalgorithm Binary algorithm for the post-op.
+    /// @param aalgorithm Binary algorithm for the post-op. The
+    ///     #dnnl::algorithm::binary_select algorithm is not supported.
     /// @param src1_desc Memory descriptor of a second operand.
     void append_binary(algorithm aalgorithm, const memory::desc &src1_desc) {
         error::wrap_c_api(dnnl_post_ops_append_binary(get(),
@@ -3950,6 +4002,102 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set accumulation mode primitive attribute");
     }
 
+    /// Returns the parameters of the gating attribute.
+    ///
+    /// @param aalgorithm Output gate activation algorithm kind. The value is
+    ///     #dnnl::algorithm::undef if the gating is not set.
+    /// @param alpha Output alpha parameter of the gate activation.
+    /// @param beta Output beta parameter of the gate activation.
+    void get_gating(algorithm &aalgorithm, float &alpha, float &beta) const {
+        dnnl_alg_kind_t c_alg;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_gating(get(), &c_alg, &alpha, &beta),
+                "could not get gating primitive attribute");
+        aalgorithm = static_cast<algorithm>(c_alg);
+    }
+
+    /// Sets the gating attribute, which is supported by the matmul primitive
+    /// only.
+    ///
+    /// With the gating set, the weights tensor holds the gate and the up
+    /// projections concatenated along the N dimension, and the primitive
+    /// computes `dst = act(src * weights_gate) * (src * weights_up)`.
+    ///
+    /// @param aalgorithm Gate activation algorithm kind, e.g.
+    ///     #dnnl::algorithm::eltwise_swish with alpha equal to 1 for SwiGLU.
+    ///     #dnnl::algorithm::undef resets the gating.
+    /// @param alpha Alpha parameter of the gate activation.
+    /// @param beta Beta parameter of the gate activation.
+    void set_gating(algorithm aalgorithm, float alpha = 0.f, float beta = 0.f) {
+        error::wrap_c_api(dnnl_primitive_attr_set_gating(get(),
+                                  convert_to_c(aalgorithm), alpha, beta),
+                "could not set gating primitive attribute");
+    }
+
+    /// Returns the data type the source tensor is dynamically quantized to.
+    ///
+    /// @returns Quantized source data type, or memory::data_type::undef if
+    ///     the dynamic quantization is not set.
+    memory::data_type get_src_dynamic_quantization() const {
+        dnnl_data_type_t c_dt;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_src_dynamic_quantization(get(), &c_dt),
+                "could not get source dynamic quantization primitive "
+                "attribute");
+        return static_cast<memory::data_type>(c_dt);
+    }
+
+    /// Sets the dynamic quantization of the source tensor, which is
+    /// supported by the matmul primitive with floating point source and
+    /// destination and int8 weights only.
+    ///
+    /// Each row of the source tensor is quantized at the execution time with
+    /// a scale computed from the maximum absolute value of the row, and the
+    /// product is computed in integer arithmetic.
+    ///
+    /// @param data_type Quantized source data type. Must be
+    ///     memory::data_type::s8, or memory::data_type::undef to reset the
+    ///     dynamic quantization.
+    void set_src_dynamic_quantization(memory::data_type data_type) {
+        error::wrap_c_api(dnnl_primitive_attr_set_src_dynamic_quantization(
+                                  get(), memory::convert_to_c(data_type)),
+                "could not set source dynamic quantization primitive "
+                "attribute");
+    }
+
+    /// Returns the data type the destination tensor is dynamically quantized
+    /// to.
+    ///
+    /// @returns Quantized destination data type, or memory::data_type::undef
+    ///     if the dynamic quantization is not set.
+    memory::data_type get_dst_dynamic_quantization() const {
+        dnnl_data_type_t c_dt;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_dst_dynamic_quantization(get(), &c_dt),
+                "could not get destination dynamic quantization primitive "
+                "attribute");
+        return static_cast<memory::data_type>(c_dt);
+    }
+
+    /// Sets the dynamic quantization of the destination tensor, which is
+    /// supported by the reorder primitive with floating point source and
+    /// int8 destination only.
+    ///
+    /// The destination scales are computed at the execution time from the
+    /// maximum absolute values of the source slices they apply to, and are
+    /// written to the DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST memory argument.
+    /// The destination scales mask must be set.
+    ///
+    /// @param data_type Quantized destination data type. Must be
+    ///     memory::data_type::s8, or memory::data_type::undef to reset the
+    ///     dynamic quantization.
+    void set_dst_dynamic_quantization(memory::data_type data_type) {
+        error::wrap_c_api(dnnl_primitive_attr_set_dst_dynamic_quantization(
+                                  get(), memory::convert_to_c(data_type)),
+                "could not set destination dynamic quantization primitive "
+                "attribute");
+    }
+
     /// Returns the deterministic attribute value
     bool get_deterministic() const {
         int result;
@@ -5300,6 +5448,81 @@ struct primitive_desc : public primitive_desc_base {
     }
 };
 
+/// A primitive that is being created asynchronously on a library-managed
+/// pool of background threads.
+struct primitive_future : public handle<dnnl_primitive_future_t> {
+    using handle::handle;
+
+    /// Default constructor. Constructs an empty object.
+    primitive_future() = default;
+
+    /// Starts creating a primitive from a primitive descriptor.
+    ///
+    /// @param pd Primitive descriptor. The primitive future keeps a copy of
+    ///     it until the creation is completed.
+    primitive_future(const primitive_desc &pd) {
+        dnnl_primitive_future_t result;
+        error::wrap_c_api(dnnl_primitive_create_async(&result, pd.get()),
+                "could not start an asynchronous primitive creation");
+        reset(result);
+    }
+
+    /// Copy constructor.
+    primitive_future(const primitive_future &) = default;
+    /// Move constructor.
+    primitive_future(primitive_future &&) = default;
+    /// Assignment operator.
+    primitive_future &operator=(const primitive_future &) = default;
+    /// Move assignment operator.
+    primitive_future &operator=(primitive_future &&) = default;
+
+    /// Returns whether the primitive creation is completed.
+    ///
+    /// @returns @c true if the primitive creation is completed and @c false
+    ///     otherwise.
+    bool is_ready() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_future_is_ready(get(), &result),
+                "could not query a primitive future");
+        return result != 0;
+    }
+
+    /// Waits for the primitive creation to complete and returns the created
+    /// primitive. The primitive can be obtained only once.
+    ///
+    /// @returns The created primitive.
+    primitive get_primitive() {
+        dnnl_primitive_t result;
+        error::wrap_c_api(dnnl_primitive_future_get(get(), &result),
+                "could not create a primitive");
+        return primitive(result);
+    }
+};
+
+/// Creates primitives for multiple primitive descriptors in parallel on a
+/// library-managed pool of background threads.
+///
+/// @param pds Primitive descriptors.
+/// @returns Created primitives in the order of the primitive descriptors.
+inline std::vector<primitive> create_primitives(
+        const std::vector<primitive_desc> &pds) {
+    std::vector<const_dnnl_primitive_desc_t> c_pds;
+    c_pds.reserve(pds.size());
+    for (const auto &pd : pds)
+        c_pds.push_back(pd.get());
+
+    std::vector<dnnl_primitive_t> c_primitives(pds.size());
+    error::wrap_c_api(dnnl_primitive_create_batch(c_primitives.data(),
+                              (int)c_pds.size(), c_pds.data()),
+            "could not create primitives");
+
+    std::vector<primitive> primitives;
+    primitives.reserve(c_primitives.size());
+    for (auto c_primitive : c_primitives)
+        primitives.emplace_back(c_primitive);
+    return primitives;
+}
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_convolution Convolution
@@ -12500,6 +12723,40 @@ struct binary : public primitive {
             reset(pd);
         }
 
+        /// Constructs a primitive descriptor for an elementwise binary operator
+        /// primitive with support of ternary operators.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Elementwise binary algorithm.
+        /// @param src0 Memory descriptor for source tensor #0.
+        /// @param src1 Memory descriptor for source tensor #1.
+        /// @param src2 Memory descriptor for source tensor #2 used as the
+        ///     condition of the #dnnl::algorithm::binary_select algorithm.
+        /// @param dst Memory descriptor for destination tensor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src0, const memory::desc &src1,
+                const memory::desc &src2, const memory::desc &dst,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_binary_primitive_desc_create_v2(&pd,
+                    aengine.get(), dnnl::convert_to_c(aalgorithm), src0.get(),
+                    src1.get(), src2.get(), dst.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a binary "
+                        "operation primitive with ternary operator");
+            reset(pd);
+        }
+
         /// Constructs a primitive descriptor for a binary primitive from a C
         /// API primitive descriptor that must have a matching kind.
         ///
@@ -12516,6 +12773,9 @@ struct binary : public primitive {
         /// Returns the memory descriptor for source #1.
         memory::desc src1_desc() const { return base::src_desc(1); }
 
+        /// Returns the memory descriptor for source #2.
+        memory::desc src2_desc() const { return base::src_desc(2); }
+
         /// @copydoc dnnl::primitive_desc_base::dst_desc()const
         memory::desc dst_desc() const { return base::dst_desc(0); }
 
@@ -13488,6 +13748,334 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+///
+/// A primitive to look up the rows of an embedding table and to pool them
+/// into bags using sum, mean or max operations.
+///
+/// @sa @ref dev_guide_embedding_bag in developer guide
+///
+/// @{
+
+/// Embedding bag.
+struct embedding_bag : public primitive {
+    /// Primitive descriptor for an embedding bag primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an embedding bag primitive.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Pooling algorithm applied to the rows of a bag.
+        ///     Possible values: #dnnl_reduction_sum, #dnnl_reduction_mean,
+        ///     #dnnl_reduction_max.
+        /// @param src_desc Embedding table memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Offsets memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc,
+                const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_embedding_bag_primitive_desc_create(
+                    &pd, aengine.get(), convert_to_c(aalgorithm),
+                    src_desc.get(), indices_desc.get(), offsets_desc.get(),
+                    dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for an "
+                        "embedding bag primitive");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for an embedding bag primitive
+        /// from a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an embedding bag
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::embedding_bag) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns a memory descriptor for indices.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::src_desc(1); }
+
+        /// Returns a memory descriptor for offsets.
+        /// @returns Offsets memory descriptor.
+        memory::desc offsets_desc() const { return base::src_desc(2); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    embedding_bag() = default;
+
+    /// Constructs an embedding bag primitive.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    embedding_bag(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs an embedding bag primitive from a cache blob.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    /// @param cache_blob Cache blob.
+    embedding_bag(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_embedding_bag
+
+/// @addtogroup dnnl_api_rope RoPE
+///
+/// A primitive to apply rotary position embedding (RoPE) to the query and key
+/// tensors of attention layers.
+///
+/// @sa @ref dev_guide_rope in developer guide
+///
+/// @{
+
+/// Rotary position embedding (RoPE).
+struct rope : public primitive {
+    /// Primitive descriptor for a RoPE primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a RoPE primitive with the
+        /// cosine and sine tables passed at execution.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm RoPE algorithm kind. Possible values:
+        ///     #dnnl_rope_interleaved, #dnnl_rope_half_split.
+        /// @param src_desc Source memory descriptor.
+        /// @param cos_desc Cosine table memory descriptor.
+        /// @param sin_desc Sine table memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &cos_desc,
+                const memory::desc &sin_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, &cos_desc,
+                    &sin_desc, dst_desc, 0.f, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a RoPE primitive which
+        /// computes the cosine and sine values from the base of the rotation
+        /// frequencies.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm RoPE algorithm kind. Possible values:
+        ///     #dnnl_rope_interleaved, #dnnl_rope_half_split.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param base The base of the rotation frequencies.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc,
+                float base, const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, nullptr, nullptr,
+                    dst_desc, base, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a RoPE primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a RoPE primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::rope) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns a memory descriptor for the cosine table.
+        /// @returns Cosine table memory descriptor. A zero memory descriptor
+        ///     is returned if the values are computed by the primitive.
+        memory::desc cos_desc() const { return base::src_desc(1); }
+
+        /// Returns a memory descriptor for the sine table.
+        /// @returns Sine table memory descriptor. A zero memory descriptor
+        ///     is returned if the values are computed by the primitive.
+        memory::desc sin_desc() const { return base::src_desc(2); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+    private:
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc *cos_desc,
+                const memory::desc *sin_desc, const memory::desc &dst_desc,
+                float base, const primitive_attr &attr, bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_rope_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    optional_arg(cos_desc), optional_arg(sin_desc),
+                    dst_desc.get(), base, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a rope "
+                        "primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    rope() = default;
+
+    /// Constructs a RoPE primitive.
+    /// @param pd Primitive descriptor for a RoPE primitive.
+    rope(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a RoPE primitive from a cache blob.
+    /// @param pd Primitive descriptor for a RoPE primitive.
+    /// @param cache_blob Cache blob.
+    rope(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_rope
+
+/// @addtogroup dnnl_api_top_k Top-k
+///
+/// A primitive to select the largest or the smallest elements of a tensor
+/// along an axis together with their indices.
+///
+/// @sa @ref dev_guide_top_k in developer guide
+///
+/// @{
+
+/// Top-k.
+struct top_k : public primitive {
+    /// Primitive descriptor for a top-k primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a top-k primitive.
+        ///
+        /// @note
+        ///     Destination and indices memory descriptors may be initialized
+        ///     with #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Top-k algorithm kind. Possible values:
+        ///     #dnnl_reduction_max, #dnnl_reduction_min.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination (values) memory descriptor. The size
+        ///     of @p axis is the number of selected elements.
+        /// @param indices_desc Destination (indices) memory descriptor.
+        /// @param axis The axis along which the elements are selected.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc,
+                const memory::desc &indices_desc, int axis,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_top_k_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    dst_desc.get(), indices_desc.get(), axis, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a top-k "
+                        "primitive");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a top-k primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a top-k primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::top_k) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns a memory descriptor for the indices of the selected
+        /// elements.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::dst_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_axis()const
+        int get_axis() const { return base::get_axis(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    top_k() = default;
+
+    /// Constructs a top-k primitive.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    top_k(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a top-k primitive from a cache blob.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    /// @param cache_blob Cache blob.
+    top_k(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_top_k
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -13704,6 +14292,22 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// Creates primitives for multiple primitive descriptors in parallel and
+/// puts them into the primitive cache.
+///
+/// @sa dnnl_primitive_cache_warm_up
+///
+/// @param pds Primitive descriptors.
+inline void warm_up_primitive_cache(const std::vector<primitive_desc> &pds) {
+    std::vector<const_dnnl_primitive_desc_t> c_pds;
+    c_pds.reserve(pds.size());
+    for (const auto &pd : pds)
+        c_pds.push_back(pd.get());
+    error::wrap_c_api(
+            dnnl_primitive_cache_warm_up((int)c_pds.size(), c_pds.data()),
+            "could not warm up primitive cache");
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
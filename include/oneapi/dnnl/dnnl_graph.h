@@ -500,6 +500,41 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_execute(
         const_dnnl_graph_tensor_t *inputs, size_t num_outputs,
         const_dnnl_graph_tensor_t *outputs);
 
+/// Queries the size of the scratchpad buffer which can be given to
+/// #dnnl_graph_compiled_partition_execute_with_scratchpad().
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param size The output size in bytes. 0 means the compiled partition
+///     doesn't need a scratchpad buffer or doesn't support user provided
+///     scratchpad.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_query_scratchpad_size(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        size_t *size);
+
+/// Executes a compiled partition with a scratchpad buffer provided by users.
+/// The buffer is used for the temporary memory of the compiled partition
+/// instead of allocating it on each execution. Only CPU engines with native
+/// runtimes are supported.
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param stream The stream used for execution.
+/// @param num_inputs The number of input tensors.
+/// @param inputs A list of input tensors.
+/// @param num_outputs The number of output tensors.
+/// @param outputs A non-empty list of output tensors.
+/// @param scratchpad The scratchpad buffer of at least the size queried by
+///     #dnnl_graph_compiled_partition_query_scratchpad_size(). It must not be
+///     used by other executions at the same time.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_execute_with_scratchpad(
+        const_dnnl_graph_compiled_partition_t compiled_partition,
+        dnnl_stream_t stream, size_t num_inputs,
+        const_dnnl_graph_tensor_t *inputs, size_t num_outputs,
+        const_dnnl_graph_tensor_t *outputs, void *scratchpad);
+
 /// Destroys a compiled partition.
 ///
 /// @param compiled_partition The compiled partition to be destroyed.
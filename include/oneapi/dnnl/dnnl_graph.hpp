@@ -713,6 +713,49 @@ public:
                         c_outputs.data()),
                 "could not execute the compiled_partition");
     }
+
+    /// Returns the size of the scratchpad buffer which can be given to
+    /// execute() with a user provided scratchpad.
+    ///
+    /// @returns The size in bytes. 0 means the compiled partition doesn't need
+    ///     a scratchpad buffer or doesn't support user provided scratchpad.
+    size_t get_scratchpad_size() const {
+        size_t size = 0;
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_query_scratchpad_size(
+                        get(), &size),
+                "could not query the scratchpad size of a compiled partition");
+        return size;
+    }
+
+    /// Execute a compiled partition with a scratchpad buffer provided by
+    /// users. The library uses the buffer for the temporary memory of the
+    /// compiled partition instead of allocating it on each execution.
+    ///
+    /// @param astream Stream object to run over.
+    /// @param inputs A list of input tensors.
+    /// @param outputs A list of output tensors.
+    /// @param scratchpad Scratchpad buffer of at least #get_scratchpad_size()
+    ///     bytes. It must not be used by other executions at the same time.
+    void execute(stream &astream, const std::vector<tensor> &inputs,
+            const std::vector<tensor> &outputs, void *scratchpad) const {
+        std::vector<const_dnnl_graph_tensor_t> c_inputs;
+        c_inputs.reserve(inputs.size());
+        for (auto &in : inputs) {
+            c_inputs.push_back(in.get());
+        }
+        std::vector<const_dnnl_graph_tensor_t> c_outputs;
+        c_outputs.reserve(outputs.size());
+        for (auto &out : outputs) {
+            c_outputs.push_back(out.get());
+        }
+
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_execute_with_scratchpad(get(),
+                        astream.get(), c_inputs.size(), c_inputs.data(),
+                        c_outputs.size(), c_outputs.data(), scratchpad),
+                "could not execute the compiled_partition with scratchpad");
+    }
 };
 
 /// @} dnnl_graph_api_compiled_partition
@@ -762,6 +805,7 @@ public:
         Exp = dnnl_graph_op_exp,
         GELU = dnnl_graph_op_gelu,
         GELUBackward = dnnl_graph_op_gelu_backward,
+        GroupNorm = dnnl_graph_op_group_norm,
         HardSigmoid = dnnl_graph_op_hard_sigmoid,
         HardSigmoidBackward = dnnl_graph_op_hard_sigmoid_backward,
         HardSwish = dnnl_graph_op_hard_swish,
@@ -797,6 +841,8 @@ public:
         ReLU = dnnl_graph_op_relu,
         ReLUBackward = dnnl_graph_op_relu_backward,
         Reorder = dnnl_graph_op_reorder,
+        RMSNorm = dnnl_graph_op_rms_norm,
+        RoPE = dnnl_graph_op_rope,
         Round = dnnl_graph_op_round,
         Select = dnnl_graph_op_select,
         Sigmoid = dnnl_graph_op_sigmoid,
@@ -814,6 +860,7 @@ public:
         Subtract = dnnl_graph_op_subtract,
         Tanh = dnnl_graph_op_tanh,
         TanhBackward = dnnl_graph_op_tanh_backward,
+        TopK = dnnl_graph_op_top_k,
         TypeCast = dnnl_graph_op_type_cast,
         Wildcard = dnnl_graph_op_wildcard,
         // Sentinel
@@ -860,6 +907,8 @@ public:
         begin_norm_axis = dnnl_graph_op_attr_begin_norm_axis,
         /// Specifies a groups attribute to an op.
         groups = dnnl_graph_op_attr_groups,
+        /// Specifies a k attribute to an op.
+        k = dnnl_graph_op_attr_k,
 
         // int64_t vector attributes. The value of these attributes can be a
         // vector of int64 numbers.
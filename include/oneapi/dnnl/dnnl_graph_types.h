@@ -252,6 +252,10 @@ typedef enum {
     dnnl_graph_op_hard_sigmoid_backward,
     dnnl_graph_op_select,
     dnnl_graph_op_pow,
+    dnnl_graph_op_rms_norm,
+    dnnl_graph_op_rope,
+    dnnl_graph_op_top_k,
+    dnnl_graph_op_group_norm,
     dnnl_graph_op_last_symbol,
 } dnnl_graph_op_kind_t;
 
@@ -291,6 +295,8 @@ typedef enum {
     dnnl_graph_op_attr_begin_norm_axis,
     /// Specifies a groups attribute to an op.
     dnnl_graph_op_attr_groups,
+    /// Specifies a k attribute to an op.
+    dnnl_graph_op_attr_k,
 
     // int64_t vector attributes. The value of these attributes can be a vector
     // of int64 numbers.
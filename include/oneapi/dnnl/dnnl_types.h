@@ -2014,6 +2014,12 @@ typedef enum {
     dnnl_layer_normalization,
     /// A group normalization primitive.
     dnnl_group_normalization,
+    /// An embedding bag primitive.
+    dnnl_embedding_bag,
+    /// A rotary position embedding (RoPE) primitive.
+    dnnl_rope,
+    /// A top-k primitive.
+    dnnl_top_k,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -2144,6 +2150,8 @@ typedef enum {
     dnnl_binary_eq = 0x1fffa,
     /// Binary not equal
     dnnl_binary_ne = 0x1fffb,
+    /// Binary select
+    dnnl_binary_select = 0x1fffc,
     /// Nearest Neighbor Resampling Method
     dnnl_resampling_nearest = 0x2fff0,
     /// Linear Resampling Method
@@ -2170,6 +2178,11 @@ typedef enum {
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
     dnnl_softmax_log,
+    /// RoPE rotating the pairs of adjacent elements
+    dnnl_rope_interleaved = 0x40000,
+    /// RoPE rotating the elements of the first half with the elements of the
+    /// second half
+    dnnl_rope_half_split,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -2241,6 +2254,19 @@ typedef enum {
     ///    tensor and then perform backward normalization.
     dnnl_fuse_norm_add_relu = 0x10U,
 
+    /// Use Root Mean Square (RMS) normalization
+    ///
+    /// If specified:
+    ///  - on forward propagation the mean is considered to be zero and the
+    ///    data is scaled with the root mean square instead of the standard
+    ///    deviation, i.e. variance is computed as the mean of squares
+    ///  - on forward propagation for training only variance is output
+    ///  - on backward propagation the mean is considered to be zero as well
+    ///
+    /// The mean argument is not used with the flag, so only variance is
+    /// required as input when it's used with #dnnl_use_global_stats. The flag
+    /// is only supported by layer normalization.
+    dnnl_rms_norm = 0x20U,
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
@@ -2433,6 +2459,15 @@ typedef struct dnnl_primitive *dnnl_primitive_t;
 /// A constant primitive handle.
 typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 
+/// @struct dnnl_primitive_future
+/// An opaque structure to describe a primitive that is being created
+/// asynchronously.
+struct dnnl_primitive_future;
+/// A primitive future handle.
+typedef struct dnnl_primitive_future *dnnl_primitive_future_t;
+/// A constant primitive future handle.
+typedef const struct dnnl_primitive_future *const_dnnl_primitive_future_t;
+
 /// Undefined argument.
 #define DNNL_ARG_UNDEF 0
 /// Source argument #0.
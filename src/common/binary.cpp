@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2023 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -87,12 +87,27 @@ status_t dnnl_binary_primitive_desc_create(
         alg_kind_t alg_kind, const memory_desc_t *src0_md,
         const memory_desc_t *src1_md, const memory_desc_t *dst_md,
         const primitive_attr_t *attr) {
+    return dnnl_binary_primitive_desc_create_v2(primitive_desc_iface, engine,
+            alg_kind, src0_md, src1_md, nullptr, dst_md, attr);
+}
+
+status_t dnnl_binary_primitive_desc_create_v2(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src0_md,
+        const memory_desc_t *src1_md, const memory_desc_t *src2_md,
+        const memory_desc_t *dst_md, const primitive_attr_t *attr) {
     VCHECK_BINARY(!any_null(src0_md, src1_md, dst_md), VERBOSE_NULL_ARG);
     VCHECK_BINARY(
             one_of(alg_kind, binary_add, binary_mul, binary_max, binary_min,
                     binary_div, binary_sub, binary_ge, binary_gt, binary_le,
-                    binary_lt, binary_eq, binary_ne),
+                    binary_lt, binary_eq, binary_ne, binary_select),
             VERBOSE_BAD_ALGORITHM);
+    const bool is_ternary = alg_kind == binary_select;
+    VCHECK_BINARY(
+            IMPLICATION(is_ternary, src2_md != nullptr), VERBOSE_NULL_ARG);
+    VCHECK_BINARY(IMPLICATION(!is_ternary && src2_md != nullptr,
+                          memory_desc_wrapper(src2_md).is_zero()),
+            VERBOSE_BAD_PARAM, "src2");
     // TODO - Add support for mutual or bi-directional broadcasts
     VCHECK_BINARY(!memory_desc_wrapper(src0_md).format_any(),
             VERBOSE_UNSUPPORTED_TAG_S, "src0");
@@ -115,6 +130,18 @@ status_t dnnl_binary_primitive_desc_create(
     bod.src_desc[1] = *src1_md;
     bod.dst_desc = *dst_md;
 
+    if (is_ternary) {
+        VCONDCHECK(primitive, create, check, binary,
+                !memory_desc_wrapper(src2_md).has_runtime_dims_or_strides(),
+                status::unimplemented, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VCHECK_BINARY(!memory_desc_wrapper(src2_md).format_any(),
+                VERBOSE_UNSUPPORTED_TAG_S, "src2");
+        // The condition is a boolean tensor stored in bytes.
+        VCHECK_BINARY(one_of(src2_md->data_type, data_type::s8, data_type::u8),
+                VERBOSE_INVALID_DATATYPE, "src2");
+        bod.src_desc[2] = *src2_md;
+    }
+
     const int ndims = dst_md->ndims;
     const dims_t &dims = dst_md->dims;
 
@@ -132,6 +159,13 @@ status_t dnnl_binary_primitive_desc_create(
                               src1_md->dims[d] == dims[d]),
                 VERBOSE_INCONSISTENT_DIM, "src1", d, "dst", d);
     }
+    if (is_ternary) {
+        VCHECK_BINARY(src2_md->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS,
+                "src2", "dst");
+        for (int d = 0; d < ndims; ++d)
+            VCHECK_BINARY(utils::one_of(src2_md->dims[d], 1, dims[d]),
+                    VERBOSE_BAD_DIM, "src2", d);
+    }
 
     CHECK(binary_attr_check(bod, engine, attr));
     return primitive_desc_create(primitive_desc_iface, engine,
@@ -23,6 +23,7 @@
 // to give names that better reflects the meaning of the entities
 using primitive_iface_t = dnnl_primitive;
 using primitive_desc_iface_t = dnnl_primitive_desc;
+using primitive_future_t = dnnl_primitive_future;
 
 namespace dnnl {
 namespace impl {
@@ -126,6 +127,7 @@ const alg_kind_t binary_le = dnnl_binary_le;
 const alg_kind_t binary_lt = dnnl_binary_lt;
 const alg_kind_t binary_eq = dnnl_binary_eq;
 const alg_kind_t binary_ne = dnnl_binary_ne;
+const alg_kind_t binary_select = dnnl_binary_select;
 const alg_kind_t resampling_nearest = dnnl_resampling_nearest;
 const alg_kind_t resampling_linear = dnnl_resampling_linear;
 const alg_kind_t reduction_max = dnnl_reduction_max;
@@ -141,6 +143,8 @@ const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
+const alg_kind_t rope_interleaved = dnnl_rope_interleaved;
+const alg_kind_t rope_half_split = dnnl_rope_half_split;
 } // namespace alg_kind
 
 using data_type_t = dnnl_data_type_t;
@@ -1875,6 +1879,7 @@ const normalization_flags_t use_scale = dnnl_use_scale;
 const normalization_flags_t use_shift = dnnl_use_shift;
 const normalization_flags_t fuse_norm_relu = dnnl_fuse_norm_relu;
 const normalization_flags_t fuse_norm_add_relu = dnnl_fuse_norm_add_relu;
+const normalization_flags_t rms_norm = dnnl_rms_norm;
 } // namespace normalization_flags
 
 using rnn_flags_t = dnnl_rnn_flags_t;
@@ -1935,6 +1940,9 @@ const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t embedding_bag = dnnl_embedding_bag;
+const primitive_kind_t rope = dnnl_rope;
+const primitive_kind_t top_k = dnnl_top_k;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
@@ -2065,6 +2073,7 @@ struct deconvolution_pd_t;
 struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
+struct embedding_bag_pd_t;
 struct gemm_pd_t;
 struct group_normalization_bwd_pd_t;
 struct group_normalization_fwd_pd_t;
@@ -2090,11 +2099,13 @@ struct resampling_pd_t;
 struct rnn_bwd_pd_t;
 struct rnn_fwd_pd_t;
 struct rnn_pd_t;
+struct rope_pd_t;
 struct shuffle_pd_t;
 struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
 struct softmax_pd_t;
 struct sum_pd_t;
+struct top_k_pd_t;
 
 } // namespace impl
 } // namespace dnnl
@@ -1745,6 +1745,9 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_softmax) return "softmax";
     if (v == dnnl_layer_normalization) return "layer_normalization";
     if (v == dnnl_group_normalization) return "group_normalization";
+    if (v == dnnl_embedding_bag) return "embedding_bag";
+    if (v == dnnl_rope) return "rope";
+    if (v == dnnl_top_k) return "top_k";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
@@ -1808,6 +1811,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_binary_lt) return "binary_lt";
     if (v == dnnl_binary_eq) return "binary_eq";
     if (v == dnnl_binary_ne) return "binary_ne";
+    if (v == dnnl_binary_select) return "binary_select";
     if (v == dnnl_resampling_nearest) return "resampling_nearest";
     if (v == dnnl_resampling_linear) return "resampling_linear";
     if (v == dnnl_reduction_max) return "reduction_max";
@@ -1821,6 +1825,8 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_reduction_norm_lp_power_p_sum) return "reduction_norm_lp_power_p_sum";
     if (v == dnnl_softmax_accurate) return "softmax_accurate";
     if (v == dnnl_softmax_log) return "softmax_log";
+    if (v == dnnl_rope_interleaved) return "rope_interleaved";
+    if (v == dnnl_rope_half_split) return "rope_half_split";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
 }
@@ -174,6 +174,9 @@ PKIND_TRAITS_INST(binary);
 PKIND_TRAITS_INST(matmul);
 PKIND_TRAITS_INST(resampling);
 PKIND_TRAITS_INST(reduction);
+PKIND_TRAITS_INST(embedding_bag);
+PKIND_TRAITS_INST(rope);
+PKIND_TRAITS_INST(top_k);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
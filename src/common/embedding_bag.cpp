@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+
+#define VCHECK_EBAG(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, embedding_bag, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_EBAG_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, embedding_bag, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+
+status_t embedding_bag_desc_init(embedding_bag_desc_t *embedding_bag_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc) {
+
+    VCHECK_EBAG(!any_null(src_desc, indices_desc, offsets_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_EBAG(one_of(alg_kind, reduction_sum, reduction_mean, reduction_max),
+            VERBOSE_BAD_ALGORITHM);
+
+    VCHECK_EBAG(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_EBAG(indices_desc->ndims == 1, VERBOSE_BAD_NDIMS, "indices",
+            indices_desc->ndims);
+    VCHECK_EBAG(offsets_desc->ndims == 1, VERBOSE_BAD_NDIMS, "offsets",
+            offsets_desc->ndims);
+    VCHECK_EBAG(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+            dst_desc->ndims);
+
+    // The number of bags is defined by offsets and the embedding dimension is
+    // defined by the table.
+    VCHECK_EBAG(dst_desc->dims[0] == offsets_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "offsets", 0);
+    VCHECK_EBAG(dst_desc->dims[1] == src_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "dst", 1, "src", 1);
+
+    VCHECK_EBAG(one_of(indices_desc->data_type, data_type::s32),
+            VERBOSE_INVALID_DATATYPE, "indices");
+    VCHECK_EBAG(one_of(offsets_desc->data_type, data_type::s32),
+            VERBOSE_INVALID_DATATYPE, "offsets");
+
+    VCHECK_EBAG(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_EBAG(indices_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "indices");
+    VCHECK_EBAG(offsets_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "offsets");
+    VCHECK_EBAG(one_of(dst_desc->format_kind, format_kind::blocked,
+                        format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+    VCHECK_EBAG(src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG, "src");
+    VCHECK_EBAG(IMPLICATION(dst_desc->format_kind == format_kind::blocked,
+                        dst_desc->extra.flags == 0),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+
+    auto ed = embedding_bag_desc_t();
+    ed.primitive_kind = primitive_kind::embedding_bag;
+    ed.alg_kind = alg_kind;
+
+    ed.src_desc = *src_desc;
+    ed.indices_desc = *indices_desc;
+    ed.offsets_desc = *offsets_desc;
+    ed.dst_desc = *dst_desc;
+
+    (*embedding_bag_desc) = ed;
+    return success;
+}
+
+status_t embedding_bag_attr_check(const embedding_bag_desc_t &desc,
+        const engine_t *engine, const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    // Check attributes
+    const data_type_t dst_dt = desc.dst_desc.data_type;
+
+    auto attr_mask = smask_t::scales_runtime;
+
+    VCHECK_EBAG_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+
+    // Scales dequantize the rows of the table, either with a common scale or
+    // with a scale per row.
+    if (!attr->scales_.has_default_values()) {
+        const auto &sc = attr->scales_;
+        VCHECK_EBAG_UNIMPL(sc.has_default_values({DNNL_ARG_SRC}),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        const auto &src_sc = sc.get(DNNL_ARG_SRC);
+        VCHECK_EBAG_UNIMPL(one_of(src_sc.mask_, 0, 1)
+                        && src_sc.has_default_groups()
+                        && src_sc.has_default_data_type(),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+    }
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_embedding_bag_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc, const primitive_attr_t *attr) {
+
+    auto embedding_bag_desc = embedding_bag_desc_t();
+    CHECK(embedding_bag_desc_init(&embedding_bag_desc, alg_kind, src_desc,
+            indices_desc, offsets_desc, dst_desc));
+    CHECK(embedding_bag_attr_check(embedding_bag_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&embedding_bag_desc, nullptr, attr);
+}
@@ -78,6 +78,14 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
                 storage, dnnl::impl::memory_flags_t::alloc, size, nullptr);
     }
 
+    /** create memory storage over `size` bytes of a file starting at
+     * `offset` */
+    virtual dnnl::impl::status_t create_mapped_memory_storage(
+            dnnl::impl::memory_storage_t **storage, const char *path,
+            size_t offset, size_t size) {
+        return dnnl::impl::status::unimplemented;
+    }
+
     /** create stream */
     virtual dnnl::impl::status_t create_stream(
             dnnl::impl::stream_t **stream, unsigned flags)
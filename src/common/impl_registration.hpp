@@ -96,6 +96,13 @@
     {}
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_EMBEDDING_BAG
+#define REG_EMBEDDING_BAG_P(...) __VA_ARGS__
+#else
+#define REG_EMBEDDING_BAG_P(...) \
+    {}
+#endif
+
 #if BUILD_PRIMITIVE_ALL || BUILD_GROUP_NORMALIZATION
 #define REG_GNORM_P(...) __VA_ARGS__
 #else
@@ -173,6 +180,13 @@
     {}
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_ROPE
+#define REG_ROPE_P(...) __VA_ARGS__
+#else
+#define REG_ROPE_P(...) \
+    {}
+#endif
+
 #if BUILD_PRIMITIVE_ALL || BUILD_SHUFFLE
 #define REG_SHUFFLE_P(...) __VA_ARGS__
 #else
@@ -194,6 +208,13 @@
     { nullptr }
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_TOP_K
+#define REG_TOP_K_P(...) __VA_ARGS__
+#else
+#define REG_TOP_K_P(...) \
+    {}
+#endif
+
 // Primitive CPU ISA section is in src/cpu/platform.hpp
 
 #if BUILD_PRIMITIVE_GPU_ISA_ALL || BUILD_GEN9
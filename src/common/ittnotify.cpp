@@ -79,6 +79,9 @@ void primitive_task_start(primitive_kind_t kind) {
             CASE(softmax),
             CASE(layer_normalization),
             CASE(group_normalization),
+            CASE(embedding_bag),
+            CASE(rope),
+            CASE(top_k),
     };
 #undef CASE
     int kind_idx = (int)kind;
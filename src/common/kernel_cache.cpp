@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2023 Intel Corporation
+* Copyright 2023-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -87,5 +87,11 @@ iface_t::result_t iface_t::get_or_create(
 }
 
 } // namespace kernel_cache
+
+status_t get_kernel_cache_size(int *size) {
+    if (size == nullptr) return status::invalid_arguments;
+    *size = kernel_cache::get().get_size();
+    return status::success;
+}
 } // namespace impl
 } // namespace dnnl
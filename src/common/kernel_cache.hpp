@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2023 Intel Corporation
+* Copyright 2023-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -136,6 +136,8 @@ private:
 iface_t get();
 
 } // namespace kernel_cache
+
+status_t DNNL_API get_kernel_cache_size(int *size);
 } // namespace impl
 } // namespace dnnl
 
@@ -84,6 +84,11 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool use_global_stats() const {
         return desc_.flags & normalization_flags::use_global_stats;
     }
+    // RMS normalization considers the mean to be zero, so it's neither
+    // computed nor used as an argument.
+    bool skip_mean() const {
+        return desc_.flags & normalization_flags::rms_norm;
+    }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -100,6 +105,9 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     const memory_desc_t *stat_md() const { return &stat_md_; }
 
 protected:
+    // the number of statistics arguments
+    int n_stats() const { return skip_mean() ? 1 : 2; }
+
     layer_normalization_desc_t desc_;
     const layer_normalization_fwd_pd_t *hint_fwd_pd_;
 
@@ -164,6 +172,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_MEAN && skip_mean()) return arg_usage_t::unused;
         if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
             if (stats_are_src()) return arg_usage_t::input;
             if (!stats_are_src() && is_training()) return arg_usage_t::output;
@@ -211,11 +220,11 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + 2 * stats_are_src() + use_scale() + use_shift()
+        return 1 + n_stats() * stats_are_src() + use_scale() + use_shift()
                 + n_binary_po_inputs();
     }
     int n_outputs() const override {
-        return 1 + 2 * (!stats_are_src()) * is_training();
+        return 1 + n_stats() * (!stats_are_src()) * is_training();
     }
 
 protected:
@@ -260,6 +269,7 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     typedef layer_normalization_fwd_pd_t hint_class;
 
     arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_MEAN && skip_mean()) return arg_usage_t::unused;
         if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE,
                     DNNL_ARG_DIFF_DST))
             return arg_usage_t::input;
@@ -321,7 +331,9 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         return index == 0 ? &diff_scaleshift_md_ : &glob_zero_md;
     }
 
-    int n_inputs() const override { return 4 + use_scale() + use_shift(); }
+    int n_inputs() const override {
+        return 2 + n_stats() + use_scale() + use_shift();
+    }
     int n_outputs() const override {
         return 1
                 + (desc_.prop_kind == prop_kind::backward)
@@ -67,6 +67,14 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     }
     // Matmul supports fpmath mode
     attr_mask |= smask_t::fpmath_mode;
+    // Matmul supports gating for floating point data types
+    if (!is_int8 && !wei_is_int) attr_mask |= smask_t::gating;
+    // Matmul supports dynamic quantization of floating point source
+    const bool is_src_dyn_quant_ok
+            = utils::one_of(src_dt, data_type::f32, data_type::bf16)
+            && wei_dt == data_type::s8
+            && utils::one_of(dst_dt, data_type::f32, data_type::bf16);
+    if (is_src_dyn_quant_ok) attr_mask |= smask_t::src_dyn_quant;
 
     VCHECK_MATMUL_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
@@ -120,6 +128,31 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         }
     }
 
+    // Check gating
+    if (!attr->gating_.has_default_values()) {
+        VCHECK_MATMUL_UNIMPL(desc.bias_desc.ndims == 0,
+                VERBOSE_UNSUPPORTED_BIAS_CFG);
+        VCHECK_MATMUL_UNIMPL(attr->scales_.has_default_values()
+                        && attr->zero_points_.has_default_values(),
+                VERBOSE_UNSUPPORTED_ATTR);
+    }
+
+    // Check dynamic quantization, the source scales are computed by the
+    // primitive and the weights are not decompressed.
+    if (!attr->src_dyn_quant_.has_default_values()) {
+        const auto &sc = attr->scales_;
+        VCHECK_MATMUL_UNIMPL(sc.get(DNNL_ARG_SRC).has_default_values()
+                        && sc.get(DNNL_ARG_DST).has_default_values()
+                        && sc.get(DNNL_ARG_WEIGHTS).ndims_ == 0
+                        && sc.get(DNNL_ARG_WEIGHTS).data_type_ == data_type::f32
+                        && !(sc.get(DNNL_ARG_WEIGHTS).mask_ & wei_qmask_K),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_MATMUL_UNIMPL(attr->zero_points_.has_default_values(),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCHECK_MATMUL_UNIMPL(!attr->fpmath_.apply_to_int_,
+                VERBOSE_UNSUPPORTED_FPMATH_MODE);
+    }
+
     // Check post-ops
     if (!attr->post_ops_.has_default_values()) {
         const auto &po = attr->post_ops_;
@@ -142,7 +175,8 @@ namespace dnnl {
 namespace impl {
 status_t matmul_desc_init(matmul_desc_t *matmul_desc,
         const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
-        const memory_desc_t *bias_desc, const memory_desc_t *dst_desc) {
+        const memory_desc_t *bias_desc, const memory_desc_t *dst_desc,
+        bool with_gating) {
     VCHECK_MATMUL(
             !any_null(src_desc, weights_desc, dst_desc), VERBOSE_NULL_ARG);
 
@@ -170,7 +204,11 @@ status_t matmul_desc_init(matmul_desc_t *matmul_desc,
     const int n_idx = ndims - 1;
     VCHECK_MATMUL(dst_desc->dims[m_idx] == src_desc->dims[m_idx],
             VERBOSE_INCONSISTENT_DIM, "dst", m_idx, "src", m_idx);
-    VCHECK_MATMUL(dst_desc->dims[n_idx] == weights_desc->dims[n_idx],
+    // With the gating the weights hold the gate and the up projections.
+    const dim_t dst_n = dst_desc->dims[n_idx];
+    VCHECK_MATMUL(with_gating ? !is_runtime_value(dst_n)
+                            && weights_desc->dims[n_idx] == 2 * dst_n
+                              : weights_desc->dims[n_idx] == dst_n,
             VERBOSE_INCONSISTENT_DIM, "dst", n_idx, "weights", n_idx);
     VCHECK_MATMUL(src_desc->dims[k_idx_src] == weights_desc->dims[k_idx_wei],
             VERBOSE_INCONSISTENT_DIM, "src", k_idx_src, "weights", k_idx_wei);
@@ -236,8 +274,9 @@ status_t dnnl_matmul_primitive_desc_create(
         const memory_desc_t *bias_desc, const memory_desc_t *dst_desc,
         const primitive_attr_t *attr) {
     auto matmul_desc = matmul_desc_t();
-    CHECK(matmul_desc_init(
-            &matmul_desc, src_desc, weights_desc, bias_desc, dst_desc));
+    const bool with_gating = attr && !attr->gating_.has_default_values();
+    CHECK(matmul_desc_init(&matmul_desc, src_desc, weights_desc, bias_desc,
+            dst_desc, with_gating));
     CHECK(matmul_attr_check(matmul_desc, engine, attr));
     return primitive_desc_create(primitive_desc_iface, engine,
             (const op_desc_t *)&matmul_desc, nullptr, attr);
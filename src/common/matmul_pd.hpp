@@ -38,7 +38,8 @@ namespace impl {
 
 status_t matmul_desc_init(matmul_desc_t *matmul_desc,
         const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
-        const memory_desc_t *bias_desc, const memory_desc_t *dst_desc);
+        const memory_desc_t *bias_desc, const memory_desc_t *dst_desc,
+        bool with_gating = false);
 
 struct matmul_pd_t : public primitive_desc_t {
     static constexpr auto base_pkind = primitive_kind::matmul;
@@ -113,6 +114,11 @@ struct matmul_pd_t : public primitive_desc_t {
     }
 
     bool with_bias() const { return bias_md_.ndims != 0; }
+    // With the gating the weights N dimension is twice as large as N().
+    bool with_gating() const { return !attr()->gating_.has_default_values(); }
+    bool with_src_dyn_quant() const {
+        return !attr()->src_dyn_quant_.has_default_values();
+    }
     bool batched() const { return ndims() > 2; }
 
     dim_t batch() const {
@@ -204,6 +204,30 @@ status_t dnnl_memory_create_v2(memory_t **memory, const memory_desc_t *md,
     return success;
 }
 
+status_t dnnl_memory_create_from_file(memory_t **memory,
+        const memory_desc_t *md, engine_t *engine, const char *path,
+        size_t offset) {
+    if (any_null(memory, md, engine, path)) return invalid_arguments;
+
+    const auto mdw = memory_desc_wrapper(md);
+    VCHECK_MEMORY(
+            !mdw.format_any(), invalid_arguments, VERBOSE_UNSUPPORTED_TAG);
+    VCHECK_MEMORY(!mdw.has_runtime_dims_or_strides(), invalid_arguments,
+            VERBOSE_UNSUPPORTED_MEM_STRIDE);
+    VCHECK_MEMORY(mdw.is_blocking_desc(), invalid_arguments,
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    memory_storage_t *memory_storage_ptr = nullptr;
+    CHECK(engine->create_mapped_memory_storage(
+            &memory_storage_ptr, path, offset, mdw.size()));
+    std::unique_ptr<memory_storage_t> memory_storage(memory_storage_ptr);
+
+    auto _memory = new memory_t(engine, md, std::move(memory_storage));
+    if (_memory == nullptr) return out_of_memory;
+    *memory = _memory;
+    return success;
+}
+
 status_t dnnl_memory_get_memory_desc(
         const memory_t *memory, const memory_desc_t **md) {
     if (any_null(memory, md)) return invalid_arguments;
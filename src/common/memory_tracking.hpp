@@ -241,6 +241,7 @@ enum {
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
     key_matmul_dst_in_acc_dt,
+    key_matmul_src_dyn_quant_scales,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -282,10 +283,13 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_rope_tables,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_top_k_candidates,
+    key_top_k_heap,
     key_wino_U,
     key_wino_V,
     key_wino_M,
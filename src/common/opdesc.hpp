@@ -449,10 +449,13 @@ struct binary_desc_t {
     primitive_kind_t primitive_kind;
     // The kind of the binary algorithm. Possible values:
     // #dnnl_binary_add, #dnnl_binary_mul, #dnnl_binary_max, #dnnl_binary_min,
-    // #dnnl_binary_div and #dnnl_binary_sub.
+    // #dnnl_binary_div, #dnnl_binary_sub, #dnnl_binary_ge, #dnnl_binary_gt,
+    // #dnnl_binary_le, #dnnl_binary_lt, #dnnl_binary_eq, #dnnl_binary_ne and
+    // #dnnl_binary_select.
     alg_kind_t alg_kind;
-    // Source memory descriptors.
-    memory_desc_t src_desc[2];
+    // Source memory descriptors. The third one is the condition of
+    // #dnnl_binary_select and is a zero memory descriptor otherwise.
+    memory_desc_t src_desc[3];
     // Destination memory descriptor.
     memory_desc_t dst_desc;
 };
@@ -591,6 +594,64 @@ struct rnn_desc_t {
     float beta;
 };
 
+// A descriptor of an embedding bag operation.
+struct embedding_bag_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_embedding_bag.
+    primitive_kind_t primitive_kind;
+    // The kind of pooling applied to the rows of a bag. Possible values:
+    // #dnnl_reduction_sum, #dnnl_reduction_mean, #dnnl_reduction_max.
+    alg_kind_t alg_kind;
+    // Embedding table memory descriptor.
+    memory_desc_t src_desc;
+    // Indices memory descriptor.
+    memory_desc_t indices_desc;
+    // Offsets memory descriptor.
+    memory_desc_t offsets_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+};
+
+// A descriptor of a rotary position embedding (RoPE) operation.
+struct rope_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_rope.
+    primitive_kind_t primitive_kind;
+    // The kind of RoPE algorithm. Possible values: #dnnl_rope_interleaved,
+    // #dnnl_rope_half_split.
+    alg_kind_t alg_kind;
+    // Source memory descriptor.
+    memory_desc_t src_desc;
+    // Cosine table memory descriptor. A zero memory descriptor means the
+    // values are computed from `base`.
+    memory_desc_t cos_desc;
+    // Sine table memory descriptor. A zero memory descriptor means the
+    // values are computed from `base`.
+    memory_desc_t sin_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+    // The base of the rotation frequencies.
+    float base;
+};
+
+// A descriptor of a top-k operation.
+struct top_k_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_top_k.
+    primitive_kind_t primitive_kind;
+    // The kind of top-k algorithm. Possible values: #dnnl_reduction_max,
+    // #dnnl_reduction_min.
+    alg_kind_t alg_kind;
+    // Source memory descriptor.
+    memory_desc_t src_desc;
+    // Destination (values) memory descriptor.
+    memory_desc_t dst_desc;
+    // Destination (indices) memory descriptor.
+    memory_desc_t indices_desc;
+    // The axis along which the elements are selected.
+    int axis;
+};
+
 struct op_desc_t {
     union {
         primitive_kind_t kind;
@@ -616,6 +677,9 @@ struct op_desc_t {
         resampling_desc_t resampling;
         zero_pad_desc_t zero_pad;
         reduction_desc_t reduction;
+        embedding_bag_desc_t embedding_bag;
+        rope_desc_t rope;
+        top_k_desc_t top_k;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type) \
@@ -648,6 +712,9 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
     DECL_CTOR_AND_CONVERTERS(reduction_desc_t);
+    DECL_CTOR_AND_CONVERTERS(embedding_bag_desc_t);
+    DECL_CTOR_AND_CONVERTERS(rope_desc_t);
+    DECL_CTOR_AND_CONVERTERS(top_k_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
@@ -154,6 +154,9 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
             utils::one_of(acc_mode_, dnnl::impl::accumulation_mode::strict,
                     dnnl::impl::accumulation_mode::relaxed,
                     dnnl::impl::accumulation_mode::any)));
+    CHECK_MASK(smask_t::gating, gating_);
+    CHECK_MASK(smask_t::src_dyn_quant, src_dyn_quant_);
+    CHECK_MASK(smask_t::dst_dyn_quant, dst_dyn_quant_);
     CHECK_ARG(this->defined(defined_mask));
     bool fpmath_mode_ok = IMPLICATION(
             (bool)(~mask & smask_t::fpmath_mode) && fpmath_.apply_to_int_,
@@ -402,6 +405,35 @@ status_t primitive_attr_t::set_accumulation_mode(accumulation_mode_t am) {
     return success;
 }
 
+status_t primitive_attr_t::set_gating(alg_kind_t alg, float alpha, float beta) {
+    VCONDCHECK(primitive, create, check, attr,
+            alg == alg_kind::undef
+                    || math::is_eltwise_ok(data_type::f32, alg, alpha, beta),
+            invalid_arguments, VERBOSE_BAD_ALGORITHM);
+    gating_.alg_ = alg;
+    gating_.alpha_ = alg == alg_kind::undef ? 0.f : alpha;
+    gating_.beta_ = alg == alg_kind::undef ? 0.f : beta;
+    return success;
+}
+
+status_t primitive_attr_t::set_src_dyn_quantization(data_type_t data_type) {
+    VCONDCHECK(primitive, create, check, attr,
+            one_of(data_type, data_type::undef, data_type::s8),
+            invalid_arguments, VERBOSE_INVALID_DATATYPE,
+            "dynamic quantization");
+    src_dyn_quant_.data_type_ = data_type;
+    return success;
+}
+
+status_t primitive_attr_t::set_dst_dyn_quantization(data_type_t data_type) {
+    VCONDCHECK(primitive, create, check, attr,
+            one_of(data_type, data_type::undef, data_type::s8),
+            invalid_arguments, VERBOSE_INVALID_DATATYPE,
+            "dynamic quantization");
+    dst_dyn_quant_.data_type_ = data_type;
+    return success;
+}
+
 status_t primitive_attr_t::set_scratchpad_mode(
         scratchpad_mode_t scratchpad_mode) {
     const bool ok = one_of(
@@ -490,6 +522,47 @@ status_t dnnl_primitive_attr_set_accumulation_mode(
     return attr->set_accumulation_mode(am);
 }
 
+status_t dnnl_primitive_attr_get_gating(const primitive_attr_t *attr,
+        alg_kind_t *alg, float *alpha, float *beta) {
+    if (any_null(attr, alg, alpha, beta)) return invalid_arguments;
+    *alg = attr->gating_.alg_;
+    *alpha = attr->gating_.alpha_;
+    *beta = attr->gating_.beta_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_gating(
+        primitive_attr_t *attr, alg_kind_t alg, float alpha, float beta) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_gating(alg, alpha, beta);
+}
+
+status_t dnnl_primitive_attr_get_src_dynamic_quantization(
+        const primitive_attr_t *attr, data_type_t *data_type) {
+    if (any_null(attr, data_type)) return invalid_arguments;
+    *data_type = attr->src_dyn_quant_.data_type_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_src_dynamic_quantization(
+        primitive_attr_t *attr, data_type_t data_type) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_src_dyn_quantization(data_type);
+}
+
+status_t dnnl_primitive_attr_get_dst_dynamic_quantization(
+        const primitive_attr_t *attr, data_type_t *data_type) {
+    if (any_null(attr, data_type)) return invalid_arguments;
+    *data_type = attr->dst_dyn_quant_.data_type_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_dst_dynamic_quantization(
+        primitive_attr_t *attr, data_type_t data_type) {
+    if (any_null(attr)) return invalid_arguments;
+    return attr->set_dst_dyn_quantization(data_type);
+}
+
 status_t dnnl_primitive_attr_get_deterministic(
         const primitive_attr_t *attr, int *d) {
     if (any_null(attr, d)) return invalid_arguments;
@@ -490,6 +490,39 @@ struct fpmath_t : public c_compatible {
     bool apply_to_int_;
 };
 
+// The activation applied to the gate half of the matmul result, which is
+// then multiplied by the other half.
+struct gating_t : public c_compatible {
+    gating_t() = default;
+
+    bool operator==(const gating_t &rhs) const {
+        return alg_ == rhs.alg_ && alpha_ == rhs.alpha_ && beta_ == rhs.beta_;
+    }
+
+    bool has_default_values() const { return alg_ == alg_kind::undef; }
+
+    dnnl::impl::alg_kind_t alg_ = alg_kind::undef;
+    float alpha_ = 0.f;
+    float beta_ = 0.f;
+};
+
+// The data type a tensor is quantized to at the execution time, with the
+// scales computed by the primitive from the maximum absolute values of the
+// tensor slices the scales apply to.
+struct dyn_quantization_t : public c_compatible {
+    dyn_quantization_t() = default;
+
+    bool operator==(const dyn_quantization_t &rhs) const {
+        return data_type_ == rhs.data_type_;
+    }
+
+    bool has_default_values() const {
+        return data_type_ == data_type::undef;
+    }
+
+    dnnl::impl::data_type_t data_type_ = data_type::undef;
+};
+
 } // namespace impl
 } // namespace dnnl
 
@@ -766,6 +799,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         scratchpad_mode_ = other.scratchpad_mode_;
         fpmath_ = other.fpmath_;
         acc_mode_ = other.acc_mode_;
+        gating_ = other.gating_;
+        src_dyn_quant_ = other.src_dyn_quant_;
+        dst_dyn_quant_ = other.dst_dyn_quant_;
         deterministic_ = other.deterministic_;
         post_ops_ = other.post_ops_;
         rnn_data_qparams_ = other.rnn_data_qparams_;
@@ -802,6 +838,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         zero_points_runtime_groups = (unsigned)zero_points_runtime | (1u << 17),
         zero_points_runtime_data_type
         = (unsigned)zero_points_runtime | (1u << 18),
+        gating = 1u << 19,
+        src_dyn_quant = 1u << 20,
+        dst_dyn_quant = 1u << 21,
     };
 
     /** Returns true if the attributes have default values.
@@ -816,6 +855,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     bool operator==(const dnnl_primitive_attr &rhs) const {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_ == rhs.fpmath_ && acc_mode_ == rhs.acc_mode_
+                && gating_ == rhs.gating_
+                && src_dyn_quant_ == rhs.src_dyn_quant_
+                && dst_dyn_quant_ == rhs.dst_dyn_quant_
                 && deterministic_ == rhs.deterministic_
                 && output_scales_ == rhs.output_scales_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
@@ -835,6 +877,12 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
             dnnl::impl::fpmath_mode_t fpmath_mode, bool apply_to_int = false);
     dnnl::impl::status_t set_accumulation_mode(
             dnnl::impl::accumulation_mode_t am);
+    dnnl::impl::status_t set_gating(
+            dnnl::impl::alg_kind_t alg, float alpha, float beta);
+    dnnl::impl::status_t set_src_dyn_quantization(
+            dnnl::impl::data_type_t data_type);
+    dnnl::impl::status_t set_dst_dyn_quantization(
+            dnnl::impl::data_type_t data_type);
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
@@ -894,6 +942,9 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::scratchpad_mode_t scratchpad_mode_;
     dnnl::impl::fpmath_t fpmath_;
     dnnl::impl::accumulation_mode_t acc_mode_;
+    dnnl::impl::gating_t gating_;
+    dnnl::impl::dyn_quantization_t src_dyn_quant_;
+    dnnl::impl::dyn_quantization_t dst_dyn_quant_;
     bool deterministic_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2023 Intel Corporation
+* Copyright 2020-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include "kernel_cache.hpp"
 #include "primitive.hpp"
 #include "primitive_desc_iface.hpp"
+#include "primitive_future.hpp"
 #include "primitive_iface.hpp"
 #include "z_magic.hpp"
 
@@ -156,3 +157,9 @@ dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
 #endif
     return dnnl::impl::status::success;
 }
+
+dnnl::impl::status_t dnnl_primitive_cache_warm_up(
+        int n, const primitive_desc_iface_t *const *primitive_desc_ifaces) {
+    return dnnl::impl::create_primitives_on_pool(
+            nullptr, n, primitive_desc_ifaces);
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2023 Intel Corporation
+* Copyright 2018-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -67,7 +67,9 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
             case primitive_desc_t::arg_usage_t::output:
                 args[arg] = {mem, false};
                 n_outputs++;
-                extra_outputs += (arg == DNNL_ARG_SCRATCHPAD);
+                extra_outputs += (arg == DNNL_ARG_SCRATCHPAD)
+                        // dynamically computed scales
+                        || (arg & DNNL_ARG_ATTR_SCALES);
                 break;
             case primitive_desc_t::arg_usage_t::unused:
                 VINFO(primitive, exec, check, primitive,
@@ -0,0 +1,257 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "cache_blob.hpp"
+#include "primitive.hpp"
+#include "primitive_desc_iface.hpp"
+#include "primitive_future.hpp"
+#include "primitive_iface.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+namespace {
+
+// A pool of background threads that create primitives. The threads are
+// started with the first request. There are half as many of them as the
+// hardware threads, so that the creation leaves the cores to the threads
+// that compute.
+//
+// The pool is never destroyed and its threads are never joined: at the
+// library unload the objects used by the creation may be destroyed already,
+// and joining the threads may deadlock under the loader lock on Windows.
+// Instead, the requests still queued at the program exit are cancelled.
+struct creation_pool_t {
+    // A task is called with `is_cancelled` set if it is dropped from the
+    // queue without being run.
+    using task_t = std::function<void(bool is_cancelled)>;
+
+    static creation_pool_t &get() {
+        static creation_pool_t *pool = new creation_pool_t();
+        static struct cancel_at_exit_t {
+            ~cancel_at_exit_t() { pool->cancel(); }
+        } cancel_at_exit;
+        return *pool;
+    }
+
+    void submit(task_t &&task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!stop_) {
+                if (!started_) start();
+                tasks_.push_back(std::move(task));
+                cv_.notify_one();
+                return;
+            }
+        }
+        task(true);
+    }
+
+    void cancel() {
+        std::deque<task_t> tasks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+            tasks.swap(tasks_);
+        }
+        cv_.notify_all();
+        for (auto &task : tasks)
+            task(true);
+    }
+
+private:
+    creation_pool_t() = default;
+
+    void start() {
+        const int nthr = std::max(
+                1, static_cast<int>(std::thread::hardware_concurrency()) / 2);
+        for (int i = 0; i < nthr; i++)
+            std::thread(&creation_pool_t::worker, this).detach();
+        started_ = true;
+    }
+
+    void worker() {
+        while (true) {
+            task_t task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                if (stop_) return;
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task(false);
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<task_t> tasks_;
+    bool started_ = false;
+    bool stop_ = false;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(creation_pool_t);
+};
+
+} // namespace
+
+dnnl_primitive_future::dnnl_primitive_future(
+        const std::shared_ptr<primitive_desc_iface_t> &primitive_desc_iface) {
+    // std::function requires a copyable callable, hence the shared promise.
+    auto promise = std::make_shared<std::promise<result_t>>();
+    result_ = promise->get_future();
+    creation_pool_t::get().submit(
+            [promise, primitive_desc_iface](bool is_cancelled) {
+                if (is_cancelled) {
+                    promise->set_value({runtime_error, nullptr});
+                    return;
+                }
+                primitive_iface_t *primitive_iface = nullptr;
+                const status_t status = dnnl_primitive_create(
+                        &primitive_iface, primitive_desc_iface.get());
+                promise->set_value({status, primitive_iface});
+            });
+}
+
+dnnl_primitive_future::~dnnl_primitive_future() {
+    if (!result_.valid()) return;
+    // The primitive was never obtained by the user.
+    auto result = result_.get();
+    if (result.second) result.second->release();
+}
+
+bool dnnl_primitive_future::is_ready() const {
+    return !result_.valid()
+            || result_.wait_for(std::chrono::seconds(0))
+            == std::future_status::ready;
+}
+
+status_t dnnl_primitive_future::get(primitive_iface_t **primitive_iface) {
+    if (!result_.valid()) return invalid_arguments;
+    const auto result = result_.get();
+    if (result.first != success) return result.first;
+    *primitive_iface = result.second;
+    return success;
+}
+
+namespace dnnl {
+namespace impl {
+
+status_t create_primitives_on_pool(primitive_iface_t **primitive_ifaces, int n,
+        const primitive_desc_iface_t *const *primitive_desc_ifaces) {
+    if (n < 0) return invalid_arguments;
+    if (n > 0 && primitive_desc_ifaces == nullptr) return invalid_arguments;
+    for (int i = 0; i < n; i++)
+        if (primitive_desc_ifaces[i] == nullptr) return invalid_arguments;
+    if (n == 0) return success;
+
+    // The primitive descriptors stay alive until all the tasks are completed,
+    // so they are not copied.
+    std::mutex mutex;
+    std::condition_variable cv;
+    int remaining = n;
+    std::vector<status_t> statuses(n, success);
+    for (int i = 0; i < n; i++) {
+        if (primitive_ifaces) primitive_ifaces[i] = nullptr;
+        creation_pool_t::get().submit([&, i](bool is_cancelled) {
+            const auto *pd_iface = primitive_desc_ifaces[i];
+            status_t status = runtime_error;
+            if (!is_cancelled && primitive_ifaces) {
+                status = dnnl_primitive_create(&primitive_ifaces[i], pd_iface);
+            } else if (!is_cancelled) {
+                // Only the implementation is created, so that no resources
+                // such as the scratchpad are allocated.
+                std::pair<std::shared_ptr<primitive_t>, bool> p;
+                status = pd_iface->impl()->create_primitive(
+                        p, pd_iface->engine(), cache_blob_t());
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            statuses[i] = status;
+            if (--remaining == 0) cv.notify_one();
+        });
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return remaining == 0; });
+    }
+
+    status_t status = success;
+    for (int i = 0; i < n; i++)
+        if (status == success) status = statuses[i];
+    if (status != success && primitive_ifaces) {
+        for (int i = 0; i < n; i++) {
+            if (primitive_ifaces[i]) primitive_ifaces[i]->release();
+            primitive_ifaces[i] = nullptr;
+        }
+    }
+    return status;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+// API
+status_t dnnl_primitive_create_async(primitive_future_t **primitive_future,
+        const primitive_desc_iface_t *primitive_desc_iface) {
+    if (utils::any_null(primitive_future, primitive_desc_iface))
+        return invalid_arguments;
+
+    // The future keeps a copy of the primitive descriptor, so the user may
+    // destroy theirs before the creation is completed.
+    primitive_desc_iface_t *pd_copy = nullptr;
+    CHECK(dnnl_primitive_desc_clone(&pd_copy, primitive_desc_iface));
+    std::shared_ptr<primitive_desc_iface_t> pd_iface(
+            pd_copy, dnnl_primitive_desc_destroy);
+    return safe_ptr_assign(*primitive_future, new primitive_future_t(pd_iface));
+}
+
+status_t dnnl_primitive_future_is_ready(
+        const primitive_future_t *primitive_future, int *is_ready) {
+    if (utils::any_null(primitive_future, is_ready)) return invalid_arguments;
+    *is_ready = primitive_future->is_ready();
+    return success;
+}
+
+status_t dnnl_primitive_future_get(primitive_future_t *primitive_future,
+        primitive_iface_t **primitive_iface) {
+    if (utils::any_null(primitive_future, primitive_iface))
+        return invalid_arguments;
+    return primitive_future->get(primitive_iface);
+}
+
+status_t dnnl_primitive_future_destroy(primitive_future_t *primitive_future) {
+    delete primitive_future;
+    return success;
+}
+
+status_t dnnl_primitive_create_batch(primitive_iface_t **primitive_ifaces,
+        int n, const primitive_desc_iface_t *const *primitive_desc_ifaces) {
+    if (n < 0) return invalid_arguments;
+    if (n > 0 && primitive_ifaces == nullptr) return invalid_arguments;
+    return dnnl::impl::create_primitives_on_pool(
+            primitive_ifaces, n, primitive_desc_ifaces);
+}
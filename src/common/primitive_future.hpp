@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PRIMITIVE_FUTURE_HPP
+#define COMMON_PRIMITIVE_FUTURE_HPP
+
+#include <future>
+#include <memory>
+#include <utility>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+// dnnl_primitive_future is a user facing entity that has an alias
+// primitive_future_t for internal use.
+//
+// It holds the result of a primitive creation that is executed on the
+// library-managed pool of background threads. The creation shares the
+// ownership of the primitive descriptor the primitive is created from.
+struct dnnl_primitive_future : public dnnl::impl::c_compatible {
+    dnnl_primitive_future(const std::shared_ptr<primitive_desc_iface_t>
+                    &primitive_desc_iface);
+    // Waits for the creation to complete.
+    ~dnnl_primitive_future();
+
+    bool is_ready() const;
+    // Waits for the creation to complete and passes the ownership of the
+    // created primitive to the caller. The primitive can be obtained only
+    // once.
+    dnnl::impl::status_t get(primitive_iface_t **primitive_iface);
+
+private:
+    using result_t = std::pair<dnnl::impl::status_t, primitive_iface_t *>;
+
+    std::future<result_t> result_;
+
+    dnnl_primitive_future() = delete;
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive_future);
+};
+
+namespace dnnl {
+namespace impl {
+
+// Creates the primitives for `n` primitive descriptors on the pool of the
+// creation threads and waits for them. If `primitive_ifaces` is nullptr, only
+// the primitive implementations are created, which puts them into the
+// primitive cache. On failure, no primitives are returned.
+status_t create_primitives_on_pool(primitive_iface_t **primitive_ifaces, int n,
+        const primitive_desc_iface_t *const *primitive_desc_ifaces);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -71,6 +71,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
@@ -83,9 +84,11 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(rope)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(top_k)
             CASE(zero_pad)
             default: assert(!"unknown primitive kind");
         }
@@ -207,6 +210,18 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.deterministic_));
     // acc_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.acc_mode_));
+    // gating
+    if (!attr.gating_.has_default_values()) {
+        seed = hash_combine(seed, static_cast<size_t>(attr.gating_.alg_));
+        seed = hash_combine(seed, attr.gating_.alpha_);
+        seed = hash_combine(seed, attr.gating_.beta_);
+    }
+    // src_dyn_quant
+    seed = hash_combine(
+            seed, static_cast<size_t>(attr.src_dyn_quant_.data_type_));
+    // dst_dyn_quant
+    seed = hash_combine(
+            seed, static_cast<size_t>(attr.dst_dyn_quant_.data_type_));
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -354,6 +369,7 @@ size_t get_desc_hash(const binary_desc_t &desc) {
     // Memory descriptors
     seed = hash_combine(seed, get_md_hash(desc.src_desc[0]));
     seed = hash_combine(seed, get_md_hash(desc.src_desc[1]));
+    seed = hash_combine(seed, get_md_hash(desc.src_desc[2]));
     seed = hash_combine(seed, get_md_hash(desc.dst_desc));
     // Combined hash for binary op desc
     return seed;
@@ -407,6 +423,20 @@ size_t get_desc_hash(const eltwise_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const embedding_bag_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding bag desc
+    return seed;
+}
+
 size_t get_desc_hash(const gemm_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -650,6 +680,22 @@ size_t get_desc_hash(const rnn_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const rope_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.cos_desc));
+    seed = hash_combine(seed, get_md_hash(desc.sin_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Base
+    seed = hash_combine(seed, desc.base);
+    // Combined hash for rope desc
+    return seed;
+}
+
 // Shuffle
 size_t get_desc_hash(const shuffle_desc_t &desc) {
     size_t seed = 0;
@@ -700,6 +746,21 @@ size_t get_desc_hash(const sum_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const top_k_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    // Axis
+    seed = hash_combine(seed, desc.axis);
+    // Combined hash for top_k desc
+    return seed;
+}
+
 size_t get_desc_hash(const zero_pad_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -79,6 +79,7 @@ size_t get_desc_hash(const batch_normalization_desc_t &desc);
 size_t get_desc_hash(const binary_desc_t &desc);
 size_t get_desc_hash(const convolution_desc_t &desc);
 size_t get_desc_hash(const eltwise_desc_t &desc);
+size_t get_desc_hash(const embedding_bag_desc_t &desc);
 size_t get_desc_hash(const gemm_desc_t &desc);
 size_t get_desc_hash(const group_normalization_desc_t &desc);
 size_t get_desc_hash(const inner_product_desc_t &desc);
@@ -91,9 +92,11 @@ size_t get_desc_hash(const reduction_desc_t &desc);
 size_t get_desc_hash(const reorder_desc_t &desc);
 size_t get_desc_hash(const resampling_desc_t &desc);
 size_t get_desc_hash(const rnn_desc_t &desc);
+size_t get_desc_hash(const rope_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
 size_t get_desc_hash(const sum_desc_t &desc);
+size_t get_desc_hash(const top_k_desc_t &desc);
 size_t get_desc_hash(const zero_pad_desc_t &desc);
 
 template <typename T>
@@ -167,6 +170,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
@@ -179,9 +183,11 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(rope)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(top_k)
             CASE(zero_pad)
             default: assert(!"unknown primitive_kind");
         }
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2023 Intel Corporation
+* Copyright 2016-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -98,6 +98,25 @@ status_t reorder_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
                            zero_points.has_default_values(DNNL_ARG_DST)),
             VERBOSE_UNSUPPORTED_ZP_CFG);
 
+    // Dynamic quantization computes the destination scales from a floating
+    // point source, so the source scales and the zero points are not allowed.
+    if (!attr->dst_dyn_quant_.has_default_values()) {
+        const auto &dst_scales = attr->scales_.get(DNNL_ARG_DST);
+        VCHECK_REORDER(utils::one_of(src_md->data_type, data_type::f32,
+                               data_type::bf16)
+                        && dst_md->data_type == attr->dst_dyn_quant_.data_type_,
+                VERBOSE_UNSUPPORTED_DT);
+        VCHECK_REORDER(!dst_scales.has_default_values()
+                        && dst_scales.ndims_ == 0
+                        && dst_scales.data_type_ == data_type::f32
+                        && attr->scales_.get(DNNL_ARG_SRC).has_default_values(),
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        VCHECK_REORDER(zero_points.has_default_values(),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        VCHECK_REORDER(attr->post_ops_.has_default_values(),
+                VERBOSE_UNSUPPORTED_POSTOP);
+    }
+
     bool is_cross_engine = src_engine != dst_engine
             && utils::one_of(
                     engine_kind::gpu, src_engine->kind(), dst_engine->kind());
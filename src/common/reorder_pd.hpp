@@ -112,6 +112,12 @@ struct reorder_pd_t : public primitive_desc_t {
 
         if (arg == DNNL_ARG_TO) return arg_usage_t::output;
 
+        // The dynamically computed destination scales are written by the
+        // primitive.
+        if (arg == (DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST)
+                && !attr()->dst_dyn_quant_.has_default_values())
+            return arg_usage_t::output;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+
+#define VCHECK_ROPE(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, rope, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_ROPE_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, rope, (cond), status::unimplemented, \
+            msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+
+status_t rope_desc_init(rope_desc_t *rope_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *cos_desc,
+        const memory_desc_t *sin_desc, const memory_desc_t *dst_desc,
+        float base) {
+
+    VCHECK_ROPE(!any_null(src_desc, dst_desc), VERBOSE_NULL_ARG);
+    VCHECK_ROPE(one_of(alg_kind, rope_interleaved, rope_half_split),
+            VERBOSE_BAD_ALGORITHM);
+
+    const bool with_cos = cos_desc && !memory_desc_wrapper(cos_desc).is_zero();
+    const bool with_sin = sin_desc && !memory_desc_wrapper(sin_desc).is_zero();
+    VCHECK_ROPE(with_cos == with_sin, VERBOSE_INCONSISTENT_MDS, "cos", "sin");
+    const bool with_tables = with_cos;
+
+    const int ndims = src_desc->ndims;
+    VCHECK_ROPE(ndims >= 2, VERBOSE_BAD_NDIMS, "src", ndims);
+    VCHECK_ROPE(dst_desc->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS, "src",
+            "dst");
+    for (int d = 0; d < ndims; d++)
+        VCHECK_ROPE(src_desc->dims[d] == dst_desc->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "src", d, "dst", d);
+
+    // The elements of the last dimension are rotated in pairs.
+    const dim_t seq_len = src_desc->dims[ndims - 2];
+    const dim_t head_size = src_desc->dims[ndims - 1];
+    VCHECK_ROPE(head_size % 2 == 0, VERBOSE_BAD_DIM, "src", ndims - 1);
+
+    if (with_tables) {
+        for (const auto *md : {cos_desc, sin_desc}) {
+            VCHECK_ROPE(md->ndims == 2, VERBOSE_BAD_NDIMS, "tables", md->ndims);
+            VCHECK_ROPE(md->dims[0] == seq_len, VERBOSE_INCONSISTENT_DIM,
+                    "tables", 0, "src", ndims - 2);
+            VCHECK_ROPE(md->dims[1] == head_size / 2, VERBOSE_BAD_DIM,
+                    "tables", 1);
+            VCHECK_ROPE(md->format_kind == format_kind::blocked,
+                    VERBOSE_UNSUPPORTED_TAG_S, "tables");
+        }
+        VCHECK_ROPE(cos_desc->data_type == sin_desc->data_type,
+                VERBOSE_INCONSISTENT_DT, "cos", "sin");
+    } else {
+        VCHECK_ROPE(base > 0.f, VERBOSE_BAD_PARAM, "base");
+    }
+
+    VCHECK_ROPE(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_ROPE(one_of(dst_desc->format_kind, format_kind::blocked,
+                        format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+    auto rd = rope_desc_t();
+    rd.primitive_kind = primitive_kind::rope;
+    rd.alg_kind = alg_kind;
+
+    rd.src_desc = *src_desc;
+    if (with_tables) {
+        rd.cos_desc = *cos_desc;
+        rd.sin_desc = *sin_desc;
+    }
+    rd.dst_desc = *dst_desc;
+    rd.base = with_tables ? 0.f : base;
+
+    (*rope_desc) = rd;
+    return success;
+}
+
+status_t rope_attr_check(const rope_desc_t &desc, const engine_t *engine,
+        const primitive_attr_t *attr) {
+    if (attr == nullptr) return status::success;
+
+    // No attributes are supported.
+    VCHECK_ROPE_UNIMPL(attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_rope_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *cos_desc, const memory_desc_t *sin_desc,
+        const memory_desc_t *dst_desc, float base,
+        const primitive_attr_t *attr) {
+
+    auto rope_desc = rope_desc_t();
+    CHECK(rope_desc_init(&rope_desc, alg_kind, src_desc, cos_desc, sin_desc,
+            dst_desc, base));
+    CHECK(rope_attr_check(rope_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&rope_desc, nullptr, attr);
+}
@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ROPE_PD_HPP
+#define COMMON_ROPE_PD_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_ROPE(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, rope, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_ROPE_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, rope, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t rope_desc_init(rope_desc_t *rope_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *cos_desc,
+        const memory_desc_t *sin_desc, const memory_desc_t *dst_desc,
+        float base);
+
+// The RoPE primitive rotates the pairs of elements of the last dimension of
+// src by the angles which depend on the position of the row, ie. its index in
+// the second to last dimension. For the pair `i` of a row at position `s`:
+//     dst(x0) = src(x0) * cos(s, i) - src(x1) * sin(s, i)
+//     dst(x1) = src(x1) * cos(s, i) + src(x0) * sin(s, i)
+// where the pair is (2i, 2i + 1) for the interleaved algorithm and
+// (i, i + D / 2) for the half split one. The cosine and sine tables of shape
+// (S, D / 2) are either passed by the user or computed from the base `b` as
+// cos(s * b^(-2i / D)) and sin(s * b^(-2i / D)).
+struct rope_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::rope;
+
+    typedef rope_pd_t hint_class;
+
+    const rope_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC_0: return arg_usage_t::input;
+            case DNNL_ARG_SRC_1:
+            case DNNL_ARG_SRC_2:
+                return with_tables() ? arg_usage_t::input
+                                     : arg_usage_t::unused;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC_0: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(1);
+            case DNNL_ARG_SRC_2: return src_md(2);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return user_input ? &desc()->src_desc : &src_md_;
+            case 1: return with_tables() ? &desc()->cos_desc : &glob_zero_md;
+            case 2: return with_tables() ? &desc()->sin_desc : &glob_zero_md;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return with_tables() ? 3 : 1; }
+    int n_outputs() const override { return 1; }
+
+    int ndims() const { return src_md_.ndims; }
+    // The number of positions.
+    dim_t seq_len() const { return src_md_.dims[ndims() - 2]; }
+    // The number of elements rotated at each position.
+    dim_t head_size() const { return src_md_.dims[ndims() - 1]; }
+
+    bool with_tables() const { return desc_.cos_desc.ndims != 0; }
+    bool is_interleaved() const {
+        return desc_.alg_kind == alg_kind::rope_interleaved;
+    }
+
+protected:
+    rope_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t dst_md_;
+
+    rope_pd_t(const rope_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , src_md_(desc_.src_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+
+        return memory_desc_init_by_blocking_desc(
+                dst_md_, src_md_.format_desc.blocking);
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -36,6 +36,7 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(embedding_bag)
         CASE(gemm)
         CASE(group_normalization)
         CASE(inner_product)
@@ -48,9 +49,11 @@ status_t serialize_desc(
         CASE(reorder)
         CASE(resampling)
         CASE(rnn)
+        CASE(rope)
         CASE(shuffle)
         CASE(softmax)
         CASE(sum)
+        CASE(top_k)
         default: return status::invalid_arguments;
     }
 #undef CASE
@@ -176,6 +179,16 @@ void serialize_attr(
     sstream.write(&attr.deterministic_);
     // acc_mode
     sstream.write(&attr.acc_mode_);
+    // gating
+    if (!attr.gating_.has_default_values()) {
+        sstream.write(&attr.gating_.alg_);
+        sstream.write(&attr.gating_.alpha_);
+        sstream.write(&attr.gating_.beta_);
+    }
+    // src_dyn_quant
+    sstream.write(&attr.src_dyn_quant_.data_type_);
+    // dst_dyn_quant
+    sstream.write(&attr.dst_dyn_quant_.data_type_);
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -280,6 +293,7 @@ void serialize_desc(
     // Memory descriptors
     serialize_md(sstream, desc.src_desc[0]);
     serialize_md(sstream, desc.src_desc[1]);
+    serialize_md(sstream, desc.src_desc[2]);
     serialize_md(sstream, desc.dst_desc);
 }
 
@@ -327,6 +341,19 @@ void serialize_desc(
     sstream.write(&desc.beta);
 }
 
+// Embedding bag
+void serialize_desc(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.indices_desc);
+    serialize_md(sstream, desc.offsets_desc);
+    serialize_md(sstream, desc.dst_desc);
+}
+
 void serialize_desc(serialization_stream_t &sstream, const gemm_desc_t &desc) {
     // Kind
     sstream.write(&desc.primitive_kind);
@@ -542,6 +569,20 @@ void serialize_desc(serialization_stream_t &sstream, const rnn_desc_t &desc) {
     sstream.write(&desc.beta);
 }
 
+// RoPE
+void serialize_desc(serialization_stream_t &sstream, const rope_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.cos_desc);
+    serialize_md(sstream, desc.sin_desc);
+    serialize_md(sstream, desc.dst_desc);
+    // Base
+    sstream.write(&desc.base);
+}
+
 // Shuffle
 void serialize_desc(
         serialization_stream_t &sstream, const shuffle_desc_t &desc) {
@@ -586,6 +627,19 @@ void serialize_desc(serialization_stream_t &sstream, const sum_desc_t &desc) {
         serialize_md(sstream, *desc.src_mds[i]);
 }
 
+// Top-k
+void serialize_desc(serialization_stream_t &sstream, const top_k_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.indices_desc);
+    // Axis
+    sstream.write(&desc.axis);
+}
+
 } // namespace serialization
 } // namespace impl
 } // namespace dnnl
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2023 Intel Corporation
+* Copyright 2016-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -40,7 +40,10 @@ status_t dnnl_stream_create(
     bool args_ok = !utils::any_null(stream, engine);
     if (!args_ok) return invalid_arguments;
 
+    // The executions on CPU streams are timed by the library itself, which is
+    // not done for the SYCL ones.
     if (engine->kind() != engine_kind::gpu
+            && engine->runtime_kind() == runtime_kind::sycl
             && (flags & stream_flags::profiling)) {
         return status::unimplemented;
     }
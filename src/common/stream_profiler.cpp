@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2023 Intel Corporation
+* Copyright 2023-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -33,31 +33,26 @@ using namespace dnnl::impl::status;
 #endif
 
 INTERNAL_API_ATTRIBUTE(status_t) dnnl_reset_profiling(stream_t *stream) {
-    const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
-        return status::unimplemented;
-    }
-    return stream->reset_profiling();
+    const status_t status = stream->reset_profiling();
+    if (status == status::unimplemented)
+        VERROR(common, common, "stream does not support profiling");
+    return status;
 }
 
 INTERNAL_API_ATTRIBUTE(status_t)
 dnnl_query_profiling_data(stream_t *stream, profiling_data_kind_t data_kind,
         int *num_entries, uint64_t *data) {
-    const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
-        return status::unimplemented;
-    }
-    return stream->get_profiling_data(data_kind, num_entries, data);
+    const status_t status
+            = stream->get_profiling_data(data_kind, num_entries, data);
+    if (status == status::unimplemented)
+        VERROR(common, common, "stream does not support profiling");
+    return status;
 }
 
 extern "C" status_t DNNL_API dnnl_impl_notify_profiling_complete(
         stream_t *stream) {
-    const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
-        return status::unimplemented;
-    }
-    return stream->notify_profiling_complete();
+    const status_t status = stream->notify_profiling_complete();
+    if (status == status::unimplemented)
+        VERROR(common, common, "stream does not support profiling");
+    return status;
 }
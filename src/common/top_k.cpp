@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+
+#define VCHECK_TOP_K(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, top_k, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_TOP_K_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, top_k, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+
+status_t top_k_desc_init(top_k_desc_t *top_k_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *indices_desc, int axis) {
+
+    VCHECK_TOP_K(!any_null(src_desc, dst_desc, indices_desc), VERBOSE_NULL_ARG);
+    VCHECK_TOP_K(one_of(alg_kind, reduction_max, reduction_min),
+            VERBOSE_BAD_ALGORITHM);
+
+    const int ndims = src_desc->ndims;
+    VCHECK_TOP_K(ndims >= 1, VERBOSE_BAD_NDIMS, "src", ndims);
+    VCHECK_TOP_K(0 <= axis && axis < ndims, VERBOSE_BAD_AXIS);
+    VCHECK_TOP_K(dst_desc->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS, "src",
+            "dst");
+    VCHECK_TOP_K(indices_desc->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS,
+            "src", "indices");
+    for (int d = 0; d < ndims; d++) {
+        VCHECK_TOP_K(dst_desc->dims[d] == indices_desc->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "dst", d, "indices", d);
+        if (d == axis) continue;
+        VCHECK_TOP_K(src_desc->dims[d] == dst_desc->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "src", d, "dst", d);
+    }
+
+    // `k` is the size of the axis in dst.
+    const dim_t k = dst_desc->dims[axis];
+    VCHECK_TOP_K(1 <= k && k <= src_desc->dims[axis], VERBOSE_BAD_DIM, "dst",
+            axis);
+    VCHECK_TOP_K(indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "indices");
+
+    VCHECK_TOP_K(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_TOP_K(one_of(dst_desc->format_kind, format_kind::blocked,
+                         format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VCHECK_TOP_K(one_of(indices_desc->format_kind, format_kind::blocked,
+                         format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "indices");
+
+    const bool runtime_dims_or_strides
+            = memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(indices_desc).has_runtime_dims_or_strides();
+    VCHECK_TOP_K_UNIMPL(
+            !runtime_dims_or_strides, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    auto tkd = top_k_desc_t();
+    tkd.primitive_kind = primitive_kind::top_k;
+    tkd.alg_kind = alg_kind;
+
+    tkd.src_desc = *src_desc;
+    tkd.dst_desc = *dst_desc;
+    tkd.indices_desc = *indices_desc;
+    tkd.axis = axis;
+
+    (*top_k_desc) = tkd;
+    return success;
+}
+
+status_t top_k_attr_check(const top_k_desc_t &desc, const engine_t *engine,
+        const primitive_attr_t *attr) {
+    if (attr == nullptr) return status::success;
+
+    // No attributes are supported.
+    VCHECK_TOP_K_UNIMPL(attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_top_k_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *indices_desc,
+        int axis, const primitive_attr_t *attr) {
+
+    auto top_k_desc = top_k_desc_t();
+    CHECK(top_k_desc_init(
+            &top_k_desc, alg_kind, src_desc, dst_desc, indices_desc, axis));
+    CHECK(top_k_attr_check(top_k_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&top_k_desc, nullptr, attr);
+}
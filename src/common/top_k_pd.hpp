@@ -0,0 +1,142 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOP_K_PD_HPP
+#define COMMON_TOP_K_PD_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_TOP_K(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, top_k, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+#define VDISPATCH_TOP_K_SC(f, msg, ...) \
+    VCHECK(primitive, create, dispatch, top_k, (f), "%s," msg, \
+            this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t top_k_desc_init(top_k_desc_t *top_k_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *indices_desc, int axis);
+
+// The top-k primitive selects the `k` largest (reduction_max) or smallest
+// (reduction_min) elements of src along `axis`, where `k` is the size of the
+// axis in dst. The values are written to dst and their positions along the
+// axis to indices. The selected elements are sorted, the best one first, and
+// the equal elements are ordered by their positions.
+struct top_k_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::top_k;
+
+    typedef top_k_pd_t hint_class;
+
+    const top_k_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            case query::axis_s32: *(int *)result = desc()->axis; break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return arg_usage_t::input;
+            case DNNL_ARG_DST_0:
+            case DNNL_ARG_DST_1: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_DST_0: return dst_md(0, user_input);
+            case DNNL_ARG_DST_1: return dst_md(1, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return &desc()->src_desc;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return user_input ? &desc()->dst_desc : &dst_md_;
+            case 1: return user_input ? &desc()->indices_desc : &indices_md_;
+            default: return &glob_zero_md;
+        }
+    }
+
+    int n_inputs() const override { return 1; }
+    int n_outputs() const override { return 2; }
+
+    int ndims() const { return desc_.src_desc.ndims; }
+    int axis() const { return desc_.axis; }
+    // The number of elements the top ones are selected from.
+    dim_t axis_size() const { return desc_.src_desc.dims[axis()]; }
+    // The number of selected elements.
+    dim_t k() const { return desc_.dst_desc.dims[axis()]; }
+    // The number of rows, ie. the product of all dimensions but the axis.
+    dim_t nrows() const {
+        return utils::array_product(desc_.src_desc.dims, ndims())
+                / axis_size();
+    }
+    bool is_max() const { return desc_.alg_kind == alg_kind::reduction_max; }
+
+protected:
+    top_k_desc_t desc_;
+
+    memory_desc_t dst_md_;
+    memory_desc_t indices_md_;
+
+    top_k_pd_t(const top_k_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , dst_md_(desc_.dst_desc)
+        , indices_md_(desc_.indices_desc) {}
+
+    status_t set_default_params() {
+        // The outputs default to the dense plain layout.
+        if (dst_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_strides(dst_md_, nullptr));
+        if (indices_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_strides(indices_md_, nullptr));
+        return status::success;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
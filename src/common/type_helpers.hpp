@@ -482,6 +482,7 @@ inline bool operator==(const binary_desc_t &lhs, const binary_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(alg_kind)
             && COMPARE_DESC_MEMBERS(src_desc[0])
             && COMPARE_DESC_MEMBERS(src_desc[1])
+            && COMPARE_DESC_MEMBERS(src_desc[2])
             && COMPARE_DESC_MEMBERS(dst_desc);
     return ret;
 }
@@ -536,6 +537,17 @@ inline bool operator==(const eltwise_desc_t &lhs, const eltwise_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(
+        const embedding_bag_desc_t &lhs, const embedding_bag_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(offsets_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
 inline bool operator==(const gemm_desc_t &lhs, const gemm_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(a_desc)
@@ -719,6 +731,17 @@ inline bool operator==(const rnn_desc_t &lhs, const rnn_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const rope_desc_t &lhs, const rope_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(cos_desc)
+            && COMPARE_DESC_MEMBERS(sin_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_FLOAT_DESC_MEMBERS(base);
+    return ret;
+}
+
 inline bool operator==(const shuffle_desc_t &lhs, const shuffle_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(prop_kind)
@@ -762,6 +785,16 @@ inline bool operator==(const sum_desc_t &lhs, const sum_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const top_k_desc_t &lhs, const top_k_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(axis);
+    return ret;
+}
+
 inline bool operator==(const zero_pad_desc_t &lhs, const zero_pad_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind);
     return ret;
@@ -1067,6 +1100,7 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
         CASE_OP_DESC(convolution);
         CASE_OP_DESC(deconvolution);
         CASE_OP_DESC(eltwise);
+        CASE_OP_DESC(embedding_bag);
         CASE_OP_DESC(gemm);
         CASE_OP_DESC(group_normalization);
         CASE_OP_DESC(inner_product);
@@ -1078,8 +1112,10 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
         CASE_OP_DESC(reduction);
         CASE_OP_DESC(resampling);
         CASE_OP_DESC(rnn);
+        CASE_OP_DESC(rope);
         CASE_OP_DESC(shuffle);
         CASE_OP_DESC(softmax);
+        CASE_OP_DESC(top_k);
 
         // Internal descs
         CASE_OP_DESC(zero_pad);
@@ -40,6 +40,7 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "embedding_bag_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
@@ -52,9 +53,11 @@
 #include "reorder_pd.hpp"
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
+#include "rope_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
+#include "top_k_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "common/dnnl_thread.hpp"
@@ -217,6 +220,9 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
                 REGEX_SEARCH(k, softmax, regexp, filter_status);
                 REGEX_SEARCH(k, layer_normalization, regexp, filter_status);
                 REGEX_SEARCH(k, group_normalization, regexp, filter_status);
+                REGEX_SEARCH(k, embedding_bag, regexp, filter_status);
+                REGEX_SEARCH(k, rope, regexp, filter_status);
+                REGEX_SEARCH(k, top_k, regexp, filter_status);
                 REGEX_SEARCH(k, graph, regexp, filter_status);
                 REGEX_SEARCH(k, gemm_api, regexp, filter_status);
 #undef REGEX_SEARCH
@@ -363,6 +369,7 @@ std::string normalization_flags2str(unsigned flags) {
     if (flags & normalization_flags::use_shift) s += "H";
     if (flags & normalization_flags::fuse_norm_relu) s += "R";
     if (flags & normalization_flags::fuse_norm_add_relu) s += "A";
+    if (flags & normalization_flags::rms_norm) s += "M";
     return s;
 }
 
@@ -780,6 +787,21 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
            << rnn_qp.shift_ << ";";
     }
 
+    const gating_t &gt = attr->gating_;
+    if (!gt.has_default_values()) {
+        ss << field_delim() << "attr-gating:" << gt.alg_;
+        if (gt.alpha_ != 0.f || gt.beta_ != 0.f) ss << ":" << gt.alpha_;
+        if (gt.beta_ != 0.f) ss << ":" << gt.beta_;
+    }
+
+    const dyn_quantization_t &dq = attr->src_dyn_quant_;
+    if (!dq.has_default_values())
+        ss << field_delim() << "attr-src-dyn-quant:" << dq.data_type_;
+
+    const dyn_quantization_t &ddq = attr->dst_dyn_quant_;
+    if (!ddq.has_default_values())
+        ss << field_delim() << "attr-dst-dyn-quant:" << ddq.data_type_;
+
     return ss;
 }
 
@@ -817,11 +839,17 @@ std::string init_info_binary(const engine_t *e, const pd_t *pd) {
 
     ss << "src_" << md2fmt_str(src0_md, pd->invariant_src_user_format_kind(0));
     ss << " src_" << md2fmt_str(src1_md, pd->invariant_src_user_format_kind(1));
+    if (pd->is_ternary_op()) {
+        auto src2_md = pd->invariant_src_md(2);
+        ss << " src_"
+           << md2fmt_str(src2_md, pd->invariant_src_user_format_kind(2));
+    }
     ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
 
     ss << "," << pd->attr() << ",";
     ss << "alg:" << pd->desc()->alg_kind << ",";
     ss << md2dim_str(src0_md) << ":" << md2dim_str(src1_md);
+    if (pd->is_ternary_op()) ss << ":" << md2dim_str(pd->invariant_src_md(2));
 
     return ss.str();
 }
@@ -1224,6 +1252,80 @@ std::string init_info_reduction(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_embedding_bag(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto indices_md = pd->invariant_src_md(1);
+    auto offsets_md = pd->invariant_src_md(2);
+    auto dst_md = pd->invariant_dst_md();
+
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    ss << " indices_" << md2fmt_str(indices_md, format_kind::undef);
+    ss << " offsets_" << md2fmt_str(offsets_md, format_kind::undef);
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(indices_md) << ":"
+       << md2dim_str(offsets_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_rope(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto cos_md = pd->invariant_src_md(1);
+    auto sin_md = pd->invariant_src_md(2);
+    auto dst_md = pd->invariant_dst_md();
+
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    if (pd->with_tables()) {
+        ss << " cos_" << md2fmt_str(cos_md, format_kind::undef);
+        ss << " sin_" << md2fmt_str(sin_md, format_kind::undef);
+    }
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind;
+    if (!pd->with_tables()) ss << " base:" << pd->desc()->base;
+    ss << "," << md2dim_str(src_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_top_k(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto dst_md = pd->invariant_dst_md();
+    auto indices_md = pd->dst_md(1);
+
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+    ss << " indices_"
+       << md2fmt_str(indices_md,
+                  pd->invariant_dst_user_format_kind(DNNL_ARG_DST_1));
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << " axis:" << pd->axis()
+       << " k:" << pd->k() << ",";
+    ss << md2dim_str(src_md);
+
+    return ss.str();
+}
+
 std::string mds2str_reorder(const memory_desc_t *src_md,
         format_kind_t src_user_format_kind, const memory_desc_t *dst_md,
         format_kind_t dst_user_format_kind) {
@@ -1466,6 +1568,7 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::convolution:
         case primitive_kind::deconvolution:
         case primitive_kind::eltwise:
+        case primitive_kind::embedding_bag:
         case primitive_kind::inner_product:
         case primitive_kind::layer_normalization:
         case primitive_kind::lrn:
@@ -1474,9 +1577,13 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::reduction:
         case primitive_kind::resampling:
         case primitive_kind::rnn:
+        case primitive_kind::rope:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::sum:
+        case primitive_kind::top_k:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1498,6 +1605,7 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::convolution:
         case primitive_kind::deconvolution:
         case primitive_kind::eltwise:
+        case primitive_kind::embedding_bag:
         case primitive_kind::inner_product:
         case primitive_kind::layer_normalization:
         case primitive_kind::lrn:
@@ -1506,9 +1614,13 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::reduction:
         case primitive_kind::resampling:
         case primitive_kind::rnn:
+        case primitive_kind::rope:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::sum:
+        case primitive_kind::top_k:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1531,6 +1643,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(gemm);
             CASE(group_normalization);
             CASE(inner_product);
@@ -1543,9 +1656,11 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(reorder);
             CASE(resampling);
             CASE(rnn);
+            CASE(rope);
             CASE(shuffle);
             CASE(softmax);
             CASE(sum);
+            CASE(top_k);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
               break;
@@ -187,8 +187,11 @@ struct component_t {
         softmax = 1 << 19,
         layer_normalization = 1 << 20,
         group_normalization = 1 << 21,
-        graph = 1 << 22,
-        gemm_api = 1 << 23,
+        embedding_bag = 1 << 22,
+        rope = 1 << 23,
+        top_k = 1 << 24,
+        graph = 1 << 25,
+        gemm_api = 1 << 26,
         all = (uint32_t)-1,
     };
 };
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2023 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 * Copyright 2022-2023 FUJITSU LIMITED
 * Copyright 2022 Arm Ltd. and affiliates
 *
@@ -98,6 +98,8 @@ static bool data_format_supported(
 status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
     using sm = primitive_attr_t::skip_mask_t;
 
+    VDISPATCH_BINARY(!is_ternary_op(), VERBOSE_BAD_ALGORITHM);
+
     conf_.dst_type = dst_md()->data_type;
     conf_.src0_type = src_md(0)->data_type;
     conf_.src1_type = src_md(1)->data_type;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2022 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 * Copyright 2022 Arm Ltd. and affiliates
 * Copyright 2022 FUJITSU LIMITED
 *
@@ -22,6 +22,7 @@
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_binary.hpp"
+#include "cpu/x64/jit_uni_select.hpp"
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64
 #include "cpu/aarch64/jit_uni_binary.hpp"
@@ -41,6 +42,7 @@ using namespace dnnl::impl::data_type;
 // clang-format off
 constexpr impl_list_item_t impl_list[] = REG_BINARY_P({
         CPU_INSTANCE_X64(jit_uni_binary_t)
+        CPU_INSTANCE_X64(jit_uni_select_t)
         CPU_INSTANCE_AARCH64(jit_uni_binary_t)
         CPU_INSTANCE_AARCH64_ACL(acl_binary_t)
         CPU_INSTANCE(ref_binary_t)
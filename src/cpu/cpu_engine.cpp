@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2022 Intel Corporation
+* Copyright 2016-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 #include "common/type_helpers.hpp"
 
 #include "cpu/cpu_engine.hpp"
+#include "cpu/cpu_mapped_memory_storage.hpp"
 #include "cpu/cpu_memory_storage.hpp"
 #include "cpu/cpu_stream.hpp"
 
@@ -40,6 +41,19 @@ status_t cpu_engine_t::create_memory_storage(
     return status::success;
 }
 
+status_t cpu_engine_t::create_mapped_memory_storage(memory_storage_t **storage,
+        const char *path, size_t offset, size_t size) {
+    auto _storage = new cpu_mapped_memory_storage_t(this);
+    if (_storage == nullptr) return status::out_of_memory;
+    status_t status = _storage->init_mapping(path, offset, size);
+    if (status != status::success) {
+        delete _storage;
+        return status;
+    }
+    *storage = _storage;
+    return status::success;
+}
+
 status_t cpu_engine_t::create_stream(stream_t **stream, unsigned flags) {
     return safe_ptr_assign(*stream, new cpu_stream_t(this, flags));
 }
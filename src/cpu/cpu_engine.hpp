@@ -58,6 +58,7 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(embedding_bag);
 DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
@@ -68,8 +69,10 @@ DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(rope);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
+DECLARE_IMPL_LIST(top_k);
 
 #undef DECLARE_IMPL_LIST
 
@@ -94,6 +97,7 @@ public:
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
@@ -104,8 +108,10 @@ public:
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(rope);
             CASE(shuffle);
             CASE(softmax);
+            CASE(top_k);
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -124,6 +130,9 @@ public:
     status_t create_memory_storage(memory_storage_t **storage, unsigned flags,
             size_t size, void *handle) override;
 
+    status_t create_mapped_memory_storage(memory_storage_t **storage,
+            const char *path, size_t offset, size_t size) override;
+
     status_t create_stream(stream_t **stream, unsigned flags) override;
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
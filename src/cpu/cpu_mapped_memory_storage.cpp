@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if defined __unix__ || defined __APPLE__ || defined __FreeBSD__ \
+        || defined __Fuchsia__
+#define DNNL_WITH_MMAP 1
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "common/memory_desc_wrapper.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/cpu_mapped_memory_storage.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+#ifdef DNNL_WITH_MMAP
+
+cpu_mapped_memory_storage_t::~cpu_mapped_memory_storage_t() {
+    if (map_ptr_) munmap(map_ptr_, map_size_);
+}
+
+status_t cpu_mapped_memory_storage_t::init_mapping(
+        const char *path, size_t offset, size_t size) {
+    // The data is aligned as the data of the memory objects allocated by the
+    // library, since the mapping itself starts at a page boundary.
+    const size_t align = platform::get_cache_line_size();
+    VCHECK_MEMORY(offset % align == 0, status::invalid_arguments,
+            "offset %zu is not a multiple of %zu bytes", offset, align);
+
+    const long page_size = sysconf(_SC_PAGESIZE);
+    VCHECK_MEMORY(page_size > 0, status::runtime_error,
+            "could not query the page size");
+
+    const int fd = open(path, O_RDONLY);
+    VCHECK_MEMORY(fd >= 0, status::invalid_arguments,
+            "could not open file %s", path);
+
+    // The sizes are compared so that `offset + size` can't overflow.
+    struct stat st;
+    const bool size_ok = fstat(fd, &st) == 0
+            && size <= static_cast<size_t>(st.st_size)
+            && offset <= static_cast<size_t>(st.st_size) - size;
+    if (!size_ok) close(fd);
+    VCHECK_MEMORY(size_ok, status::invalid_arguments,
+            "file %s is smaller than the memory object", path);
+
+    // The mapping starts at a page boundary, and the data handle points to
+    // the requested offset inside the first page.
+    const size_t map_offset
+            = utils::rnd_dn(offset, static_cast<size_t>(page_size));
+    const size_t map_size = size + (offset - map_offset);
+    // The mapping of zero bytes is not allowed.
+    void *map_ptr = mmap(nullptr, nstl::max(map_size, size_t(1)),
+            PROT_READ | PROT_WRITE, MAP_PRIVATE, fd,
+            static_cast<off_t>(map_offset));
+    // The mapping keeps a reference to the file.
+    close(fd);
+    VCHECK_MEMORY(map_ptr != MAP_FAILED, status::out_of_memory,
+            "could not map file %s", path);
+
+    map_ptr_ = map_ptr;
+    map_size_ = nstl::max(map_size, size_t(1));
+
+    // The weights are usually read once, from the beginning to the end of
+    // each thread chunk, so the read-ahead is increased and the reading is
+    // started in the background right away. Either is only an advice.
+    madvise(map_ptr_, map_size_, MADV_SEQUENTIAL);
+    madvise(map_ptr_, map_size_, MADV_WILLNEED);
+
+    void *handle = static_cast<char *>(map_ptr_) + (offset - map_offset);
+    return init(memory_flags_t::use_runtime_ptr, size, handle);
+}
+
+#else
+
+cpu_mapped_memory_storage_t::~cpu_mapped_memory_storage_t() = default;
+
+status_t cpu_mapped_memory_storage_t::init_mapping(
+        const char *path, size_t offset, size_t size) {
+    UNUSED(path);
+    UNUSED(offset);
+    UNUSED(size);
+    return status::unimplemented;
+}
+
+#endif
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,56 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_MAPPED_MEMORY_STORAGE_HPP
+#define CPU_CPU_MAPPED_MEMORY_STORAGE_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_memory_storage.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Memory storage over a part of a file mapped into the address space of the
+// process. The mapping is private, so the pages stay in the page cache and
+// are shared with other processes mapping the same file until they are
+// written to. The pages are read on the first access, and the kernel is
+// advised to read the file ahead sequentially.
+class cpu_mapped_memory_storage_t : public cpu_memory_storage_t {
+public:
+    cpu_mapped_memory_storage_t(engine_t *engine)
+        : cpu_memory_storage_t(engine) {}
+
+    ~cpu_mapped_memory_storage_t() override;
+
+    // Maps `size` bytes of the file starting at `offset`, which must be a
+    // multiple of the cache line size, but does not need to be page aligned.
+    status_t init_mapping(const char *path, size_t offset, size_t size);
+
+private:
+    void *map_ptr_ = nullptr;
+    size_t map_size_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_mapped_memory_storage_t);
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
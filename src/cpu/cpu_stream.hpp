@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2020 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -26,13 +26,19 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream_profiler.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
 struct cpu_stream_t : public stream_t {
-    cpu_stream_t(engine_t *engine, unsigned flags) : stream_t(engine, flags) {}
+    cpu_stream_t(engine_t *engine, unsigned flags) : stream_t(engine, flags) {
+        if (is_profiling_enabled())
+            profiler_ = utils::make_unique<cpu_stream_profiler_t>();
+    }
     virtual ~cpu_stream_t() = default;
 
     dnnl::impl::status_t wait() override {
@@ -40,6 +46,40 @@ struct cpu_stream_t : public stream_t {
         return dnnl::impl::status::success;
     }
 
+    dnnl::impl::status_t enqueue_primitive(
+            const primitive_iface_t *primitive_iface,
+            exec_ctx_t &ctx) override {
+        if (!is_profiling_enabled())
+            return stream_t::enqueue_primitive(primitive_iface, ctx);
+
+        // CPU execution is synchronous, so the primitive is complete when
+        // the call returns.
+        const uint64_t start_nsec = cpu_stream_profiler_t::now_nsec();
+        const status_t status
+                = stream_t::enqueue_primitive(primitive_iface, ctx);
+        profiler_->register_execution(
+                start_nsec, cpu_stream_profiler_t::now_nsec());
+        return status;
+    }
+
+    dnnl::impl::status_t reset_profiling() override {
+        if (!is_profiling_enabled()) return status::invalid_arguments;
+        profiler_->reset();
+        return status::success;
+    }
+
+    dnnl::impl::status_t get_profiling_data(
+            dnnl::impl::profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const override {
+        if (!is_profiling_enabled()) return status::invalid_arguments;
+        return profiler_->get_info(data_kind, num_entries, data);
+    }
+
+    dnnl::impl::status_t notify_profiling_complete() const override {
+        if (!is_profiling_enabled()) return status::invalid_arguments;
+        return status::success;
+    }
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     cpu_stream_t(engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
@@ -55,6 +95,9 @@ struct cpu_stream_t : public stream_t {
         threadpool_utils::deactivate_threadpool();
     }
 #endif
+
+private:
+    std::unique_ptr<cpu_stream_profiler_t> profiler_;
 };
 
 } // namespace cpu
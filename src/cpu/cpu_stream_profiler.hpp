@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_PROFILER_HPP
+#define CPU_CPU_STREAM_PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/nstl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Records the start and the end of the primitive executions on a CPU stream.
+//
+// The entries are kept in a ring buffer of a fixed capacity, so the memory
+// used by the profiler does not grow with the number of executions and only
+// the latest `capacity` executions are reported. A slot is claimed with an
+// atomic increment, so that the executions submitted to the stream from
+// several threads are recorded without a lock.
+struct cpu_stream_profiler_t {
+    static constexpr size_t capacity = 4096;
+
+    cpu_stream_profiler_t() : entries_(capacity), nexecs_(0) {}
+
+    // The timestamps are taken from a steady clock in nanoseconds, which is
+    // the unit of the `time` data kind.
+    static uint64_t now_nsec() {
+        using namespace std::chrono;
+        return (uint64_t)duration_cast<nanoseconds>(
+                steady_clock::now().time_since_epoch())
+                .count();
+    }
+
+    void register_execution(uint64_t start_nsec, uint64_t end_nsec) {
+        const uint64_t idx = nexecs_.fetch_add(1, std::memory_order_relaxed);
+        entries_[idx % capacity] = {start_nsec, end_nsec};
+    }
+
+    void reset() { nexecs_.store(0, std::memory_order_relaxed); }
+
+    status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const {
+        if (!num_entries) return status::invalid_arguments;
+
+        const uint64_t nexecs = nexecs_.load(std::memory_order_relaxed);
+        const uint64_t count = nstl::min<uint64_t>(nexecs, capacity);
+        if (!data) {
+            *num_entries = (int)count;
+            return status::success;
+        }
+        if (data_kind != profiling_data_kind::time)
+            return status::unimplemented;
+
+        // The oldest execution that was not overwritten goes first.
+        for (uint64_t i = 0; i < count; i++) {
+            const auto &e = entries_[(nexecs - count + i) % capacity];
+            data[i] = e.end_nsec - e.start_nsec;
+        }
+        return status::success;
+    }
+
+private:
+    struct entry_t {
+        uint64_t start_nsec;
+        uint64_t end_nsec;
+    };
+
+    std::vector<entry_t> entries_;
+    std::atomic<uint64_t> nexecs_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
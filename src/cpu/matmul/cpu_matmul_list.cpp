@@ -26,6 +26,8 @@
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/matmul/brgemm_dyn_quant_matmul.hpp"
+#include "cpu/x64/matmul/brgemm_gated_matmul.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
@@ -77,6 +79,8 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AARCH64_ACL(acl_lowp_matmul_t)
         CPU_INSTANCE_AARCH64_ACL(acl_matmul_t) 
         CPU_INSTANCE_AARCH64(brgemm_matmul_t<sve_256>)       
+        CPU_INSTANCE_AVX2(brgemm_gated_matmul_t)
+        CPU_INSTANCE_AVX512(brgemm_dyn_quant_matmul_t)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx_fp16>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx>)
         CPU_INSTANCE_AVX512(brgemm_matmul_t<avx512_core_fp16>)
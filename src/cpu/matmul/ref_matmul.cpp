@@ -156,6 +156,47 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
         return acc;
     };
 
+    // dynamic quantization section
+    const bool with_src_dyn_quant = pd()->with_src_dyn_quant();
+    // The source row is quantized with the scale of its maximum absolute
+    // value and the product is accumulated in integers.
+    auto ker_dyn_quant = [&](const dims_t dst_dims_idx, dim_t m, dim_t n) {
+        dims_t src_dims_idx, weights_dims_idx;
+        utils::copy_dims_with_mask(src_dims_idx, dst_dims_idx, ndims, src_mask);
+        utils::copy_dims_with_mask(
+                weights_dims_idx, dst_dims_idx, ndims, wei_mask);
+        src_dims_idx[ndims - 2] = m;
+        weights_dims_idx[ndims - 1] = n;
+        auto &src_k_dim = src_dims_idx[ndims - 1];
+        auto &wei_k_dim = weights_dims_idx[ndims - 2];
+
+        float amax = FLT_MIN;
+        for (dim_t k = 0; k < K; ++k) {
+            src_k_dim = k;
+            const float s = io::load_float_value(
+                    src_d.data_type(), src, src_d.off_v(src_dims_idx));
+            amax = nstl::max(amax, nstl::abs(s));
+        }
+        const float qscale = 127.f / amax;
+
+        int acc = 0;
+        for (dim_t k = 0; k < K; ++k) {
+            src_k_dim = k;
+            wei_k_dim = k;
+            const float s = io::load_float_value(
+                    src_d.data_type(), src, src_d.off_v(src_dims_idx));
+            const int q = q10n::saturate_and_round<int8_t>(s * qscale);
+            const int w = io::load_int_value(weights_d.data_type(), weights,
+                    weights_d.off_v(weights_dims_idx));
+            acc += q * w;
+        }
+        return (float)acc * (amax / 127.f);
+    };
+
+    // gating section
+    const auto &gating = pd()->attr()->gating_;
+    const bool with_gating = pd()->with_gating();
+
     // bias section
     auto ker_bias = [&](const dims_t &dst_dims_idx) -> float {
         dims_t bia_dims_idx;
@@ -172,7 +213,13 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
         // account for M, N dims for index calculations
         const size_t l_offset = mb * M * N + m * N + n;
         utils::l_dims_by_l_offset(dst_dims_idx, l_offset, dst_d.dims(), ndims);
-        float d = ker(dst_dims_idx, m, n);
+        float d = with_src_dyn_quant ? ker_dyn_quant(dst_dims_idx, m, n)
+                                     : ker(dst_dims_idx, m, n);
+        // The up projection follows the gate one in the weights.
+        if (with_gating)
+            d = compute_eltwise_scalar_fwd(
+                        gating.alg_, d, gating.alpha_, gating.beta_)
+                    * ker(dst_dims_idx, m, N + n);
         if (with_src_scales) d *= src_scales[0];
         if (with_wei_scales && !with_wei_decompression)
             d *= wei_scales[wei_scale_stride_n * n];
@@ -58,7 +58,8 @@ struct ref_matmul_t : public primitive_t {
                             || utils::one_of(wei_type, u8, s8, u4, s4))
                     /* int8 weights decompression support */
                     && IMPLICATION(utils::one_of(wei_type, u8, s8),
-                            attr_.mayiconvert(wei_type, src_type))
+                            attr_.mayiconvert(wei_type, src_type)
+                                    || with_src_dyn_quant())
                     && IMPLICATION(src_type == f32, dst_type == f32)
                     && IMPLICATION(src_type == bf16,
                             utils::one_of(dst_type, f32, bf16))
@@ -84,7 +85,8 @@ struct ref_matmul_t : public primitive_t {
                                     | smask_t::zero_points_runtime_data_type
                                     | smask_t::zero_points_runtime_groups
                                     | smask_t::post_ops | smask_t::sum_dt
-                                    | smask_t::fpmath_mode,
+                                    | smask_t::fpmath_mode | smask_t::gating
+                                    | smask_t::src_dyn_quant,
                             dst_type)
                     && attr_.post_ops_.check_sum_consistency(dst_type,
                             /* is_int8 */ false)
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2022 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -37,6 +37,7 @@ namespace cpu {
 status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
     const auto src0 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_0);
     const auto src1 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+    const auto src2 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_2);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
 
     const float *scales[2];
@@ -45,6 +46,7 @@ status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
 
     const memory_desc_wrapper src0_d(pd()->src_md(0));
     const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const memory_desc_wrapper src2_d(pd()->src_md(2));
     const memory_desc_wrapper dst_d(pd()->dst_md());
 
     const auto src0_dt = src0_d.data_type();
@@ -52,6 +54,7 @@ status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
     const auto dst_dt = dst_d.data_type();
 
     const auto alg = pd()->desc()->alg_kind;
+    const bool is_ternary_op = pd()->is_ternary_op();
 
     const auto nelems = dst_d.nelems();
     const auto ndims = pd()->ndims();
@@ -106,7 +109,20 @@ status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
         x_f *= scales[0][0];
         y_f *= scales[1][0];
 
-        float acc = compute_binary_scalar(alg, x_f, y_f);
+        float acc = 0.f;
+        if (is_ternary_op) {
+            dims_t dims_src2;
+            utils::l_dims_by_l_offset(dims_src2, i, dst_d.dims(), ndims);
+            int mask_src2
+                    = utils::get_dims_mask(dst_d.dims(), src2_d.dims(), ndims);
+            utils::apply_mask_on_dims(dims_src2, ndims, mask_src2);
+            const auto off_cond = src2_d.off_v(dims_src2);
+            const bool cond = io::load_float_value(
+                                      src2_d.data_type(), src2, off_cond)
+                    != 0.f;
+            acc = cond ? x_f : y_f;
+        } else
+            acc = compute_binary_scalar(alg, x_f, y_f);
 
         if (has_postops) {
             ref_post_ops_t::args_t args;
@@ -56,12 +56,13 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
     const float eps = pd()->desc()->layer_norm_epsilon;
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
+    const bool skip_mean = pd()->skip_mean();
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
         if (calculate_stats && save_stats) {
             for (dim_t n = 0; n < N; n++) {
-                mean[n] = 0;
+                if (!skip_mean) mean[n] = 0;
                 variance[n] = 0;
             }
         }
@@ -70,16 +71,19 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
 
     parallel_nd(N, [&](dim_t n) {
         const size_t s_off = stat_d.off_l(n);
-        auto v_mean = calculate_stats ? 0 : mean[s_off];
-        auto v_variance = calculate_stats ? 0 : variance[s_off];
+        float v_mean = calculate_stats || skip_mean ? 0 : mean[s_off];
+        float v_variance = calculate_stats ? 0 : variance[s_off];
 
         if (calculate_stats) {
-            for (dim_t c = 0; c < C; ++c) {
-                const auto s_off = src_d.off_l(n * C + c);
-                float s = io::load_float_value(src_d.data_type(), src, s_off);
-                v_mean += s;
+            if (!skip_mean) {
+                for (dim_t c = 0; c < C; ++c) {
+                    const auto s_off = src_d.off_l(n * C + c);
+                    float s = io::load_float_value(
+                            src_d.data_type(), src, s_off);
+                    v_mean += s;
+                }
+                v_mean /= C;
             }
-            v_mean /= C;
 
             for (dim_t c = 0; c < C; ++c) {
                 const auto s_off = src_d.off_l(n * C + c);
@@ -119,7 +123,7 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
 
         if (calculate_stats) {
             if (save_stats) {
-                mean[s_off] = v_mean;
+                if (!skip_mean) mean[s_off] = v_mean;
                 variance[s_off] = v_variance;
             }
         }
@@ -180,6 +184,7 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
 
     const float eps = pd()->desc()->layer_norm_epsilon;
     const bool calculate_diff_stats = !pd()->use_global_stats();
+    const bool skip_mean = pd()->skip_mean();
 
     if (diff_scale || diff_shift) {
         parallel_nd(C, [&](dim_t c) {
@@ -190,11 +195,12 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
                 const auto src_off = src_d.off_l(n * C + c);
                 const auto diff_dst_off = diff_dst_d.off_l(n * C + c);
                 const auto stat_off = stat_d.off_l(n);
+                const float v_mean = skip_mean ? 0.f : mean[stat_off];
                 float inv_sqrt_variance = 1.f / sqrtf(variance[stat_off] + eps);
                 float s = io::load_float_value(src_d.data_type(), src, src_off);
                 float dd = io::load_float_value(
                         diff_dst_d.data_type(), diff_dst, diff_dst_off);
-                diff_gamma += (s - mean[stat_off]) * dd * inv_sqrt_variance;
+                diff_gamma += (s - v_mean) * dd * inv_sqrt_variance;
                 diff_beta += dd;
             }
 
@@ -209,6 +215,7 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
 
     parallel_nd(N, [&](dim_t n) {
         const size_t s_off = stat_d.off_l(n);
+        const float v_mean = skip_mean ? 0.f : mean[s_off];
         float inv_sqrt_variance = 1.f / sqrtf(variance[s_off] + eps);
         float dd_gamma = 0.f;
         float dd_gamma_x = 0.f;
@@ -224,7 +231,7 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
                 float dd = io::load_float_value(
                         diff_dst_d.data_type(), diff_dst, diff_dst_off);
                 dd_gamma += dd * gamma;
-                dd_gamma_x += dd * gamma * (s - mean[s_off]);
+                dd_gamma_x += dd * gamma * (s - v_mean);
             }
             dd_gamma_x *= inv_sqrt_variance;
         }
@@ -241,8 +248,9 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
             float d_src = dd * gamma;
             if (calculate_diff_stats) {
                 float s = io::load_float_value(src_d.data_type(), src, src_off);
-                d_src -= dd_gamma / C;
-                d_src -= (s - mean[s_off]) * dd_gamma_x * inv_sqrt_variance / C;
+                // the mean doesn't depend on src with RMS normalization
+                if (!skip_mean) d_src -= dd_gamma / C;
+                d_src -= (s - v_mean) * dd_gamma_x * inv_sqrt_variance / C;
             }
             d_src *= inv_sqrt_variance;
             io::store_float_value(
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2023 Intel Corporation
+* Copyright 2023-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -83,7 +83,8 @@ struct simple_sparse_reorder_impl<SIMPLE_SPARSE_REORDER_TEMPL_CALL,
         return input_d.is_blocking_desc() && output_d.is_sparse_desc()
                 && output_d.sparse_desc().encoding == sparse_encoding::packed
                 && output_d.blocking_desc().inner_nblks > 0
-                && output_d.blk_size() % 64 == 0;
+                && output_d.blk_size() % 64 == 0
+                && attr->dst_dyn_quant_.has_default_values();
     }
 
     static size_t get_scratchpad_size(const memory_desc_wrapper &input_d,
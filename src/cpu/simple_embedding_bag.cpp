@@ -0,0 +1,279 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/simple_embedding_bag.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace data_type;
+
+namespace {
+
+// The accumulator is kept on the stack, so the embedding dimension is
+// processed in chunks.
+constexpr dim_t chunk_size = 256;
+// The number of indices to look ahead when prefetching the rows.
+constexpr dim_t prefetch_distance = 4;
+
+bool is_row_major(const memory_desc_wrapper &mdw) {
+    if (!mdw.is_blocking_desc()) return false;
+    const auto &bd = mdw.blocking_desc();
+    return bd.inner_nblks == 0 && (bd.strides[1] == 1 || mdw.dims()[1] == 1);
+}
+
+void prefetch_row(const void *ptr, size_t size) {
+#if defined(__GNUC__) || defined(__clang__)
+    const char *p = static_cast<const char *>(ptr);
+    for (size_t o = 0; o < size; o += platform::get_cache_line_size())
+        __builtin_prefetch(p + o, 0, 1);
+#else
+    MAYBE_UNUSED(ptr);
+    MAYBE_UNUSED(size);
+#endif
+}
+
+// Accumulates `len` elements of the table starting at the element `off`
+// into `acc`. The elements are dequantized with `scale`.
+using accumulate_fn_t = void (*)(float *acc, const void *table, dim_t off,
+        dim_t len, float scale, bool is_max);
+
+template <data_type_t dt>
+void accumulate(float *acc, const void *table, dim_t off, dim_t len,
+        float scale, bool is_max) {
+    using data_t = typename prec_traits<dt>::type;
+    const data_t *row = static_cast<const data_t *>(table) + off;
+    if (is_max) {
+        PRAGMA_OMP_SIMD()
+        for (dim_t c = 0; c < len; c++)
+            acc[c] = nstl::max(acc[c], scale * static_cast<float>(row[c]));
+    } else {
+        PRAGMA_OMP_SIMD()
+        for (dim_t c = 0; c < len; c++)
+            acc[c] += scale * static_cast<float>(row[c]);
+    }
+}
+
+template <data_type_t dt>
+void accumulate_int4(float *acc, const void *table, dim_t off, dim_t len,
+        float scale, bool is_max) {
+    for (dim_t c = 0; c < len; c++) {
+        const float v = scale * io::load_float_value(dt, table, off + c);
+        acc[c] = is_max ? nstl::max(acc[c], v) : acc[c] + v;
+    }
+}
+
+accumulate_fn_t get_accumulate_fn(data_type_t dt) {
+    switch (dt) {
+        case f32: return accumulate<f32>;
+        case bf16: return accumulate<bf16>;
+        case f16: return accumulate<f16>;
+        case s8: return accumulate<s8>;
+        case u8: return accumulate<u8>;
+        case s4: return accumulate_int4<s4>;
+        case u4: return accumulate_int4<u4>;
+        default: assert(!"unsupported data type"); return nullptr;
+    }
+}
+
+} // namespace
+
+status_t simple_embedding_bag_t::pd_t::init(engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_dt = src_md(0)->data_type;
+    const auto dst_dt = dst_md(0)->data_type;
+
+    VDISPATCH_EMBEDDING_BAG(
+            utils::one_of(src_dt, f32, bf16, f16, s8, u8, s4, u4),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(
+            utils::one_of(dst_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(platform::has_data_type_support(src_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(platform::has_data_type_support(dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(
+            attr()->has_default_values(skip_mask_t::scales_runtime),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_EMBEDDING_BAG_SC(set_default_params(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_EMBEDDING_BAG(!has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    const memory_desc_wrapper src_d(src_md(0));
+    const memory_desc_wrapper indices_d(src_md(1));
+    const memory_desc_wrapper offsets_d(src_md(2));
+    const memory_desc_wrapper dst_d(dst_md(0));
+
+    // The rows of the table and of dst must be contiguous.
+    VDISPATCH_EMBEDDING_BAG(is_row_major(src_d), VERBOSE_BLOCKING_FAIL,
+            "src rows are not contiguous");
+    VDISPATCH_EMBEDDING_BAG(is_row_major(dst_d), VERBOSE_BLOCKING_FAIL,
+            "dst rows are not contiguous");
+    VDISPATCH_EMBEDDING_BAG(indices_d.is_dense() && offsets_d.is_dense(),
+            VERBOSE_NONTRIVIAL_STRIDE);
+    // The rows of int4 tables must start at a byte boundary.
+    VDISPATCH_EMBEDDING_BAG(IMPLICATION(utils::one_of(src_dt, s4, u4),
+                                    src_d.blocking_desc().strides[0] % 2 == 0
+                                            && src_d.offset0() % 2 == 0),
+            VERBOSE_UNSUPPORTED_MEM_STRIDE);
+
+    return status::success;
+}
+
+status_t simple_embedding_bag_t::execute(const exec_ctx_t &ctx) const {
+    const auto table = CTX_IN_MEM(const void *, DNNL_ARG_SRC_0);
+    const auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_2);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    const bool per_row_scales
+            = pd()->attr()->scales_.get(DNNL_ARG_SRC).mask_ != 0;
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+
+    const dim_t R = pd()->num_rows();
+    const dim_t D = pd()->embedding_dim();
+    const dim_t N = pd()->num_indices();
+    const dim_t B = pd()->num_bags();
+    if (B == 0 || D == 0) return status::success;
+
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const bool is_int4 = utils::one_of(src_dt, s4, u4);
+    const dim_t src_stride = src_d.blocking_desc().strides[0];
+    const dim_t dst_stride = dst_d.blocking_desc().strides[0];
+    const dim_t src_off0 = src_d.offset0();
+    const dim_t dst_off0 = dst_d.offset0();
+    const size_t row_bytes = is_int4 ? utils::div_up(D, 2)
+                                     : D * types::data_type_size(src_dt);
+
+    const auto alg = pd()->desc()->alg_kind;
+    const bool is_max = alg == alg_kind::reduction_max;
+    const bool is_mean = alg == alg_kind::reduction_mean;
+    const accumulate_fn_t accumulate_fn = get_accumulate_fn(src_dt);
+
+    const auto row_ptr = [&](dim_t off) {
+        const size_t bytes = is_int4
+                ? static_cast<size_t>(off / 2)
+                : static_cast<size_t>(off) * types::data_type_size(src_dt);
+        return static_cast<const char *>(table) + bytes;
+    };
+    // The range of indices of the bag, malformed offsets are clamped.
+    const auto bag_begin = [&](dim_t b) {
+        return utils::saturate<dim_t>(0, N, offsets[b]);
+    };
+    const auto bag_end = [&](dim_t b) {
+        if (b + 1 == B) return N;
+        return utils::saturate<dim_t>(bag_begin(b), N, offsets[b + 1]);
+    };
+
+    // The bag sizes are usually highly skewed, so the bags are split between
+    // the threads by the number of gathered rows instead of the number of
+    // bags. The cost of a bag also accounts for writing it to dst, so that
+    // the threads are balanced for empty bags too.
+    const int nthr = (int)nstl::min<dim_t>(dnnl_get_max_threads(), B);
+    std::vector<dim_t> bag_starts(nthr + 1, B);
+    bag_starts[0] = 0;
+    const auto cost = [&](dim_t b) { return bag_begin(b) + b; };
+    for (int ithr = 1; ithr < nthr; ithr++) {
+        const dim_t target = (N + B) * ithr / nthr;
+        dim_t lo = bag_starts[ithr - 1], hi = B;
+        while (lo < hi) {
+            const dim_t mid = lo + (hi - lo) / 2;
+            if (cost(mid) < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        bag_starts[ithr] = lo;
+    }
+
+    parallel(nthr, [&](const int ithr, const int nthr_) {
+        alignas(64) float acc[chunk_size];
+
+        for (int p = ithr; p < nthr; p += nthr_) {
+            for (dim_t b = bag_starts[p]; b < bag_starts[p + 1]; b++) {
+                const dim_t begin = bag_begin(b);
+                const dim_t end = bag_end(b);
+
+                for (dim_t c0 = 0; c0 < D; c0 += chunk_size) {
+                    const dim_t len = nstl::min(chunk_size, D - c0);
+                    const float init = is_max ? -FLT_MAX : 0.f;
+                    for (dim_t c = 0; c < len; c++)
+                        acc[c] = init;
+
+                    dim_t n_valid = 0;
+                    for (dim_t i = begin; i < end; i++) {
+                        if (c0 == 0 && i + prefetch_distance < end) {
+                            const dim_t pidx = indices[i + prefetch_distance];
+                            if (pidx >= 0 && pidx < R)
+                                prefetch_row(
+                                        row_ptr(src_off0 + pidx * src_stride),
+                                        row_bytes);
+                        }
+
+                        const dim_t idx = indices[i];
+                        // Out of range indices are skipped.
+                        if (idx < 0 || idx >= R) continue;
+                        const float scale
+                                = src_scales[per_row_scales ? idx : 0];
+                        accumulate_fn(acc, table,
+                                src_off0 + idx * src_stride + c0, len, scale,
+                                is_max);
+                        n_valid++;
+                    }
+
+                    if (n_valid == 0) {
+                        for (dim_t c = 0; c < len; c++)
+                            acc[c] = 0.f;
+                    } else if (is_mean) {
+                        const float inv = 1.f / n_valid;
+                        for (dim_t c = 0; c < len; c++)
+                            acc[c] *= inv;
+                    }
+
+                    const dim_t dst_off = dst_off0 + b * dst_stride + c0;
+                    for (dim_t c = 0; c < len; c++)
+                        io::store_float_value(dst_dt, acc[c], dst, dst_off + c);
+                }
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
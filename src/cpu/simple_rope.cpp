@@ -0,0 +1,221 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/simple_rope.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+using namespace data_type;
+
+namespace {
+
+// Whether the rows of the last dimension are contiguous.
+bool is_row_major(const memory_desc_wrapper &mdw) {
+    if (!mdw.is_blocking_desc()) return false;
+    const auto &bd = mdw.blocking_desc();
+    const int last = mdw.ndims() - 1;
+    return bd.inner_nblks == 0
+            && (bd.strides[last] == 1 || mdw.dims()[last] == 1);
+}
+
+// Rotates `half` pairs of a row. The pair `i` is (2i, 2i + 1) for the
+// interleaved algorithm and (i, i + half) for the half split one.
+using rotate_fn_t = void (*)(const void *src, void *dst, const float *cos,
+        const float *sin, dim_t half, bool interleaved);
+
+template <data_type_t src_dt, data_type_t dst_dt>
+void rotate(const void *src, void *dst, const float *cos, const float *sin,
+        dim_t half, bool interleaved) {
+    using src_t = typename prec_traits<src_dt>::type;
+    using dst_t = typename prec_traits<dst_dt>::type;
+    const src_t *s = static_cast<const src_t *>(src);
+    dst_t *d = static_cast<dst_t *>(dst);
+
+    if (interleaved) {
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < half; i++) {
+            const float x0 = static_cast<float>(s[2 * i]);
+            const float x1 = static_cast<float>(s[2 * i + 1]);
+            d[2 * i] = x0 * cos[i] - x1 * sin[i];
+            d[2 * i + 1] = x1 * cos[i] + x0 * sin[i];
+        }
+    } else {
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < half; i++) {
+            const float x0 = static_cast<float>(s[i]);
+            const float x1 = static_cast<float>(s[i + half]);
+            d[i] = x0 * cos[i] - x1 * sin[i];
+            d[i + half] = x1 * cos[i] + x0 * sin[i];
+        }
+    }
+}
+
+template <data_type_t src_dt>
+rotate_fn_t get_rotate_fn(data_type_t dst_dt) {
+    switch (dst_dt) {
+        case f32: return rotate<src_dt, f32>;
+        case bf16: return rotate<src_dt, bf16>;
+        case f16: return rotate<src_dt, f16>;
+        default: assert(!"unsupported data type"); return nullptr;
+    }
+}
+
+rotate_fn_t get_rotate_fn(data_type_t src_dt, data_type_t dst_dt) {
+    switch (src_dt) {
+        case f32: return get_rotate_fn<f32>(dst_dt);
+        case bf16: return get_rotate_fn<bf16>(dst_dt);
+        case f16: return get_rotate_fn<f16>(dst_dt);
+        default: assert(!"unsupported data type"); return nullptr;
+    }
+}
+
+} // namespace
+
+status_t simple_rope_t::pd_t::init(engine_t *engine) {
+    const auto src_dt = src_md(0)->data_type;
+    const auto dst_dt = dst_md(0)->data_type;
+
+    VDISPATCH_ROPE(
+            utils::one_of(src_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ROPE(
+            utils::one_of(dst_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ROPE(platform::has_data_type_support(src_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ROPE(platform::has_data_type_support(dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ROPE(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_ROPE_SC(set_default_params(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_ROPE(!has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    const memory_desc_wrapper src_d(src_md(0));
+    const memory_desc_wrapper dst_d(dst_md(0));
+    VDISPATCH_ROPE(is_row_major(src_d), VERBOSE_BLOCKING_FAIL,
+            "src rows are not contiguous");
+    VDISPATCH_ROPE(is_row_major(dst_d), VERBOSE_BLOCKING_FAIL,
+            "dst rows are not contiguous");
+
+    use_tmp_tables_ = true;
+    if (with_tables()) {
+        const memory_desc_wrapper cos_d(src_md(1));
+        const memory_desc_wrapper sin_d(src_md(2));
+        VDISPATCH_ROPE(utils::one_of(cos_d.data_type(), f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_ROPE(platform::has_data_type_support(cos_d.data_type()),
+                VERBOSE_UNSUPPORTED_DT);
+        VDISPATCH_ROPE(cos_d.is_blocking_desc() && sin_d.is_blocking_desc(),
+                VERBOSE_BLOCKING_FAIL, "tables are not blocked");
+
+        // Plain f32 tables are used as is.
+        const auto is_plain_f32 = [](const memory_desc_wrapper &mdw) {
+            return mdw.data_type() == f32 && mdw.matches_tag(format_tag::ab)
+                    && mdw.offset0() == 0;
+        };
+        use_tmp_tables_ = !(is_plain_f32(cos_d) && is_plain_f32(sin_d));
+    }
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t simple_rope_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC_0);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    if (src_d.has_zero_dim()) return status::success;
+
+    const dim_t S = pd()->seq_len();
+    const dim_t D = pd()->head_size();
+    const dim_t half = D / 2;
+    const dim_t nrows = src_d.nelems() / D;
+
+    const float *cos = nullptr;
+    const float *sin = nullptr;
+    if (pd()->use_tmp_tables()) {
+        auto scratchpad = ctx.get_scratchpad_grantor();
+        float *tables = scratchpad.template get<float>(key_rope_tables);
+        float *tmp_cos = tables;
+        float *tmp_sin = tables + S * half;
+
+        if (pd()->with_tables()) {
+            const auto user_cos = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+            const auto user_sin = CTX_IN_MEM(const void *, DNNL_ARG_SRC_2);
+            const memory_desc_wrapper cos_d(pd()->src_md(1));
+            const memory_desc_wrapper sin_d(pd()->src_md(2));
+            parallel_nd(S, half, [&](dim_t s, dim_t i) {
+                tmp_cos[s * half + i] = io::load_float_value(
+                        cos_d.data_type(), user_cos, cos_d.off(s, i));
+                tmp_sin[s * half + i] = io::load_float_value(
+                        sin_d.data_type(), user_sin, sin_d.off(s, i));
+            });
+        } else {
+            // The frequencies are computed the same way as in the frameworks
+            // to get the same rounding.
+            const float base = pd()->desc()->base;
+            parallel_nd(S, half, [&](dim_t s, dim_t i) {
+                const float inv_freq = 1.f
+                        / powf(base, static_cast<float>(2 * i) / D);
+                const float angle = static_cast<float>(s) * inv_freq;
+                tmp_cos[s * half + i] = cosf(angle);
+                tmp_sin[s * half + i] = sinf(angle);
+            });
+        }
+        cos = tmp_cos;
+        sin = tmp_sin;
+    } else {
+        cos = CTX_IN_MEM(const float *, DNNL_ARG_SRC_1);
+        sin = CTX_IN_MEM(const float *, DNNL_ARG_SRC_2);
+    }
+
+    const size_t src_dt_size = src_d.data_type_size();
+    const size_t dst_dt_size = dst_d.data_type_size();
+    const bool interleaved = pd()->is_interleaved();
+    const rotate_fn_t rotate_fn
+            = get_rotate_fn(src_d.data_type(), dst_d.data_type());
+
+    // The row `r` is at the position `r % S`, since the positions are the
+    // second to last dimension.
+    parallel_nd(nrows, [&](dim_t r) {
+        const dim_t s = r % S;
+        const auto src_off = src_d.off_l(r * D);
+        const auto dst_off = dst_d.off_l(r * D);
+        rotate_fn(src + src_off * src_dt_size, dst + dst_off * dst_dt_size,
+                cos + s * half, sin + s * half, half, interleaved);
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
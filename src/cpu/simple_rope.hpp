@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_ROPE_HPP
+#define CPU_SIMPLE_ROPE_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_rope_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// The implementation processes the rows of src in parallel. The cosine and
+// sine values are converted to f32 (or computed from the base) once per
+// execution into the scratchpad unless the user passes dense f32 tables, so
+// the rotation of a row is a single vectorized pass.
+struct simple_rope_t : public primitive_t {
+    struct pd_t : public cpu_rope_pd_t {
+        using cpu_rope_pd_t::cpu_rope_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_rope_t);
+
+        status_t init(engine_t *engine);
+
+        // Whether the f32 tables have to be prepared in the scratchpad.
+        bool use_tmp_tables() const { return use_tmp_tables_; }
+
+    private:
+        bool use_tmp_tables_ = true;
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            if (!use_tmp_tables()) return;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(
+                    key_rope_tables, 2 * seq_len() * (head_size() / 2));
+        }
+    };
+
+    simple_rope_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,288 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/simple_top_k.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace memory_tracking::names;
+using namespace data_type;
+
+namespace {
+
+using entry_t = simple_top_k_t::entry_t;
+
+// The row is converted to f32 on the stack, so it is processed in chunks.
+constexpr dim_t chunk_size = 256;
+// A part of a split row is at least that long, so that selecting the elements
+// of the part outweighs merging its candidates.
+constexpr dim_t min_part_size = 4096;
+
+bool is_plain(const memory_desc_wrapper &mdw) {
+    return mdw.is_blocking_desc() && mdw.blocking_desc().inner_nblks == 0;
+}
+
+// The order of the selected elements: the larger value first and the lower
+// index first for equal values.
+bool is_better(const entry_t &a, const entry_t &b) {
+    return a.val > b.val || (a.val == b.val && a.idx < b.idx);
+}
+
+// Keeps the best `k` of the pushed elements in `buf`. Once `k` elements are
+// pushed, `buf` is a heap with the worst selected element on top.
+struct heap_t {
+    heap_t(entry_t *buf, dim_t k) : buf_(buf), k_(k), size_(0) {}
+
+    bool is_full() const { return size_ == k_; }
+    // The value an element has to exceed to be selected once the heap is
+    // full.
+    float threshold() const { return buf_[0].val; }
+
+    void push(const entry_t &e) {
+        if (!is_full()) {
+            buf_[size_++] = e;
+            if (is_full()) std::make_heap(buf_, buf_ + k_, is_better);
+            return;
+        }
+        if (!is_better(e, buf_[0])) return;
+        buf_[0] = e;
+        sift_down();
+    }
+
+    // Sorts the selected elements, the best one first.
+    void sort() { std::sort(buf_, buf_ + size_, is_better); }
+
+private:
+    entry_t *buf_;
+    dim_t k_;
+    dim_t size_;
+
+    void sift_down() {
+        dim_t i = 0;
+        while (true) {
+            dim_t worst = i;
+            for (dim_t c = 2 * i + 1; c <= 2 * i + 2 && c < k_; c++)
+                if (is_better(buf_[worst], buf_[c])) worst = c;
+            if (worst == i) break;
+            nstl::swap(buf_[i], buf_[worst]);
+            i = worst;
+        }
+    }
+};
+
+// Converts `len` elements of src starting at the element `off` to f32. The
+// values are negated to select the smallest elements.
+using load_fn_t = void (*)(float *buf, const void *src, dim_t off,
+        dim_t stride, dim_t len, bool negate);
+
+template <data_type_t dt>
+void load(float *buf, const void *src, dim_t off, dim_t stride, dim_t len,
+        bool negate) {
+    using data_t = typename prec_traits<dt>::type;
+    const data_t *s = static_cast<const data_t *>(src) + off;
+    const float sign = negate ? -1.f : 1.f;
+    if (stride == 1) {
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < len; i++)
+            buf[i] = sign * static_cast<float>(s[i]);
+    } else {
+        for (dim_t i = 0; i < len; i++)
+            buf[i] = sign * static_cast<float>(s[i * stride]);
+    }
+}
+
+load_fn_t get_load_fn(data_type_t dt) {
+    switch (dt) {
+        case f32: return load<f32>;
+        case bf16: return load<bf16>;
+        case f16: return load<f16>;
+        default: assert(!"unsupported data type"); return nullptr;
+    }
+}
+
+// Returns the offset of the first element of the row `r`, where the rows are
+// enumerated over all dimensions but the axis in the logical order.
+dim_t row_offset(const memory_desc_wrapper &mdw, int axis, dim_t r) {
+    dims_t pos = {0};
+    for (int d = mdw.ndims() - 1; d >= 0; d--) {
+        if (d == axis) continue;
+        pos[d] = r % mdw.dims()[d];
+        r /= mdw.dims()[d];
+    }
+    return mdw.off_v(pos);
+}
+
+} // namespace
+
+status_t simple_top_k_t::pd_t::init(engine_t *engine) {
+    const auto src_dt = src_md(0)->data_type;
+    const auto dst_dt = dst_md(0)->data_type;
+
+    VDISPATCH_TOP_K(
+            utils::one_of(src_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOP_K(
+            utils::one_of(dst_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOP_K(platform::has_data_type_support(src_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOP_K(platform::has_data_type_support(dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOP_K(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_TOP_K_SC(set_default_params(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_TOP_K(!has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    // The elements of a row are addressed with the stride of the axis.
+    VDISPATCH_TOP_K(is_plain(memory_desc_wrapper(src_md(0))),
+            VERBOSE_BLOCKING_FAIL, "src is blocked");
+    VDISPATCH_TOP_K(is_plain(memory_desc_wrapper(dst_md(0))),
+            VERBOSE_BLOCKING_FAIL, "dst is blocked");
+    VDISPATCH_TOP_K(is_plain(memory_desc_wrapper(dst_md(1))),
+            VERBOSE_BLOCKING_FAIL, "indices are blocked");
+    VDISPATCH_TOP_K(axis_size() <= INT32_MAX, VERBOSE_BAD_DIM, "src", axis());
+
+    nthr_ = dnnl_get_max_threads();
+    nparts_ = 1;
+    if (nrows() < nthr_) {
+        const dim_t max_parts
+                = axis_size() / nstl::max(min_part_size, 4 * k());
+        nparts_ = nstl::max<dim_t>(1,
+                nstl::min<dim_t>(utils::div_up(nthr_, nrows()), max_parts));
+    }
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t simple_top_k_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST_0);
+    auto indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_DST_1);
+
+    const memory_desc_wrapper src_d(pd()->src_md(0));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper indices_d(pd()->dst_md(1));
+    if (src_d.has_zero_dim()) return status::success;
+
+    const int axis = pd()->axis();
+    const dim_t N = pd()->axis_size();
+    const dim_t K = pd()->k();
+    const dim_t nrows = pd()->nrows();
+    const dim_t nparts = pd()->nparts();
+    const bool negate = !pd()->is_max();
+
+    const dim_t src_stride = src_d.blocking_desc().strides[axis];
+    const dim_t dst_stride = dst_d.blocking_desc().strides[axis];
+    const dim_t indices_stride = indices_d.blocking_desc().strides[axis];
+    const auto dst_dt = dst_d.data_type();
+    const load_fn_t load_fn = get_load_fn(src_d.data_type());
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    entry_t *heaps = scratchpad.template get<entry_t>(key_top_k_heap);
+    entry_t *candidates = nparts > 1
+            ? scratchpad.template get<entry_t>(key_top_k_candidates)
+            : nullptr;
+
+    // Writes the selected elements of the row `r` sorted.
+    const auto store_row = [&](heap_t &heap, const entry_t *sel, dim_t r) {
+        heap.sort();
+        const dim_t dst_off = row_offset(dst_d, axis, r);
+        const dim_t indices_off = row_offset(indices_d, axis, r);
+        for (dim_t j = 0; j < K; j++) {
+            const float val = negate ? -sel[j].val : sel[j].val;
+            io::store_float_value(dst_dt, val, dst, dst_off + j * dst_stride);
+            indices[indices_off + j * indices_stride] = sel[j].idx;
+        }
+    };
+
+    // Selects the best elements of the part `p` of the row `r`.
+    const int nthr = pd()->nthr();
+    const dim_t work_amount = nrows * nparts;
+    parallel(nthr, [&](const int ithr, const int nthr_) {
+        dim_t start = 0, end = 0;
+        balance211(work_amount, nthr_, ithr, start, end);
+        alignas(64) float buf[chunk_size];
+        entry_t *heap_buf = heaps + ithr * K;
+
+        for (dim_t w = start; w < end; w++) {
+            const dim_t r = w / nparts;
+            const dim_t p = w % nparts;
+            dim_t begin = 0, part_end = 0;
+            balance211(N, nparts, p, begin, part_end);
+
+            entry_t *sel = nparts > 1 ? candidates + w * K : heap_buf;
+            heap_t heap(sel, K);
+            const dim_t src_off = row_offset(src_d, axis, r);
+            for (dim_t c0 = begin; c0 < part_end; c0 += chunk_size) {
+                const dim_t len = nstl::min(chunk_size, part_end - c0);
+                load_fn(buf, src, src_off + c0 * src_stride, src_stride, len,
+                        negate);
+
+                // The elements are pushed in the order of their indices, so
+                // an element equal to the top of the heap is not selected.
+                if (heap.is_full()) {
+                    float max_val = -FLT_MAX;
+                    PRAGMA_OMP_SIMD(reduction(max : max_val))
+                    for (dim_t i = 0; i < len; i++)
+                        max_val = nstl::max(max_val, buf[i]);
+                    if (!(max_val > heap.threshold())) continue;
+                }
+                for (dim_t i = 0; i < len; i++)
+                    heap.push({buf[i], static_cast<int32_t>(c0 + i)});
+            }
+
+            if (nparts == 1) store_row(heap, sel, r);
+        }
+    });
+
+    if (nparts == 1) return status::success;
+
+    // Merges the candidates of the parts of each row.
+    parallel(nthr, [&](const int ithr, const int nthr_) {
+        dim_t start = 0, end = 0;
+        balance211(nrows, nthr_, ithr, start, end);
+        entry_t *heap_buf = heaps + ithr * K;
+
+        for (dim_t r = start; r < end; r++) {
+            heap_t heap(heap_buf, K);
+            const entry_t *row_candidates = candidates + r * nparts * K;
+            for (dim_t i = 0; i < nparts * K; i++)
+                heap.push(row_candidates[i]);
+            store_row(heap, heap_buf, r);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_TOP_K_HPP
+#define CPU_SIMPLE_TOP_K_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_top_k_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// The implementation keeps the best `k` elements of a row in a heap with the
+// worst selected element on top. The row is converted to f32 in chunks and a
+// chunk is skipped with a single vectorized max when none of its elements
+// beats the top of the heap, which is the common case once the heap is
+// filled, so the cost of a row is close to one pass over its elements.
+//
+// The rows are processed in parallel. When there are fewer rows than threads,
+// as for sampling from the logits of a few sequences, the long rows are also
+// split into parts. The best `k` elements of each part are stored in the
+// scratchpad and merged into the result in a second pass.
+struct simple_top_k_t : public primitive_t {
+    // An element of a row with its position along the axis.
+    struct entry_t {
+        float val;
+        int32_t idx;
+    };
+
+    struct pd_t : public cpu_top_k_pd_t {
+        using cpu_top_k_pd_t::cpu_top_k_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_top_k_t);
+
+        status_t init(engine_t *engine);
+
+        int nthr() const { return nthr_; }
+        // The number of parts each row is split into.
+        dim_t nparts() const { return nparts_; }
+
+    private:
+        int nthr_ = 1;
+        dim_t nparts_ = 1;
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<entry_t>(key_top_k_heap, nthr_ * k());
+            if (nparts_ > 1)
+                scratchpad.template book<entry_t>(
+                        key_top_k_candidates, nrows() * nparts_ * k());
+        }
+    };
+
+    simple_top_k_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -26,19 +26,6 @@ using namespace dnnl::impl::utils;
 
 namespace brgemm_containers {
 
-std::set<std::shared_ptr<brgemm_kernel_t>,
-        decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
-brgemm_kernel_container_t::get_set() {
-#ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
-    static std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
-            set_ = std::set<std::shared_ptr<brgemm_kernel_t>,
-                    decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>(
-                    brgemm_kernel_container_t::brgemm_kernel_cmp);
-#endif
-    return set_;
-}
-
 bool brgemm_desc_container_t::insert(int idx, brgemm_desc_t &brg,
         const std::vector<char> &bd_mask,
         const std::vector<brgemm_batch_element_t> &static_offsets) {
@@ -87,32 +74,19 @@ int brgemm_desc_container_t::insert(brgemm_desc_t &brg,
     return idx;
 }
 
-bool brgemm_kernel_container_t::brgemm_kernel_cmp(
-        const std::shared_ptr<brgemm_kernel_t> &lhs,
-        const std::shared_ptr<brgemm_kernel_t> &rhs) {
-    const auto lsz = lhs->get_jit_generator()->getSize();
-    const auto rsz = rhs->get_jit_generator()->getSize();
-    if (lsz != rsz) return (lsz < rsz);
-    const auto lcode = lhs->get_jit_generator()->CodeGenerator::getCode();
-    const auto rcode = rhs->get_jit_generator()->CodeGenerator::getCode();
-    return (std::memcmp(lcode, rcode, lsz) < 0);
-}
-
 status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
     // Use two level hashing of brgemm kernels:
     // 1. Try to find entry in local brgemm_map_ using brgemm descriptor as a
     // key (we can check if brgemm descriptor is unique inside brgemm primitive)
-    // 2. Only if we do not find entry in local brgemm_map_  then try to find
-    // entry in kernel storage using kernel code as key
+    // 2. Only if we do not find entry in local brgemm_map_  then get the
+    // kernel from the process-wide kernel cache, which generates it only if
+    // no other primitive has an equal brgemm descriptor
     const auto brgemm_it = brgemm_map_.find(brg);
     if (brgemm_it == brgemm_map_.end()) {
-        brgemm_kernel_t *brg_kernel = nullptr;
-        CHECK(brgemm_kernel_create(&brg_kernel, *brg));
-        std::shared_ptr<brgemm_kernel_t> sptr(brg_kernel);
-        lock_write();
-        const auto kernel_ret = get_set().insert(sptr);
-        refs_[idx] = kernel_ret.first->get();
-        unlock_write();
+        std::shared_ptr<const brgemm_kernel_t> brg_kernel;
+        CHECK(brgemm_kernel_get_or_create(brg_kernel, *brg));
+        refs_[idx] = brg_kernel.get();
+        kernels_.push_back(std::move(brg_kernel));
         const auto brgemm_ret = brgemm_map_.insert({brg, refs_[idx]});
         if (!brgemm_ret.second) return status::runtime_error;
     } else {
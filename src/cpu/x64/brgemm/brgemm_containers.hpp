@@ -18,9 +18,9 @@
 #define CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
 
 #include <set>
-#include "common/rw_mutex.hpp"
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_kernel_cache.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -67,9 +67,8 @@ private:
     std::vector<std::vector<brgemm_batch_element_t>> static_offsets_list_;
 };
 
-// global storage disabled for now
-// #define BRGEMM_KERNEL_GLOBAL_STORAGE
-
+// The kernels are shared with other primitives through the process-wide
+// kernel cache, see `brgemm_kernel_get_or_create()`.
 struct brgemm_kernel_container_t {
     brgemm_kernel_container_t() {}
     brgemm_kernel_container_t(size_t ns) { resize(ns); }
@@ -79,33 +78,13 @@ struct brgemm_kernel_container_t {
     }
 
     status_t insert(int idx, const brgemm_desc_t *brg);
-    static bool brgemm_kernel_cmp(const std::shared_ptr<brgemm_kernel_t> &lhs,
-            const std::shared_ptr<brgemm_kernel_t> &rhs);
+    status_t insert(int idx, const brgemm_desc_t &brg) {
+        return insert(idx, &brg);
+    }
 
 private:
     std::vector<const brgemm_kernel_t *> refs_;
-#ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
-
-    void lock_write() { rw_mutex().lock_write(); }
-    void unlock_write() { rw_mutex().unlock_write(); }
-
-#else
-    std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
-            set_ {std::set<std::shared_ptr<brgemm_kernel_t>,
-                    decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>(
-                    brgemm_kernel_container_t::brgemm_kernel_cmp)};
-
-    void lock_write() {}
-    void unlock_write() {}
-#endif
-    std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
-    get_set();
+    std::vector<std::shared_ptr<const brgemm_kernel_t>> kernels_;
 
     std::map<const brgemm_desc_t *, const brgemm_kernel_t *> brgemm_map_;
 };
@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "common/kernel_cache.hpp"
+#include "common/primitive_hashing.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_kernel_cache.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace {
+
+// The descriptor comparison only covers the parameters that may differ
+// between the descriptors of a single primitive, so the key additionally
+// compares the parameters that are set by the primitives and the post-ops
+// and the destination they are generated for. The scales and the zero points
+// of the attributes are already reflected in the descriptor, and the rest of
+// the attributes doesn't affect the kernel, so the primitives which only
+// differ in them share the kernels.
+struct brgemm_kernel_key_t : public kernel_cache::key_impl_t {
+    brgemm_kernel_key_t(const brgemm_desc_t &brg) : brg_(brg) {
+        // The bd mask and the static offsets are owned by the primitive the
+        // descriptor comes from, which may be destroyed before the key.
+        brg_.brgattr.bd_mask = nullptr;
+        if (brg.brgattr.bd_mask_level > 0 && brg.brgattr.bd_mask) {
+            bd_mask_.assign(brg.brgattr.bd_mask,
+                    brg.brgattr.bd_mask + brg.bcast_dim);
+            brg_.brgattr.bd_mask = bd_mask_.data();
+        }
+        brg_.brgattr.static_offsets = nullptr;
+        if (brg.type == brgemm_static_offs && brg.brgattr.static_offsets) {
+            static_offsets_.assign(brg.brgattr.static_offsets,
+                    brg.brgattr.static_offsets + brg.brgattr.max_bs);
+            brg_.brgattr.static_offsets = static_offsets_.data();
+        }
+
+        hash_ = 0;
+        hash_ = hash_combine(hash_, brg_.bcast_dim);
+        hash_ = hash_combine(hash_, brg_.load_dim);
+        hash_ = hash_combine(hash_, brg_.reduce_dim);
+        hash_ = hash_combine(hash_, brg_.LDA);
+        hash_ = hash_combine(hash_, brg_.LDB);
+        hash_ = hash_combine(hash_, brg_.LDC);
+        hash_ = hash_combine(hash_, brg_.LDD);
+        hash_ = hash_combine(hash_, static_cast<size_t>(brg_.isa_impl));
+        hash_ = hash_combine(hash_, static_cast<size_t>(brg_.dt_a));
+        hash_ = hash_combine(hash_, static_cast<size_t>(brg_.dt_b));
+        hash_ = hash_combine(hash_, static_cast<size_t>(brg_.dt_c));
+        hash_ = hash_combine(hash_, static_cast<size_t>(brg_.dt_d));
+        hash_ = hash_combine(hash_, static_cast<size_t>(brg_.type));
+        hash_ = hash_combine(hash_, brg_.beta);
+        hash_ = hash_combine(hash_, brg_.brgattr.max_bs);
+        if (brg_.attr()) {
+            const auto &post_ops = brg_.attr()->post_ops_;
+            hash_ = hash_combine(hash_, post_ops.len());
+            for (int i = 0; i < post_ops.len(); i++)
+                hash_ = hash_combine(
+                        hash_, static_cast<size_t>(post_ops.entry_[i].kind));
+        }
+        if (brg_.dst_md())
+            hash_ = hash_combine(
+                    hash_, primitive_hashing::get_md_hash(*brg_.dst_md()));
+    }
+
+    bool compare(const key_impl_t *key_impl) const override {
+        const auto *other = dynamic_cast<const brgemm_kernel_key_t *>(key_impl);
+        if (other == nullptr) return false;
+        const brgemm_desc_t &lhs = brg_;
+        const brgemm_desc_t &rhs = other->brg_;
+        if (!(lhs == rhs)) return false;
+
+#define CMP_BRGEMM_FIELD(x) \
+    if ((lhs.x) != (rhs.x)) return false
+
+        CMP_BRGEMM_FIELD(req_comp_pads_with_bcast);
+        CMP_BRGEMM_FIELD(skip_zp_b_compensation);
+        CMP_BRGEMM_FIELD(skip_scales);
+        CMP_BRGEMM_FIELD(with_bias);
+        CMP_BRGEMM_FIELD(req_s8s8_compensation);
+        CMP_BRGEMM_FIELD(with_weights_scale_adjust);
+        CMP_BRGEMM_FIELD(embd_bcst);
+        CMP_BRGEMM_FIELD(is_M_tail);
+        CMP_BRGEMM_FIELD(is_bf16_emu);
+        CMP_BRGEMM_FIELD(innermost_loop);
+        CMP_BRGEMM_FIELD(bd_block);
+        CMP_BRGEMM_FIELD(bd_block2);
+        CMP_BRGEMM_FIELD(ld_block);
+        CMP_BRGEMM_FIELD(ld_block2);
+        CMP_BRGEMM_FIELD(rd_block);
+        CMP_BRGEMM_FIELD(prfA.dist1);
+        CMP_BRGEMM_FIELD(prfA.dist2);
+        CMP_BRGEMM_FIELD(prfB.dist1);
+        CMP_BRGEMM_FIELD(prfB.dist2);
+        CMP_BRGEMM_FIELD(prfC.dist1);
+        CMP_BRGEMM_FIELD(prfC.dist2);
+
+#undef CMP_BRGEMM_FIELD
+
+        if ((lhs.attr() == nullptr) != (rhs.attr() == nullptr)) return false;
+        if (lhs.attr() && !(lhs.attr()->post_ops_ == rhs.attr()->post_ops_))
+            return false;
+        if ((lhs.dst_md() == nullptr) != (rhs.dst_md() == nullptr))
+            return false;
+        if (lhs.dst_md() && !(*lhs.dst_md() == *rhs.dst_md())) return false;
+        return true;
+    }
+
+    size_t hash() const override { return hash_; }
+
+    const brgemm_desc_t &brg() const { return brg_; }
+
+private:
+    brgemm_desc_t brg_;
+    std::vector<char> bd_mask_;
+    std::vector<brgemm_batch_element_t> static_offsets_;
+    size_t hash_;
+};
+
+struct brgemm_kernel_value_t : public kernel_cache::value_impl_t {
+    brgemm_kernel_value_t(brgemm_kernel_t *kernel) : kernel(kernel) {}
+    std::unique_ptr<brgemm_kernel_t> kernel;
+};
+
+} // namespace
+
+status_t brgemm_kernel_get_or_create(
+        std::shared_ptr<const brgemm_kernel_t> &brg_kernel,
+        const brgemm_desc_t &brg) {
+    auto key_impl = std::make_shared<brgemm_kernel_key_t>(brg);
+    const brgemm_desc_t &key_brg = key_impl->brg();
+    kernel_cache::key_t key {std::move(key_impl)};
+
+    kernel_cache::iface_t::create_func_ptr_t create = [](void *context) {
+        const auto &brg = *static_cast<const brgemm_desc_t *>(context);
+        brgemm_kernel_t *kernel = nullptr;
+        const status_t status = brgemm_kernel_create(&kernel, brg);
+        if (status != status::success)
+            return kernel_cache::iface_t::result_t {nullptr, status};
+        std::shared_ptr<kernel_cache::value_impl_t> value
+                = std::make_shared<brgemm_kernel_value_t>(kernel);
+        return kernel_cache::iface_t::result_t {std::move(value), status};
+    };
+    auto result = kernel_cache::get().get_or_create(
+            key, *create, const_cast<brgemm_desc_t *>(&key_brg));
+    if (result.status != status::success) return result.status;
+
+    auto value = std::static_pointer_cast<brgemm_kernel_value_t>(
+            result.value.release());
+    if (!value || !value->kernel) return status::runtime_error;
+    // The aliasing constructor shares the ownership of the cache value.
+    brg_kernel = std::shared_ptr<const brgemm_kernel_t>(
+            value, value->kernel.get());
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
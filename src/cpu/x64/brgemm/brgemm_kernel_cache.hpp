@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_BRGEMM_BRGEMM_KERNEL_CACHE_HPP
+#define CPU_X64_BRGEMM_BRGEMM_KERNEL_CACHE_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+
+#include "cpu/x64/brgemm/brgemm_types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Returns the brgemm kernel generated for the descriptor `brg`.
+//
+// The kernels are kept in the process-wide kernel cache, so the primitives
+// whose brgemm descriptors are equal share a single copy of the generated
+// code instead of generating their own one. The returned pointer keeps the
+// kernel alive after it is evicted from the cache.
+status_t brgemm_kernel_get_or_create(
+        std::shared_ptr<const brgemm_kernel_t> &brg_kernel,
+        const brgemm_desc_t &brg);
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+//vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
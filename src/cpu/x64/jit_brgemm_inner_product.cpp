@@ -244,7 +244,7 @@ status_t brgemm_inner_product_fwd_t<isa>::execute_forward(
         auto is_bs_tail = (gemm_batch != jbgp.gemm_batch_size);
         int brg_ker_idx = brgemm_inner_product_utils::get_brg_kernel_index(
                 is_bs_tail, kernel_init, is_os_tail, is_oc_tail, false);
-        auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+        auto brg_kernel = brg_kernels_[brg_ker_idx];
         const int ic_blocks_per_batch = jbgp.K / jbgp.ic_block;
 
         const dim_t wei_cur_ocb = blk_off(weights_d, cur_ocb, 0, kd, kh, kw);
@@ -315,7 +315,7 @@ status_t brgemm_inner_product_fwd_t<isa>::execute_forward(
                     = wei_cur_ocb + wei_ic_stride * (icb + ic_block);
             addr_batch[0].ptr.B = weights + wei_offset;
 
-            auto brg_kernel_ic_tail = brg_kernels_[brg_ker_ic_tail_idx].get();
+            auto brg_kernel_ic_tail = brg_kernels_[brg_ker_ic_tail_idx];
             auto ptr_D = dst + dst_off;
             auto ptr_C = use_c_buffer ? c_buffer : ptr_D;
             if (jbgp.nthr_ic_b == 1 && are_post_ops_applicable
@@ -577,8 +577,7 @@ status_t brgemm_inner_product_fwd_t<isa>::execute_forward(
                                             is_os_tail, is_oc_tail, false);
                             brgemm_palettes_.maybe_tile_configure(
                                     is_amx, prev_ker_idx, brg_ker_idx);
-                            const auto brg_kernel
-                                    = brg_kernels_[brg_ker_idx].get();
+                            const auto brg_kernel = brg_kernels_[brg_ker_idx];
                             const int os = osb * jbgp.os_block;
                             const int oc = ocb * jbgp.oc_block;
                             const auto ptr_bias = jbgp.with_bias
@@ -782,7 +781,7 @@ void brgemm_inner_product_bwd_data_t<isa>::execute_backward_data(
         const int brg_ker_idx
                 = brgemm_inner_product_utils::get_brg_kernel_index(
                         is_bs_tail, kernel_init, is_os_tail, is_ic_tail, false);
-        auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+        auto brg_kernel = brg_kernels_[brg_ker_idx];
 
         const int size_B = jbgp.LDB * rnd_up(jbgp.K, 2);
 
@@ -854,8 +853,7 @@ void brgemm_inner_product_bwd_data_t<isa>::execute_backward_data(
                         jbgp.K_tail);
             }
 
-            auto brg_kernel_oc_tail
-                    = brg_kernels_[brg_kernel_oc_tail_idx].get();
+            auto brg_kernel_oc_tail = brg_kernels_[brg_kernel_oc_tail_idx];
             if (jbgp.use_buffer && jbgp.nthr_oc_b <= 1) {
                 void *scratch
                         = is_amx ? static_cast<void *>(wsp_tile) : nullptr;
@@ -1446,7 +1444,7 @@ void brgemm_inner_product_bwd_weights_t<isa>::compute_diff_weights_and_bias(
         const int brg_ker_idx
                 = brgemm_inner_product_utils::get_brg_kernel_index(
                         is_bs_tail, kernel_init, is_ic_tail, is_oc_tail, false);
-        auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+        auto brg_kernel = brg_kernels_[brg_ker_idx];
 
         if (kernel_init && (is_ic_tail || is_oc_tail)) {
             // Due to big_ic_blk_ok optimization, the ic_block can be larger
@@ -1528,7 +1526,7 @@ void brgemm_inner_product_bwd_weights_t<isa>::compute_diff_weights_and_bias(
             const int brg_ker_idx_os_tail
                     = brgemm_inner_product_utils::get_brg_kernel_index(
                             false, use_init_ker, is_ic_tail, is_oc_tail, true);
-            auto brg_kernel_os_tail = brg_kernels_[brg_ker_idx_os_tail].get();
+            auto brg_kernel_os_tail = brg_kernels_[brg_ker_idx_os_tail];
             if (brg_kernel_os_tail != nullptr)
                 brgemm_palettes_.maybe_tile_configure(
                         jbgp.is_amx, prev_ker_idx, brg_ker_idx_os_tail);
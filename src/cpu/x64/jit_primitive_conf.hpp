@@ -856,7 +856,9 @@ enum class binary_bcast_t : unsigned {
     scalar,
     per_batch,
     per_c,
-    per_w
+    per_w,
+    // arbitrary broadcast of any of the sources, see jit_binary_conf_t
+    general
 };
 
 struct jit_binary_conf_t {
@@ -882,6 +884,20 @@ struct jit_binary_conf_t {
     int not_bcasted_sp_dims = 0;
     cpu_isa_t isa = isa_undef;
 
+    // The general broadcast strategy processes dst by blocks of the innermost
+    // dimensions over which src0 is present and src1 is either present or
+    // broadcast, so a kernel call needs a single pointer per tensor.
+    // The blocks are enumerated by the collapsed outer dimensions with the
+    // corresponding strides of the sources, which are zero for the broadcast
+    // dimensions. The inner block is split by `block_size` between the
+    // threads when there are not enough blocks to occupy every thread.
+    dim_t inner_size = 0;
+    dim_t outer_size = 0;
+    dim_t block_size = 0;
+    int bcast_outer_ndims = 0;
+    dims_t bcast_outer_dims = {};
+    dims_t bcast_outer_strides[2] = {};
+
     data_type_t src0_type = data_type::undef;
     data_type_t src1_type = data_type::undef;
     data_type_t dst_type = data_type::undef;
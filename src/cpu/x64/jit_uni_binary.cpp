@@ -14,7 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <functional>
+#include <vector>
 
 #include "common/dnnl_thread.hpp"
 #include "cpu/cpu_primitive.hpp"
@@ -110,6 +112,8 @@ static bool data_format_supported(
 status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
     using sm = primitive_attr_t::skip_mask_t;
 
+    VDISPATCH_BINARY(!is_ternary_op(), VERBOSE_BAD_ALGORITHM);
+
     conf_.dst_type = dst_md()->data_type;
     conf_.src0_type = src_md(0)->data_type;
     conf_.src1_type = src_md(1)->data_type;
@@ -135,10 +139,14 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
     VDISPATCH_BINARY(
             set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
     VDISPATCH_BINARY(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
-    VDISPATCH_BINARY(IMPLICATION(!conf_.is_i8, src0_md_ == dst_md_),
-            VERBOSE_INCONSISTENT_MDS, "src", "dst");
-    VDISPATCH_BINARY(
-            is_applicable(), "not applicable for current implementation");
+
+    // The shapes and layouts the dedicated strategies do not support are
+    // handled by the general broadcast one.
+    const bool is_general_bcast = !(is_applicable()
+            && IMPLICATION(!conf_.is_i8,
+                    src0_md_.similar_to(dst_md_, true, false, 0)));
+    VDISPATCH_BINARY(IMPLICATION(is_general_bcast, init_general_bcast()),
+            "not applicable for current implementation");
     VDISPATCH_BINARY(
             attr()->has_default_values(sm::post_ops | sm::scales_runtime),
             VERBOSE_UNSUPPORTED_ATTR);
@@ -146,8 +154,10 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
             VERBOSE_UNSUPPORTED_POSTOP);
 
     // All operations over blocking descriptors should have md initialized.
-    conf_.is_src_different_layouts = !compare_layouts(src0_md_, src1_md_);
-    VDISPATCH_BINARY(post_ops_ok(attr(), src_md(0), dst_md(),
+    conf_.is_src_different_layouts
+            = !is_general_bcast && !compare_layouts(src0_md_, src1_md_);
+    VDISPATCH_BINARY(post_ops_ok(attr(),
+                             is_general_bcast ? dst_md() : src_md(0), dst_md(),
                              conf_.is_src_different_layouts, conf_.isa),
             VERBOSE_UNSUPPORTED_POSTOP);
     VDISPATCH_BINARY(
@@ -166,12 +176,18 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
             "unsupported isa or inconsistent mds");
 
     conf_.postops_per_oc_broadcast_exists
-            = binary_injector::any_binary_postop_rhs_per_oc_broadcast(
-                    po, src0_md_, get_supported_postops_bcast_strategies());
+            = binary_injector::any_binary_postop_rhs_per_oc_broadcast(po,
+                    is_general_bcast ? dst_md_ : src0_md_,
+                    get_supported_postops_bcast_strategies());
+    // The general broadcast strategy does not track the channel of the dst
+    // elements.
+    VDISPATCH_BINARY(IMPLICATION(is_general_bcast,
+                             !conf_.postops_per_oc_broadcast_exists),
+            VERBOSE_UNSUPPORTED_POSTOP);
     conf_.is_bf16 = conf_.dst_type == bf16;
     conf_.is_f16 = conf_.dst_type == f16;
     conf_.op_type = get_op_type(src0_md_);
-    assert(conf_.op_type != op_t::none);
+    assert(is_general_bcast || conf_.op_type != op_t::none);
     conf_.do_scale_src0 = !attr()->scales_.get(DNNL_ARG_SRC_0).defined()
             || !attr()->scales_.get(DNNL_ARG_SRC_0).has_default_values();
     conf_.do_scale_src1 = !attr()->scales_.get(DNNL_ARG_SRC_1).defined()
@@ -184,8 +200,12 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
             = conf_.with_binary || conf_.with_eltwise || conf_.do_sum;
     conf_.sum_scale = conf_.do_sum ? po.entry_[sum_idx].sum.scale : 0.f;
     const auto &bcast_dims = broadcast_dims();
-    conf_.bcast_type = is_tensor_op() ? bcast_t::none
-                                      : get_bcast_type(src1_md_, bcast_dims);
+    conf_.bcast_type = is_general_bcast ? bcast_t::general
+            : is_tensor_op()            ? bcast_t::none
+                                        : get_bcast_type(src1_md_, bcast_dims);
+    // The access to src1 is set up by init_general_bcast().
+    if (conf_.bcast_type == bcast_t::general) return status::success;
+
     conf_.broadcast_src1_value = (conf_.op_type == op_t::n_c_spatial
                                          && conf_.bcast_type == bcast_t::per_c)
             || (utils::one_of(conf_.op_type, op_t::n_spatial_c, op_t::c_blocked)
@@ -454,6 +474,100 @@ bool jit_uni_binary_t::pd_t::is_applicable() {
     }
 }
 
+bool jit_uni_binary_t::pd_t::init_general_bcast() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const memory_desc_wrapper src_d[2]
+            = {memory_desc_wrapper(src_md(0)), memory_desc_wrapper(src_md(1))};
+
+    const auto is_plain = [](const memory_desc_wrapper &mdw) {
+        return mdw.is_blocking_desc() && mdw.blocking_desc().inner_nblks == 0;
+    };
+    if (!is_plain(dst_d)) return false;
+    for (int i = 0; i < 2; i++)
+        if (!is_plain(src_d[i])) return false;
+
+    // The dimensions of size 1 do not affect the layout, the others are
+    // ordered by the dst strides, the outermost first.
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+    std::vector<int> dims_order;
+    for (int d = 0; d < ndims(); d++)
+        if (dst_d.dims()[d] > 1) dims_order.push_back(d);
+    std::stable_sort(dims_order.begin(), dims_order.end(),
+            [&](int a, int b) { return dst_strides[a] > dst_strides[b]; });
+    const int nactive = (int)dims_order.size();
+    if (nactive == 0) return false;
+
+    // Every tensor must be dense in that order, with its broadcast dimensions
+    // skipped.
+    const auto is_dense = [&](const memory_desc_wrapper &mdw) {
+        dim_t stride = 1;
+        for (int i = nactive - 1; i >= 0; i--) {
+            const int d = dims_order[i];
+            if (mdw.dims()[d] == 1) continue;
+            if (mdw.blocking_desc().strides[d] != stride) return false;
+            stride *= mdw.dims()[d];
+        }
+        return true;
+    };
+    if (!is_dense(dst_d)) return false;
+    for (int i = 0; i < 2; i++)
+        if (!is_dense(src_d[i])) return false;
+
+    const auto is_bcast
+            = [&](int i, int d) { return src_d[i].dims()[d] == 1; };
+    const int innermost_d = dims_order[nactive - 1];
+
+    // The kernel loads src0 by vectors, so src0 must be present in the inner
+    // block, which is extended outwards while src1 keeps being either
+    // present or broadcast.
+    if (is_bcast(0, innermost_d)) return false;
+    int inner_ndims = 1;
+    for (; inner_ndims < nactive; inner_ndims++) {
+        const int d = dims_order[nactive - 1 - inner_ndims];
+        if (is_bcast(0, d) || is_bcast(1, d) != is_bcast(1, innermost_d))
+            break;
+    }
+
+    conf_.broadcast_src1_value = is_bcast(1, innermost_d);
+    conf_.use_stride_src1 = !conf_.broadcast_src1_value;
+
+    conf_.inner_size = 1;
+    for (int i = nactive - inner_ndims; i < nactive; i++)
+        conf_.inner_size *= dst_d.dims()[dims_order[i]];
+    conf_.outer_size = dst_d.nelems() / conf_.inner_size;
+
+    conf_.bcast_outer_ndims = nactive - inner_ndims;
+    for (int o = 0; o < conf_.bcast_outer_ndims; o++) {
+        const int d = dims_order[o];
+        conf_.bcast_outer_dims[o] = dst_d.dims()[d];
+        for (int i = 0; i < 2; i++)
+            conf_.bcast_outer_strides[i][o] = is_bcast(i, d)
+                    ? 0
+                    : src_d[i].blocking_desc().strides[d];
+    }
+
+    // A kernel call per a few elements does not pay off, the reference
+    // implementation handles such shapes.
+    const dim_t simd_w = is_superset(conf_.isa, avx512_core) ? 16
+            : is_superset(conf_.isa, avx2)                   ? 8
+                                                             : 4;
+    if (conf_.inner_size < simd_w) return false;
+
+    // The inner blocks are split between the threads when there are not
+    // enough of them to occupy every thread.
+    const dim_t min_block_size = 1024;
+    const dim_t nthr = dnnl_get_max_threads();
+    dim_t nparts = 1;
+    if (conf_.outer_size < nthr)
+        nparts = nstl::max<dim_t>(1,
+                nstl::min(utils::div_up(nthr, conf_.outer_size),
+                        conf_.inner_size / min_block_size));
+    conf_.block_size = utils::rnd_up(
+            utils::div_up(conf_.inner_size, nparts), simd_w);
+
+    return true;
+}
+
 bool jit_uni_binary_t::post_ops_ok(const primitive_attr_t *attr,
         const memory_desc_wrapper &src0_d, const memory_desc_wrapper &dst_d,
         const bool is_src_different_layouts, const cpu_isa_t isa) {
@@ -1109,6 +1223,52 @@ void jit_uni_binary_t::execute_bcast_per_w_strategy(const data_t *src0,
     }
 }
 
+void jit_uni_binary_t::execute_bcast_general_strategy(const data_t *src0,
+        const data_t *src1, data_t *dst, const float *scale0,
+        const float *scale1,
+        const std::vector<const void *> &post_ops_binary_rhs_arg_vec) const {
+    const auto kernel = kernel_.get();
+    const auto &conf = pd()->get_conf();
+
+    const memory_desc_wrapper src0_d(pd()->src_md(0));
+    const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const int src0_type_size = types::data_type_size(src0_d.data_type());
+    const int src1_type_size = types::data_type_size(src1_d.data_type());
+    const int dst_type_size = types::data_type_size(dst_d.data_type());
+
+    // Compute strategy:
+    // Each inner block is individual, parallel over the collapsed outer
+    // dimensions and the parts of the inner block.
+    const dim_t nparts = utils::div_up(conf.inner_size, conf.block_size);
+    parallel_nd(conf.outer_size, nparts, [&](dim_t outer, dim_t part) {
+        dim_t off0 = 0, off1 = 0;
+        dim_t rem = outer;
+        for (int o = conf.bcast_outer_ndims - 1; o >= 0; o--) {
+            const dim_t idx = rem % conf.bcast_outer_dims[o];
+            rem /= conf.bcast_outer_dims[o];
+            off0 += idx * conf.bcast_outer_strides[0][o];
+            off1 += idx * conf.bcast_outer_strides[1][o];
+        }
+        const dim_t start = part * conf.block_size;
+        const dim_t off_dst = outer * conf.inner_size + start;
+
+        jit_binary_call_s p;
+        p.spat_offt_count = nstl::min(conf.block_size, conf.inner_size - start)
+                * dst_type_size;
+        p.src0 = src0 + (off0 + start) * src0_type_size;
+        p.src1 = src1
+                + (off1 + (conf.broadcast_src1_value ? 0 : start))
+                        * src1_type_size;
+        p.dst = dst + off_dst * dst_type_size;
+        p.scales_src0 = scale0;
+        p.scales_src1 = scale1;
+        p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+        p.dst_orig = dst;
+        (*kernel)(&p);
+    });
+}
+
 status_t jit_uni_binary_t::execute(const exec_ctx_t &ctx) const {
     const auto src0 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_0);
     const auto src1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
@@ -1146,7 +1306,10 @@ status_t jit_uni_binary_t::execute(const exec_ctx_t &ctx) const {
             && (with_postops || point_broadcast || bcast_type == bcast_t::per_w
                     || vector_overwrite);
 
-    if ((bcast_type == bcast_t::none || point_broadcast_no_oc_tail)
+    if (bcast_type == bcast_t::general)
+        execute_bcast_general_strategy(src0, src1, dst, scales[0], scales[1],
+                post_ops_binary_rhs_arg_vec);
+    else if ((bcast_type == bcast_t::none || point_broadcast_no_oc_tail)
             && !postops_per_oc_broadcast_exists && !blocked_oc_tail)
         execute_no_bcast_strategy(src0, src1, dst, scales[0], scales[1],
                 post_ops_binary_rhs_arg_vec, bcast_type);
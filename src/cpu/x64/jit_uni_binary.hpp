@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2023 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -62,6 +62,7 @@ struct jit_uni_binary_t : public primitive_t {
         bool is_different_layouts_allowed(const memory_desc_wrapper &src0_d,
                 const memory_desc_wrapper &src1_d) const;
         bool is_applicable();
+        bool init_general_bcast();
 
         jit_binary_conf_t conf_;
     };
@@ -90,6 +91,10 @@ struct jit_uni_binary_t : public primitive_t {
             data_t *dst, const float *scale0, const float *scale1,
             const std::vector<const void *> &post_ops_binary_rhs_arg_vec,
             const op_t op_type, const bool blocked_oc_tail) const;
+    void execute_bcast_general_strategy(const data_t *src0,
+            const data_t *src1, data_t *dst, const float *scale0,
+            const float *scale1,
+            const std::vector<const void *> &post_ops_binary_rhs_arg_vec) const;
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
@@ -60,7 +60,9 @@ size_t binary_kernel_t::get_tail_size() const {
 
     dim_t nelems = 0;
 
-    if (ndims == 1)
+    if (conf_.bcast_type == bcast_t::general)
+        nelems = conf_.inner_size;
+    else if (ndims == 1)
         nelems = dims[0];
     else if (is_src1_outer_dims_tail_)
         nelems = conf_.outer_dims;
@@ -93,6 +95,7 @@ jit_uni_binary_kernel_t<isa, Vmm>::jit_uni_binary_kernel_t(
     : binary_kernel_t(vreg_traits<Vmm>::vlen, pd, conf, jit_name(), tail_kernel)
     , offt_src0_(vlen_ / ((conf_.is_bf16 || conf_.is_f16) ? 2 : 1))
     , offt_src1_(conf_.use_stride_src1 ? offt_src0_ : 0)
+    , use_offt_dst_(conf_.is_i8 || conf_.src0_type != conf_.dst_type)
     , io_(this, isa, {conf_.src0_type, conf_.src1_type, conf_.dst_type},
               {false},
               io::io_tail_conf_t {simd_w_, tail_size_, tail_opmask_,
@@ -207,14 +210,12 @@ void jit_uni_binary_kernel_t<isa, Vmm>::apply_postops(int unroll, bool tail) {
 
     if (conf_.with_binary) {
         binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
-        const Reg64 &reg_offt_dst
-                = conf_.is_i8 ? reg_offt_dst_ : reg_offt_src0_;
 
         const injector_utils::register_preserve_guard_t register_guard {
                 this, {reg_tmp1_}};
 
         mov(reg_tmp1_, reg_dst_);
-        add(reg_tmp1_, reg_offt_dst);
+        add(reg_tmp1_, reg_offt_dst());
 
         for (int vmm_idx = 1; vmm_idx < unroll + vmm_start_idx_; vmm_idx++) {
             rhs_arg_params.vmm_idx_to_out_reg.emplace(vmm_idx, reg_tmp1_);
@@ -269,8 +270,7 @@ Address jit_uni_binary_kernel_t<isa, Vmm>::src1_ptr(size_t offt) {
 
 template <cpu_isa_t isa, typename Vmm>
 Address jit_uni_binary_kernel_t<isa, Vmm>::dst_ptr(size_t offt) {
-    const Reg64 &reg_offt_dst = conf_.is_i8 ? reg_offt_dst_ : reg_offt_src0_;
-    return vmmword[reg_dst_ + reg_offt_dst + offt];
+    return vmmword[reg_dst_ + reg_offt_dst() + offt];
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -557,15 +557,16 @@ void jit_uni_binary_kernel_t<isa, Vmm>::forward() {
         if (conf_.is_i8 || conf_.dst_type == data_type::s32) {
             uni_vpxor(vreg_zero_, vreg_zero_, vreg_zero_);
             io_.init_saturate_f32({conf_.dst_type});
-            xor_(reg_offt_dst_, reg_offt_dst_); // offt_dst to get addr of dst
         }
+        if (use_offt_dst_)
+            xor_(reg_offt_dst_, reg_offt_dst_); // offt_dst to get addr of dst
 
         xor_(reg_offt_src0_,
                 reg_offt_src0_); // offt_src0 to get addr of src0/dst
         if (!conf_.is_src_different_layouts)
             xor_(reg_offt_src1_,
                     reg_offt_src1_); // offt_src1 to get addr of src1
-        if (conf_.use_stride_rhs_postops && !conf_.is_i8)
+        if (conf_.use_stride_rhs_postops && !use_offt_dst_)
             xor_(reg_off_rhs_postops_, reg_off_rhs_postops_);
     }
     const auto alg = pd_->desc()->alg_kind;
@@ -605,12 +606,14 @@ void jit_uni_binary_kernel_t<isa, Vmm>::forward() {
         if (conf_.is_i8) {
             if (!conf_.broadcast_src1_value && !conf_.is_src_different_layouts)
                 add(reg_offt_src1_, offt * src1_type_size);
-            add(reg_offt_dst_, offt);
         } else {
             if (conf_.use_stride_src1 && !conf_.is_src_different_layouts)
                 add(reg_offt_src1_, offt * src1_type_size);
-            if (conf_.use_stride_rhs_postops) add(reg_off_rhs_postops_, offt);
         }
+        if (use_offt_dst_)
+            add(reg_offt_dst_, offt * dst_type_size);
+        else if (conf_.use_stride_rhs_postops)
+            add(reg_off_rhs_postops_, offt);
         jmp(unroll_loop);
     }
 
@@ -625,13 +628,14 @@ void jit_uni_binary_kernel_t<isa, Vmm>::forward() {
         if (conf_.is_i8) {
             if (!conf_.broadcast_src1_value && !conf_.is_src_different_layouts)
                 add(reg_offt_src1_, simd_w_ * src1_type_size);
-            add(reg_offt_dst_, simd_w_);
         } else {
             if (conf_.use_stride_src1 && !conf_.is_src_different_layouts)
                 add(reg_offt_src1_, simd_w_ * src1_type_size);
-            if (conf_.use_stride_rhs_postops)
-                add(reg_off_rhs_postops_, simd_w_);
         }
+        if (use_offt_dst_)
+            add(reg_offt_dst_, simd_w_ * dst_type_size);
+        else if (conf_.use_stride_rhs_postops)
+            add(reg_off_rhs_postops_, simd_w_);
 
         jmp(unroll_loop_tail);
     }
@@ -645,12 +649,10 @@ void jit_uni_binary_kernel_t<isa, Vmm>::forward() {
         // need to increase if forward over outer dims
         if (is_src1_outer_dims_tail_) {
             add(reg_offt_src0_, tail_size_ * src0_type_size);
-            if (conf_.is_i8)
-                add(reg_offt_dst_, tail_size_);
-            else {
-                if (conf_.use_stride_rhs_postops)
-                    add(reg_off_rhs_postops_, tail_size_);
-            }
+            if (use_offt_dst_)
+                add(reg_offt_dst_, tail_size_ * dst_type_size);
+            else if (conf_.use_stride_rhs_postops)
+                add(reg_off_rhs_postops_, tail_size_);
         }
     }
 
@@ -666,12 +668,13 @@ void jit_uni_binary_kernel_t<isa, Vmm>::forward_over_outer_dims() {
     if (conf_.is_i8 || conf_.dst_type == data_type::s32) {
         uni_vpxor(vreg_zero_, vreg_zero_, vreg_zero_);
         io_.init_saturate_f32({conf_.dst_type});
-        xor_(reg_offt_dst_, reg_offt_dst_); // offt_dst to get addr of dst
     }
+    if (use_offt_dst_)
+        xor_(reg_offt_dst_, reg_offt_dst_); // offt_dst to get addr of dst
 
     xor_(reg_offt_src0_,
             reg_offt_src0_); // offt_src0 to get addr of src0/dst
-    if (conf_.use_stride_rhs_postops && !conf_.is_i8)
+    if (conf_.use_stride_rhs_postops && !use_offt_dst_)
         xor_(reg_off_rhs_postops_, reg_off_rhs_postops_);
 
     Label c_loop;
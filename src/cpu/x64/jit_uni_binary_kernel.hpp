@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021-2023 Intel Corporation
+* Copyright 2021-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -120,6 +120,8 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     const size_t unroll_regs_ = is_avx512 ? 8 : 4;
     const size_t offt_src0_;
     const size_t offt_src1_;
+    // dst has its own offset when its data type differs from the src0 one.
+    const bool use_offt_dst_;
 
     static constexpr cpu_isa_t inject_isa
             = isa == avx512_core_bf16 ? avx512_core : isa;
@@ -135,6 +137,9 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     Address src0_ptr(size_t offt = 0);
     Address src1_ptr(size_t offt = 0);
     Address dst_ptr(size_t offt = 0);
+    const Reg64 &reg_offt_dst() const {
+        return use_offt_dst_ ? reg_offt_dst_ : reg_offt_src0_;
+    }
     unsigned int cmp_predicate(alg_kind_t alg);
     void perform_op(
             const Vmm &v0, const Vmm &v1, const Vmm &s_src0, const Vmm &s_src1);
@@ -116,6 +116,7 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         , use_shift_(pd_->use_shift())
         , save_stats_(pd_->is_training())
         , calculate_stats_(!pd_->stats_are_src())
+        , skip_mean_(pd_->skip_mean())
         , eps_(pd_->desc()->layer_norm_epsilon)
         , has_ne_convert_src_xf16_(isa == avx2 && mayiuse(avx2_vnni_2)
                   && utils::one_of(src_d_.data_type(), data_type::f16,
@@ -179,6 +180,7 @@ protected:
     const bool use_shift_;
     const bool save_stats_;
     const bool calculate_stats_;
+    const bool skip_mean_;
     const float eps_;
     const bool has_ne_convert_src_xf16_;
     bool with_postops_ = false;
@@ -412,13 +414,15 @@ protected:
         if (has_ne_convert_src_xf16_)
             compute_ne_convert_xf16(vmm_inv_sqrtvar,
                     [&](Vmm vmm_dst, Vmm vmm_src, bool need_tail) {
-                        uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
+                        if (!skip_mean_)
+                            uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
                         uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
                     });
         else
             compute(vmm_inv_sqrtvar,
                     [&](Vmm vmm_dst, Vmm vmm_src, bool need_tail) {
-                        uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
+                        if (!skip_mean_)
+                            uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
                         uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
                     });
         if (save_stats_)
@@ -439,7 +443,7 @@ protected:
             if (use_shift_)
                 io_[f32]->load(
                         shift_ptr(offt_elems + j * simd_w_), vmm_shift, tail);
-            uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
+            if (!skip_mean_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
             uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
             if (use_scale_ && use_shift_)
                 uni_vfmadd213ps(vmm_dst, vmm_scale, vmm_shift);
@@ -483,7 +487,7 @@ protected:
             io_[f32]->load(shift_ptr(offt_elems), vmm_shift, tail);
         }
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_dst, tail);
-        uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
+        if (!skip_mean_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
         uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
         if (use_scale_ && use_shift_)
             uni_vfmadd213ps(vmm_dst, vmm_scale, vmm_shift);
@@ -572,7 +576,7 @@ protected:
         mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
         mov(reg_scale, ptr[reg_param + PARAM_OFF(scale)]);
         mov(reg_shift, ptr[reg_param + PARAM_OFF(shift)]);
-        mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+        if (!skip_mean_) mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
         mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
         mov(reg_src_scales, ptr[reg_param + PARAM_OFF(src_scales)]);
         mov(reg_dst_scales, ptr[reg_param + PARAM_OFF(dst_scales)]);
@@ -599,13 +603,15 @@ protected:
             jle(end, T_NEAR);
 
             if (calculate_stats_) {
-                // compute stats
-                compute_mean();
+                // compute stats, the mean is zero for rms normalization
+                if (!skip_mean_) compute_mean();
                 compute_var();
             } else {
                 // read mean and var from input
-                uni_vmovss(xmm_tmp, dword[reg_mean]);
-                uni_vbroadcastss(vmm_mean, xmm_tmp);
+                if (!skip_mean_) {
+                    uni_vmovss(xmm_tmp, dword[reg_mean]);
+                    uni_vbroadcastss(vmm_mean, xmm_tmp);
+                }
                 uni_vmovss(xmm_tmp, dword[reg_var]);
                 uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
             }
@@ -622,7 +628,7 @@ protected:
 
             add(reg_src, c_src_size);
             add(reg_dst, c_dst_size);
-            add(reg_mean, float_size);
+            if (!skip_mean_) add(reg_mean, float_size);
             add(reg_var, float_size);
             jmp(unroll_loop);
         }
@@ -742,6 +748,7 @@ struct jit_diff_ss_kernel_t : diff_ss_kernel_t, public jit_generator {
         , C_(pd_->norm_axis())
         , axis_simd_full_(C_ / simd_w_)
         , axis_simd_tail_(C_ % simd_w_)
+        , skip_mean_(pd_->skip_mean())
         , eps_(pd_->desc()->layer_norm_epsilon) {
 
         io::io_conf_t io_conf;
@@ -781,6 +788,7 @@ protected:
     const dim_t C_;
     const dim_t axis_simd_full_;
     const dim_t axis_simd_tail_;
+    const bool skip_mean_;
     const float eps_;
 
     const Reg64 reg_param = abi_param1;
@@ -831,7 +839,7 @@ protected:
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
 
         uni_vaddps(vmm_dshift, vmm_dshift, vmm_ddst);
-        uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        if (!skip_mean_) uni_vsubps(vmm_src, vmm_src, vmm_mean);
         uni_vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
         uni_vfmadd231ps(vmm_dscale, vmm_src, vmm_ddst);
 
@@ -856,7 +864,7 @@ protected:
         mov(reg_diff_dst, ptr[reg_param + PARAM_OFF(diff_dst)]);
         mov(reg_diff_scale, ptr[reg_param + PARAM_OFF(diff_scale)]);
         mov(reg_diff_shift, ptr[reg_param + PARAM_OFF(diff_shift)]);
-        mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+        if (!skip_mean_) mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
         mov(reg_inv_sqrtvar, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
         mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
 #undef PARAM_OFF
@@ -870,8 +878,10 @@ protected:
             cmp(reg_block_end, reg_src);
             jle(end, T_NEAR);
 
-            uni_vmovss(xmm_tmp, dword[reg_mean]);
-            uni_vbroadcastss(vmm_mean, xmm_tmp);
+            if (!skip_mean_) {
+                uni_vmovss(xmm_tmp, dword[reg_mean]);
+                uni_vbroadcastss(vmm_mean, xmm_tmp);
+            }
             uni_vmovss(xmm_tmp, dword[reg_inv_sqrtvar]);
             uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
 
@@ -882,7 +892,7 @@ protected:
 
             add(reg_src, c_src_size);
             add(reg_diff_dst, c_ddst_size);
-            add(reg_mean, float_size);
+            if (!skip_mean_) add(reg_mean, float_size);
             add(reg_inv_sqrtvar, float_size);
             jmp(unroll_loop);
         }
@@ -936,7 +946,8 @@ struct jit_diff_data_base_kernel_t : diff_data_kernel_t, public jit_generator {
         , axis_simd_tail_(C_ % simd_w_)
         , use_scale_(pd_->use_scale())
         , use_shift_(pd_->use_shift())
-        , calculate_diff_stats_(!pd_->stats_are_src()) {
+        , calculate_diff_stats_(!pd_->stats_are_src())
+        , skip_mean_(pd_->skip_mean()) {
 
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
@@ -982,6 +993,7 @@ protected:
     const bool use_scale_;
     const bool use_shift_;
     const bool calculate_diff_stats_;
+    const bool skip_mean_;
 
     const Reg64 reg_param = abi_param1;
     const Reg64 reg_src = rdx;
@@ -1040,8 +1052,12 @@ protected:
         }
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
 
-        uni_vaddps(vmm_dd_scale, vmm_dd_scale, vmm_ddst);
-        uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        // the mean doesn't depend on src with rms normalization, so
+        // dd_scale is kept zero
+        if (!skip_mean_) {
+            uni_vaddps(vmm_dd_scale, vmm_dd_scale, vmm_ddst);
+            uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        }
         uni_vfmadd231ps(vmm_dd_scale_x, vmm_ddst, vmm_src);
     };
 
@@ -1054,7 +1070,7 @@ protected:
         }
         if (calculate_diff_stats_) {
             io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
-            uni_vsubps(vmm_src, vmm_src, vmm_mean);
+            if (!skip_mean_) uni_vsubps(vmm_src, vmm_src, vmm_mean);
             uni_vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
             uni_vfmadd213ps(vmm_src, vmm_dd_scale_x, vmm_dd_scale);
             uni_vdivps(vmm_src, vmm_src, vmm_C);
@@ -1084,7 +1100,7 @@ protected:
         mov(reg_diff_src, ptr[reg_param + PARAM_OFF(diff_src)]);
         mov(reg_scale, ptr[reg_param + PARAM_OFF(ss)]);
 
-        if (calculate_diff_stats_)
+        if (calculate_diff_stats_ && !skip_mean_)
             mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
         mov(reg_inv_sqrtvar, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
         mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
@@ -1107,8 +1123,10 @@ protected:
             uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
 
             if (calculate_diff_stats_) {
-                uni_vmovss(xmm_tmp, dword[reg_mean]);
-                uni_vbroadcastss(vmm_mean, xmm_tmp);
+                if (!skip_mean_) {
+                    uni_vmovss(xmm_tmp, dword[reg_mean]);
+                    uni_vbroadcastss(vmm_mean, xmm_tmp);
+                }
 
                 uni_vpxor(vmm_dd_scale, vmm_dd_scale, vmm_dd_scale);
                 uni_vpxor(vmm_dd_scale_x, vmm_dd_scale_x, vmm_dd_scale_x);
@@ -1131,7 +1149,8 @@ protected:
             add(reg_src, c_src_size);
             add(reg_diff_dst, c_ddst_size);
             add(reg_diff_src, c_dsrc_size);
-            if (calculate_diff_stats_) add(reg_mean, float_size);
+            if (calculate_diff_stats_ && !skip_mean_)
+                add(reg_mean, float_size);
             add(reg_inv_sqrtvar, float_size);
             jmp(unroll_loop);
         }
@@ -1296,7 +1315,8 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
         char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
                 + N_start * C_padded * dst_d.data_type_size();
         const int block_size = N_end - N_start;
-        (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, &mean[N_start],
+        float *const mean_ptr = mean ? &mean[N_start] : nullptr;
+        (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, mean_ptr,
                 &variance[N_start], src_scales, dst_scales,
                 post_ops_binary_rhs_arg_vec.data(), block_size);
     });
@@ -1364,8 +1384,9 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
             my_diff_gamma[c] = 0.;
             my_diff_beta[c] = 0.;
         }
+        const float *const mean_ptr = mean ? &mean[N_start] : nullptr;
         (*diff_ss_kernel_)(src_ptr, diff_dst_ptr, my_diff_gamma, my_diff_beta,
-                &mean[N_start], &variance[N_start], &inv_sqrtvar[N_start],
+                mean_ptr, &variance[N_start], &inv_sqrtvar[N_start],
                 block_size);
     });
 
@@ -1392,8 +1413,9 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
         char *const __restrict diff_src_ptr = reinterpret_cast<char *>(diff_src)
                 + N_start * C_padded * diff_src_d.data_type_size();
 
+        const float *const mean_ptr = mean ? &mean[N_start] : nullptr;
         (*diff_data_kernel_)(src_ptr, diff_dst_ptr, diff_src_ptr, scale,
-                &mean[N_start], &inv_sqrtvar[N_start], block_size);
+                mean_ptr, &inv_sqrtvar[N_start], block_size);
     });
     return status::success;
 }
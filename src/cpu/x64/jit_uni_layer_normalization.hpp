@@ -157,10 +157,11 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
         memory_t variance(
                 engine, &(pd()->reordered_stat_md_), std::move(variance_mem));
 
-        // reorder input stats
+        // reorder input stats, there's no mean for rms normalization
         if (pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, ctx.args().at(DNNL_ARG_MEAN), {&mean, false});
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {&mean, false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {&variance, false});
         }
@@ -168,8 +169,9 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
         if (status != status::success) return status;
         // reorder output stats
         if (!pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, {&mean, true}, ctx.args().at(DNNL_ARG_MEAN));
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, {&mean, true},
+                        ctx.args().at(DNNL_ARG_MEAN));
             reorder_stat(ctx, engine, {&variance, true},
                     ctx.args().at(DNNL_ARG_VARIANCE));
         }
@@ -319,8 +321,9 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
                     engine, &(pd()->reordered_stat_md_), std::move(mean_mem));
             memory_t variance(engine, &(pd()->reordered_stat_md_),
                     std::move(variance_mem));
-            reorder_stat(
-                    ctx, engine, ctx.args().at(DNNL_ARG_MEAN), {&mean, false});
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {&mean, false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {&variance, false});
         }
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <atomic>
 #include <numeric>
 
 #include "oneapi/dnnl/dnnl_debug.h"
@@ -28,6 +29,8 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/reorder/cpu_reorder_pd.hpp"
 #include "cpu/x64/jit_uni_reorder.hpp"
 
@@ -644,14 +647,17 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         };
 
         auto io_store = [&](const Vmm &vmm, const Xbyak::Address &dst_addr,
-                                const bool tail) {
-            if (!zmm_io_.empty())
-                zmm_io_[prb_.otype]->store(Zmm(vmm.getIdx()), dst_addr, tail);
-            else if (!ymm_io_.empty())
-                ymm_io_[prb_.otype]->store(Ymm(vmm.getIdx()), dst_addr, tail);
+                                const bool tail, const bool nt) {
+            auto &zmm_io = nt ? zmm_nt_io_ : zmm_io_;
+            auto &ymm_io = nt ? ymm_nt_io_ : ymm_io_;
+            auto &xmm_io = nt ? xmm_nt_io_ : xmm_io_;
+            if (!zmm_io.empty())
+                zmm_io[prb_.otype]->store(Zmm(vmm.getIdx()), dst_addr, tail);
+            else if (!ymm_io.empty())
+                ymm_io[prb_.otype]->store(Ymm(vmm.getIdx()), dst_addr, tail);
             else {
-                assert(!xmm_io_.empty());
-                xmm_io_[prb_.otype]->store(Xmm(vmm.getIdx()), dst_addr, tail);
+                assert(!xmm_io.empty());
+                xmm_io[prb_.otype]->store(Xmm(vmm.getIdx()), dst_addr, tail);
             }
         };
 
@@ -668,28 +674,49 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
 
         io_init_saturate_f32({prb_.otype});
 
-        int off = 0;
-        for (; off + len_tail < len_unroll;) {
-            int n_vregs_to_process_len_unroll = (len_unroll - off) / simd_w;
-            int unroll = nstl::min(max_unroll, n_vregs_to_process_len_unroll);
+        auto copy = [&](const bool nt) {
+            int off = 0;
+            for (; off + len_tail < len_unroll;) {
+                int n_vregs_to_process_len_unroll
+                        = (len_unroll - off) / simd_w;
+                int unroll
+                        = nstl::min(max_unroll, n_vregs_to_process_len_unroll);
+
+                for (int ur = 0; ur < unroll; ++ur) {
+                    const auto vmm = Vmm(ur);
+                    io_load(i_addr(off + ur * simd_w), vmm, false);
+                    io_store(vmm, o_addr(off + ur * simd_w), false, nt);
+                }
 
-            for (int ur = 0; ur < unroll; ++ur) {
-                const auto vmm = Vmm(ur);
-                io_load(i_addr(off + ur * simd_w), vmm, false);
-                io_store(vmm, o_addr(off + ur * simd_w), false);
+                off += unroll * simd_w;
+                assert(off <= len_unroll);
             }
 
-            off += unroll * simd_w;
-            assert(off <= len_unroll);
-        }
+            if (len_tail) {
+                io_prepare_tail_mask();
+                const auto vmm = Vmm(tail_vmm_idx + 1);
+                io_load(i_addr(off), vmm, true);
+                io_store(vmm, o_addr(off), true, false);
+            }
+        };
 
-        if (len_tail) {
-            io_prepare_tail_mask();
-            const auto vmm = Vmm(tail_vmm_idx + 1);
-            io_load(i_addr(off), vmm, true);
-            io_store(vmm, o_addr(off), true);
+        if (!use_nt_stores_) {
+            copy(false);
+            return true;
         }
 
+        // The non-temporal stores require the output to be aligned by the
+        // size of a store, otherwise the regular stores are used.
+        Label regular_store, end_store;
+        lea(reg_tmp_, o_addr(0));
+        test(reg_tmp_, simd_w * otype_sz_ - 1);
+        jnz(regular_store, T_NEAR);
+        copy(true);
+        jmp(end_store, T_NEAR);
+        L(regular_store);
+        copy(false);
+        L(end_store);
+
         return true;
     }
 
@@ -1735,7 +1762,6 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
             assert(zero_idx >= max_unroll);
             assert(saturation_ubound_idx >= max_unroll);
 
-            io::io_conf_t io_conf;
             io::io_tail_conf_t io_tail_conf(simd_w, len_unroll % simd_w,
                     tail_opmask_idx, tail_vmm_idx, reg_tmp_);
             io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx_,
@@ -1748,25 +1774,36 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
             io::io_saturation_conf_t io_saturation_conf(
                     zero_idx, saturation_ubound_idx, reg_tmp_);
 
-            if (is_superset(isa_, avx512_core)) {
-                zmm_io_ = io::jit_io_multi_dt_helper_t<Zmm>(this, isa_,
-                        {prb_.itype, prb_.otype}, io_conf, io_tail_conf,
-                        io_bf16_conf, {{prb_.otype, io_saturation_conf}},
-                        utils::nullopt, io_fp8_conf);
-            } else if (
-                    is_superset(isa_,
-                            avx) /* s8u8 with AVX should be used with XMM vreg */
-                    && IMPLICATION(isa_ == avx, !is_i8)) {
-                ymm_io_ = io::jit_io_multi_dt_helper_t<Ymm>(this, isa_,
-                        {prb_.itype, prb_.otype}, io_conf, io_tail_conf,
-                        io_bf16_conf, {{prb_.otype, io_saturation_conf}},
-                        utils::nullopt, io_fp8_conf);
-            } else {
-                xmm_io_ = io::jit_io_multi_dt_helper_t<Xmm>(this, isa_,
-                        {prb_.itype, prb_.otype}, io_conf, io_tail_conf,
-                        io_bf16_conf, {{prb_.otype, io_saturation_conf}},
-                        utils::nullopt, io_fp8_conf);
-            }
+            auto init_io = [&](const io::io_conf_t &io_conf,
+                                   io::jit_io_multi_dt_helper_t<Zmm> &zmm_io,
+                                   io::jit_io_multi_dt_helper_t<Ymm> &ymm_io,
+                                   io::jit_io_multi_dt_helper_t<Xmm> &xmm_io) {
+                if (is_superset(isa_, avx512_core)) {
+                    zmm_io = io::jit_io_multi_dt_helper_t<Zmm>(this, isa_,
+                            {prb_.itype, prb_.otype}, io_conf, io_tail_conf,
+                            io_bf16_conf, {{prb_.otype, io_saturation_conf}},
+                            utils::nullopt, io_fp8_conf);
+                } else if (is_superset(isa_, avx)
+                        // s8u8 with AVX should be used with XMM vreg
+                        && IMPLICATION(isa_ == avx, !is_i8)) {
+                    ymm_io = io::jit_io_multi_dt_helper_t<Ymm>(this, isa_,
+                            {prb_.itype, prb_.otype}, io_conf, io_tail_conf,
+                            io_bf16_conf, {{prb_.otype, io_saturation_conf}},
+                            utils::nullopt, io_fp8_conf);
+                } else {
+                    xmm_io = io::jit_io_multi_dt_helper_t<Xmm>(this, isa_,
+                            {prb_.itype, prb_.otype}, io_conf, io_tail_conf,
+                            io_bf16_conf, {{prb_.otype, io_saturation_conf}},
+                            utils::nullopt, io_fp8_conf);
+                }
+            };
+            init_io(io::io_conf_t(), zmm_io_, ymm_io_, xmm_io_);
+
+            // The non-temporal stores can't store a tail.
+            use_nt_stores_ = desc.use_nt_stores && len_unroll % simd_w == 0;
+            if (use_nt_stores_)
+                init_io(io::io_conf_t(true), zmm_nt_io_, ymm_nt_io_,
+                        xmm_nt_io_);
         }
     }
 
@@ -1847,6 +1884,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         impl();
 
         L(end_of_kernel);
+        // the non-temporal stores are weakly ordered
+        if (use_nt_stores_) sfence();
         postamble();
 
         const bool is_fp8_itype = utils::one_of(
@@ -1942,6 +1981,12 @@ private:
     io::jit_io_multi_dt_helper_t<Xmm> xmm_io_;
     io::jit_io_multi_dt_helper_t<Ymm> ymm_io_;
     io::jit_io_multi_dt_helper_t<Zmm> zmm_io_;
+    // The same helpers with the non-temporal stores used by the direct copy
+    // of the output aligned by the size of a store.
+    bool use_nt_stores_ = false;
+    io::jit_io_multi_dt_helper_t<Xmm> xmm_nt_io_;
+    io::jit_io_multi_dt_helper_t<Ymm> ymm_nt_io_;
+    io::jit_io_multi_dt_helper_t<Zmm> zmm_nt_io_;
 };
 
 // Seperate class for no unroll/threading burden
@@ -2318,6 +2363,14 @@ kernel_t *kernel_t::create(const kernel_t::desc_t &desc) {
 
 } // namespace tr
 
+// the output size above which the non-temporal stores are used, 0 for the
+// total LLC size of the threads
+static std::atomic<size_t> nt_stores_threshold {0};
+
+void set_reorder_nt_stores_threshold(size_t threshold) {
+    nt_stores_threshold = threshold;
+}
+
 static void prb_block_for_cache(tr::prb_t &prb) {
     /* If strides for 0th and 1st nodes are cache friendly
      * then one can altogether do away with blocking ! */
@@ -2411,6 +2464,40 @@ static void prb_block_for_cache(tr::prb_t &prb) {
     }
 }
 
+/** returns the number of parts a node of size n is split into to give more
+ * work to the parallel driver, which already has size_drv parts. The number
+ * is a divisor of n not less than size_min. The smallest such divisor is
+ * the default, but a divisor up to size_max is preferred if it distributes
+ * the driver parts over the threads more evenly, e.g. 160 parts instead of
+ * 64 for 56 threads. Returns n if the node cannot be split. */
+static size_t prb_balanced_split_size(size_t n, size_t size_min,
+        size_t size_max, size_t size_drv, int nthr) {
+    size_t split = size_min;
+    for (; split < n && n % split; ++split)
+        ;
+    if (split >= n) return n;
+    if (nthr == 1) return split;
+
+    auto efficiency = [&](size_t parts) {
+        const size_t size_drv_split = size_drv * parts;
+        return static_cast<double>(size_drv_split)
+                / utils::rnd_up(size_drv_split, nthr);
+    };
+
+    double best_efficiency = efficiency(split);
+    for (size_t parts = split + 1;
+            parts <= nstl::min(size_max, n - 1) && best_efficiency < 1.;
+            ++parts) {
+        if (n % parts) continue;
+        const double parts_efficiency = efficiency(parts);
+        if (parts_efficiency > best_efficiency) {
+            best_efficiency = parts_efficiency;
+            split = parts;
+        }
+    }
+    return split;
+}
+
 /** finds the maximum number of dimension the kernel should process and
  * optionally splits one of the dimension to achieve better balance between
  * parallel driver and the kernel. */
@@ -2490,13 +2577,25 @@ static void prb_thread_kernel_balance(
             want_borrow_ker_from_drv, want_borrow_drv_from_ker);
 
     if (want_borrow_drv_from_ker) {
-        size_t size_want_borrow = utils::div_up(size_drv_min, size_drv_cur);
-        for (; prb.nodes[kdims - 1].n % size_want_borrow; ++size_want_borrow)
-            ;
-
-        if (size_want_borrow != prb.nodes[kdims - 1].n)
+        /* The outermost kernel dimension may be split into more parts than
+         * needed, as long as the kernel size stays above
+         * tr::ker_prb_size_min, so that the parts are distributed evenly
+         * among the threads. It matters for huge tensors with a few large
+         * dimensions, e.g. direct copy of a 2D weights matrix, where
+         * splitting into the smallest number of parts not less than nthr
+         * may leave some threads with twice as much work as the others. */
+        const size_t size_want_borrow
+                = utils::div_up(size_drv_min, size_drv_cur);
+        const size_t size_max_borrow = nstl::max(size_want_borrow,
+                nstl::min(8 * size_want_borrow,
+                        size_ker_cur / tr::ker_prb_size_min));
+        const size_t size_borrow
+                = prb_balanced_split_size(prb.nodes[kdims - 1].n,
+                        size_want_borrow, size_max_borrow, size_drv_cur, nthr);
+
+        if (size_borrow != prb.nodes[kdims - 1].n)
             prb_node_split(
-                    prb, kdims - 1, prb.nodes[kdims - 1].n / size_want_borrow);
+                    prb, kdims - 1, prb.nodes[kdims - 1].n / size_borrow);
     }
 
     ndims_ker_max = kdims;
@@ -2585,6 +2684,21 @@ status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
             = tr::kernel_t::desc_init(ker_desc, prb, ndims_ker_max);
     if (ker_init_status != status::success) return ker_init_status;
 
+    // The output larger than the LLC is streamed to memory by non-temporal
+    // stores, which neither evict the cached data nor read the output lines
+    // before writing them. Only the direct copy kernel uses them: the other
+    // kernels (e.g. a plain to blocked weights reorder) store partial vectors
+    // and single elements at the strides of the output, so a cache line is
+    // completed by many stores far apart in time. Such lines are flushed from
+    // the write-combining buffers partially filled, which is slower than the
+    // regular stores. The weights reorders are also done once and cached by
+    // the frameworks, so they gain little from streaming the output.
+    const size_t nt_threshold = nt_stores_threshold != 0
+            ? nt_stores_threshold.load()
+            : static_cast<size_t>(nthr) * platform::get_per_core_cache_size(3);
+    ker_desc.use_nt_stores
+            = memory_desc_wrapper(dst_md).size() > nt_threshold;
+
     const int ndims_driver = prb.ndims - ker_desc.prb.ndims;
     VDISPATCH_REORDER_IC(ndims_driver <= jit_uni_reorder_t::ndims_driver_max,
             VERBOSE_BAD_NDIMS, "driver", ndims_driver);
@@ -2964,11 +3078,70 @@ status_t jit_uni_reorder_t::init(engine_t *engine) {
     return kernel_->create_kernel();
 }
 
+// Computes the destination scales of the dynamic quantization. A scale is
+// the maximum absolute value of the source slice it applies to divided by the
+// maximum value of the destination data type. Each thread reduces its own
+// range of the scales reading the source row by row.
+void jit_uni_reorder_t::compute_dst_dyn_scales(
+        const char *in, float *dst_scales) const {
+    const memory_desc_wrapper id(pd()->src_md());
+    const int mask = pd()->attr()->scales_.get(DNNL_ARG_DST).mask_;
+    dim_t D_start = 1, D_mask = 1, D_rest = 1;
+    pd()->get_D_values(id, mask, &D_start, &D_mask, &D_rest);
+
+    // The logical offset is used as is for the plain source with the dense
+    // logical order of the dimensions.
+    bool is_abx = id.is_plain();
+    dim_t dense_stride = 1;
+    for (int d = id.ndims() - 1; d >= 0 && is_abx; --d) {
+        is_abx = id.blocking_desc().strides[d] == dense_stride;
+        dense_stride *= id.dims()[d];
+    }
+
+    const data_type_t idt = id.data_type();
+    const dim_t off0 = id.offset0();
+    const float qmax = types::max_value<float>(pd()->dst_md()->data_type);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t m_start = 0, m_end = 0;
+        balance211(D_mask, nthr, ithr, m_start, m_end);
+        if (m_start >= m_end) return;
+
+        for (dim_t m = m_start; m < m_end; ++m)
+            dst_scales[m] = 0.f;
+        for_(dim_t s = 0; s < D_start; ++s)
+        for (dim_t m = m_start; m < m_end; ++m) {
+            float amax = dst_scales[m];
+            for (dim_t r = 0; r < D_rest; ++r) {
+                const dim_t l_off = (s * D_mask + m) * D_rest + r;
+                const dim_t off = is_abx ? off0 + l_off : id.off_l(l_off);
+                const float v = cpu::io::load_float_value(idt, in, off);
+                amax = nstl::max(amax, nstl::abs(v));
+            }
+            dst_scales[m] = amax;
+        }
+        // An all-zero slice is quantized with the unit scale.
+        for (dim_t m = m_start; m < m_end; ++m)
+            dst_scales[m] = dst_scales[m] > 0.f ? dst_scales[m] / qmax : 1.f;
+    });
+}
+
 status_t jit_uni_reorder_t::execute(const exec_ctx_t &ctx) const {
     const auto &scratchpad = ctx.get_scratchpad_grantor();
 
     auto in = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
     auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+
+    // The dynamic quantization scales are computed before they are read as
+    // regular destination scales.
+    if (!pd()->attr()->dst_dyn_quant_.has_default_values()) {
+        auto dyn_scales
+                = CTX_OUT_MEM(float *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+        VCHECK_ATTR(dyn_scales != nullptr,
+                "Scales buffer for arg %d is missing", DNNL_ARG_DST);
+        compute_dst_dyn_scales(in, dyn_scales);
+    }
+
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(dst_scales_, DNNL_ARG_DST);
 
@@ -2994,6 +3167,8 @@ status_t jit_blk_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
 
     status_t prb_init_status = prb_init(prb, *src_md, *dst_md, attr);
     if (prb_init_status != status::success) return prb_init_status;
+    VDISPATCH_REORDER_IC(attr->dst_dyn_quant_.has_default_values(),
+            VERBOSE_UNSUPPORTED_ATTR);
     // only uni_reorder supports tail processing now
     // TODO: Add tail processing support in blk_reorder
     VDISPATCH_REORDER_IC(
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2018-2023 Intel Corporation
+* Copyright 2018-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -176,6 +176,9 @@ struct kernel_t {
     struct desc_t {
         int id;
         prb_t prb;
+        // whether the output is stored by non-temporal stores where possible,
+        // which is the direct copy of an aligned output only
+        bool use_nt_stores = false;
     };
 
     kernel_t(const desc_t &desc)
@@ -270,6 +273,8 @@ private:
             const int32_t *compensation_reduce_scratch, const int nthr,
             const dim_t wspace_per_thr_size) const;
 
+    void compute_dst_dyn_scales(const char *in, float *dst_scales) const;
+
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::unique_ptr<tr::kernel_t> kernel_;
 };
@@ -304,6 +309,11 @@ private:
     std::unique_ptr<tr::jit_single_blk_kernel_t> kernel_;
 };
 
+// Sets the output size in bytes above which the reorder uses non-temporal
+// stores, 0 restores the default of the total LLC size of the threads. The
+// value is taken at the primitive descriptor creation. For testing only.
+void DNNL_API set_reorder_nt_stores_threshold(size_t threshold);
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -205,7 +205,8 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
             && attr->has_default_values(
                     primitive_attr_t::skip_mask_t::scales_runtime
                     | primitive_attr_t::skip_mask_t::zero_points_runtime
-                    | primitive_attr_t::skip_mask_t::post_ops)
+                    | primitive_attr_t::skip_mask_t::post_ops
+                    | primitive_attr_t::skip_mask_t::dst_dyn_quant)
             && check_post_ops(attr);
     if (!ok) return unimplemented;
 
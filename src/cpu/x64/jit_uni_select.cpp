@@ -0,0 +1,239 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_uni_select.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace data_type;
+
+static cpu_isa_t get_supported_isa() {
+    if (mayiuse(avx512_core_fp16)) return avx512_core_fp16;
+    if (mayiuse(avx512_core_bf16)) return avx512_core_bf16;
+    if (mayiuse(avx512_core)) return avx512_core;
+    if (mayiuse(avx2_vnni_2)) return avx2_vnni_2;
+    if (mayiuse(avx2)) return avx2;
+
+    return isa_undef;
+}
+
+static bool data_type_supported(const data_type_t dt, const cpu_isa_t isa) {
+    switch (dt) {
+        case bf16:
+            return is_superset(isa, avx512_core) || isa == avx2_vnni_2;
+        case f16:
+            return is_superset(isa, avx512_core_fp16) || isa == avx2_vnni_2;
+        case f32: return true;
+        default: return false;
+    }
+}
+
+status_t jit_uni_select_t::pd_t::init(engine_t *engine) {
+    VDISPATCH_BINARY(is_ternary_op(), VERBOSE_BAD_ALGORITHM);
+
+    conf_.isa = get_supported_isa();
+    VDISPATCH_BINARY(conf_.isa != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    for (int i = 0; i < 3; i++)
+        conf_.src_type[i] = src_md(i)->data_type;
+    conf_.dst_type = dst_md()->data_type;
+
+    // The condition data type is checked at the descriptor creation.
+    VDISPATCH_BINARY(data_type_supported(conf_.src_type[0], conf_.isa),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_BINARY(data_type_supported(conf_.src_type[1], conf_.isa),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_BINARY(data_type_supported(conf_.dst_type, conf_.isa),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_BINARY(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_BINARY(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_BINARY(
+            attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_BINARY(init_blocking(), VERBOSE_BLOCKING_FAIL, "");
+
+    return status::success;
+}
+
+bool jit_uni_select_t::pd_t::init_blocking() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const memory_desc_wrapper src_d[3]
+            = {memory_desc_wrapper(src_md(0)), memory_desc_wrapper(src_md(1)),
+                    memory_desc_wrapper(src_md(2))};
+
+    const auto is_plain = [](const memory_desc_wrapper &mdw) {
+        return mdw.is_blocking_desc() && mdw.blocking_desc().inner_nblks == 0;
+    };
+    if (!is_plain(dst_d)) return false;
+    for (int i = 0; i < 3; i++)
+        if (!is_plain(src_d[i])) return false;
+
+    // The dimensions of size 1 do not affect the layout, the others are
+    // ordered by the dst strides, the outermost first.
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+    std::vector<int> dims_order;
+    for (int d = 0; d < ndims(); d++)
+        if (dst_d.dims()[d] > 1) dims_order.push_back(d);
+    std::stable_sort(dims_order.begin(), dims_order.end(),
+            [&](int a, int b) { return dst_strides[a] > dst_strides[b]; });
+    const int nactive = (int)dims_order.size();
+
+    // Every tensor must be dense in that order, with its broadcast dimensions
+    // skipped.
+    const auto is_dense = [&](const memory_desc_wrapper &mdw) {
+        dim_t stride = 1;
+        for (int i = nactive - 1; i >= 0; i--) {
+            const int d = dims_order[i];
+            if (mdw.dims()[d] == 1) continue;
+            if (mdw.blocking_desc().strides[d] != stride) return false;
+            stride *= mdw.dims()[d];
+        }
+        return true;
+    };
+    if (!is_dense(dst_d)) return false;
+    for (int i = 0; i < 3; i++)
+        if (!is_dense(src_d[i])) return false;
+
+    if (nactive == 0) return false;
+
+    const auto is_bcast
+            = [&](int i, int d) { return src_d[i].dims()[d] == 1; };
+    const int innermost_d = dims_order[nactive - 1];
+
+    // The inner block is extended outwards while the sources keep being
+    // either present or broadcast.
+    int inner_ndims = 1;
+    for (; inner_ndims < nactive; inner_ndims++) {
+        const int d = dims_order[nactive - 1 - inner_ndims];
+        bool same_bcast = true;
+        for (int i = 0; i < 3; i++)
+            same_bcast = same_bcast
+                    && is_bcast(i, d) == is_bcast(i, innermost_d);
+        if (!same_bcast) break;
+    }
+
+    for (int i = 0; i < 3; i++)
+        conf_.bcast[i] = is_bcast(i, innermost_d);
+
+    conf_.inner_size = 1;
+    for (int i = nactive - inner_ndims; i < nactive; i++)
+        conf_.inner_size *= dst_d.dims()[dims_order[i]];
+    conf_.outer_size = dst_d.nelems() / conf_.inner_size;
+
+    conf_.outer_ndims = nactive - inner_ndims;
+    for (int o = 0; o < conf_.outer_ndims; o++) {
+        const int d = dims_order[o];
+        conf_.outer_dims[o] = dst_d.dims()[d];
+        for (int i = 0; i < 3; i++)
+            conf_.outer_strides[i][o] = is_bcast(i, d)
+                    ? 0
+                    : src_d[i].blocking_desc().strides[d];
+    }
+
+    // A kernel call per a few elements does not pay off, the reference
+    // implementation handles such shapes.
+    const dim_t simd_w = is_superset(conf_.isa, avx512_core) ? 16 : 8;
+    if (conf_.inner_size < simd_w) return false;
+
+    // The inner blocks are split between the threads when there are not
+    // enough of them to occupy every thread.
+    const dim_t min_block_size = 1024;
+    const dim_t nthr = dnnl_get_max_threads();
+    dim_t nparts = 1;
+    if (conf_.outer_size < nthr)
+        nparts = nstl::max<dim_t>(1,
+                nstl::min(utils::div_up(nthr, conf_.outer_size),
+                        conf_.inner_size / min_block_size));
+    conf_.block_size = utils::rnd_up(
+            utils::div_up(conf_.inner_size, nparts), simd_w);
+
+    return true;
+}
+
+status_t jit_uni_select_t::init(engine_t *engine) {
+    const auto &conf = pd()->get_conf();
+    if (is_superset(conf.isa, avx512_core))
+        CHECK(safe_ptr_assign(
+                kernel_, new jit_uni_select_kernel_t<Xbyak::Zmm>(conf)));
+    else
+        CHECK(safe_ptr_assign(
+                kernel_, new jit_uni_select_kernel_t<Xbyak::Ymm>(conf)));
+    return kernel_->create_kernel();
+}
+
+status_t jit_uni_select_t::execute(const exec_ctx_t &ctx) const {
+    const auto &conf = pd()->get_conf();
+
+    const char *src[3];
+    src[0] = CTX_IN_MEM(const char *, DNNL_ARG_SRC_0);
+    src[1] = CTX_IN_MEM(const char *, DNNL_ARG_SRC_1);
+    src[2] = CTX_IN_MEM(const char *, DNNL_ARG_SRC_2);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    dim_t src_offset0[3];
+    size_t src_dt_size[3];
+    for (int i = 0; i < 3; i++) {
+        const memory_desc_wrapper src_d(pd()->src_md(i));
+        src_offset0[i] = src_d.offset0();
+        src_dt_size[i] = src_d.data_type_size();
+    }
+    const dim_t dst_offset0 = dst_d.offset0();
+    const size_t dst_dt_size = dst_d.data_type_size();
+
+    const dim_t nparts = utils::div_up(conf.inner_size, conf.block_size);
+    parallel_nd(conf.outer_size, nparts, [&](dim_t outer, dim_t part) {
+        dim_t off[3] = {0, 0, 0};
+        dim_t rem = outer;
+        for (int o = conf.outer_ndims - 1; o >= 0; o--) {
+            const dim_t idx = rem % conf.outer_dims[o];
+            rem /= conf.outer_dims[o];
+            for (int i = 0; i < 3; i++)
+                off[i] += idx * conf.outer_strides[i][o];
+        }
+        const dim_t start = part * conf.block_size;
+
+        jit_select_call_s args;
+        for (int i = 0; i < 3; i++) {
+            const dim_t elem_off
+                    = src_offset0[i] + off[i] + (conf.bcast[i] ? 0 : start);
+            args.src[i] = src[i] + elem_off * src_dt_size[i];
+        }
+        args.dst = dst
+                + (dst_offset0 + outer * conf.inner_size + start) * dst_dt_size;
+        args.work_amount = nstl::min(conf.block_size, conf.inner_size - start);
+        (*kernel_)(&args);
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
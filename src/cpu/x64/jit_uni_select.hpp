@@ -0,0 +1,72 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_SELECT_HPP
+#define CPU_X64_JIT_UNI_SELECT_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_binary_pd.hpp"
+
+#include "cpu/x64/jit_uni_select_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// The implementation of the ternary `binary_select` algorithm.
+//
+// The tensors are viewed as a sequence of dense inner blocks, where each
+// source is either fully present or fully broadcast over the block, e.g. a
+// {1, 1, S, S} attention mask applied to {B, H, S, S} scores gives blocks of
+// S * S elements. A kernel call processes a part of a block and the sources
+// broadcast over it are splatted into a vector register once per call.
+struct jit_uni_select_t : public primitive_t {
+    struct pd_t : public cpu_binary_pd_t {
+        using cpu_binary_pd_t::cpu_binary_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", conf_.isa, ""),
+                jit_uni_select_t);
+
+        status_t init(engine_t *engine);
+
+        const jit_select_conf_t &get_conf() const { return conf_; }
+
+    private:
+        jit_select_conf_t conf_;
+
+        bool init_blocking();
+    };
+
+    jit_uni_select_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_select_kernel_base_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/type_helpers.hpp"
+
+#include "cpu/x64/jit_uni_select_kernel.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+#define GET_OFF(field) offsetof(jit_select_call_s, field)
+
+template <typename Vmm>
+jit_uni_select_kernel_t<Vmm>::jit_uni_select_kernel_t(
+        const jit_select_conf_t &conf)
+    : jit_uni_select_kernel_base_t(jit_name(), conf)
+    , io_(this, conf_.isa,
+              {conf_.src_type[0], conf_.src_type[1], conf_.src_type[2],
+                      conf_.dst_type},
+              {false},
+              io::io_tail_conf_t {simd_w_,
+                      static_cast<size_t>(conf_.inner_size % simd_w_),
+                      k_tail_mask_, vmm_tail_mask_.getIdx(), reg_tmp_},
+              io::io_emu_bf16_conf_t {vmm_bf16_emu_1_, vmm_bf16_emu_2_,
+                      vmm_bf16_emu_3_, reg_tmp_, vmm_bf16_emu_4_}) {}
+
+template <typename Vmm>
+Address jit_uni_select_kernel_t<Vmm>::src_ptr(int idx, dim_t offt) const {
+    return ptr[reg_src_[idx]
+            + offt * types::data_type_size(conf_.src_type[idx])];
+}
+
+template <typename Vmm>
+Address jit_uni_select_kernel_t<Vmm>::dst_ptr(dim_t offt) const {
+    return ptr[reg_dst_ + offt * types::data_type_size(conf_.dst_type)];
+}
+
+template <typename Vmm>
+void jit_uni_select_kernel_t<Vmm>::load_params() {
+    for (int i = 0; i < 3; i++)
+        mov(reg_src_[i], ptr[reg_param_ + GET_OFF(src) + i * sizeof(void *)]);
+    mov(reg_dst_, ptr[reg_param_ + GET_OFF(dst)]);
+    mov(reg_work_, ptr[reg_param_ + GET_OFF(work_amount)]);
+}
+
+template <typename Vmm>
+void jit_uni_select_kernel_t<Vmm>::prepare_bcast_srcs() {
+    for (int i = 0; i < 3; i++) {
+        if (!conf_.bcast[i]) continue;
+        io_.at(conf_.src_type[i])->broadcast(src_ptr(i, 0), vmm_bcast_src_[i]);
+    }
+}
+
+template <typename Vmm>
+void jit_uni_select_kernel_t<Vmm>::compute(int unroll, bool tail) {
+    // The loads are issued first to have several of them in flight.
+    for (int u = 0; u < unroll; u++)
+        for (int i = 0; i < 3; i++) {
+            if (conf_.bcast[i]) continue;
+            io_.at(conf_.src_type[i])
+                    ->load(src_ptr(i, u * simd_w_), vmm_src(u, i), tail);
+        }
+
+    for (int u = 0; u < unroll; u++) {
+        const auto get_src = [&](int i) {
+            return conf_.bcast[i] ? vmm_bcast_src_[i] : vmm_src(u, i);
+        };
+        const Vmm vmm_dst = vmm_src(u, 0);
+        // The condition is converted to f32, so a non-zero value selects
+        // src0.
+        if (is_zmm_) {
+            vcmpps(k_cond_, get_src(2), vmm_zero_, _cmp_neq_uq);
+            vblendmps(vmm_dst | k_cond_, get_src(1), get_src(0));
+        } else {
+            const Vmm vmm_mask = vmm_src(u, 2);
+            uni_vcmpps(vmm_mask, get_src(2), vmm_zero_, _cmp_neq_uq);
+            uni_vblendvps(vmm_dst, get_src(1), get_src(0), vmm_mask);
+        }
+        io_.at(conf_.dst_type)->store(vmm_dst, dst_ptr(u * simd_w_), tail);
+    }
+
+    for (int i = 0; i < 3; i++) {
+        if (conf_.bcast[i]) continue;
+        add(reg_src_[i],
+                unroll * simd_w_ * types::data_type_size(conf_.src_type[i]));
+    }
+    add(reg_dst_, unroll * simd_w_ * types::data_type_size(conf_.dst_type));
+}
+
+template <typename Vmm>
+void jit_uni_select_kernel_t<Vmm>::generate() {
+    const bool has_tail = conf_.inner_size % simd_w_ != 0;
+
+    preamble();
+    load_params();
+    io_.init_bf16();
+    if (has_tail) io_.prepare_tail_mask();
+    uni_vpxor(vmm_zero_, vmm_zero_, vmm_zero_);
+    prepare_bcast_srcs();
+
+    Label unroll_loop, loop, tail, end;
+
+    L(unroll_loop);
+    {
+        cmp(reg_work_, unroll_ * simd_w_);
+        jl(loop, T_NEAR);
+        compute(unroll_, false);
+        sub(reg_work_, unroll_ * simd_w_);
+        jmp(unroll_loop, T_NEAR);
+    }
+
+    L(loop);
+    {
+        cmp(reg_work_, simd_w_);
+        jl(tail, T_NEAR);
+        compute(1, false);
+        sub(reg_work_, simd_w_);
+        jmp(loop, T_NEAR);
+    }
+
+    // Only the last part of the inner block has a tail, which size is known
+    // at the kernel creation.
+    L(tail);
+    if (has_tail) {
+        cmp(reg_work_, 0);
+        jle(end, T_NEAR);
+        compute(1, true);
+    }
+
+    L(end);
+    postamble();
+}
+
+#undef GET_OFF
+
+template struct jit_uni_select_kernel_t<Zmm>;
+template struct jit_uni_select_kernel_t<Ymm>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_SELECT_KERNEL_HPP
+#define CPU_X64_JIT_UNI_SELECT_KERNEL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_select_conf_t {
+    cpu_isa_t isa;
+    data_type_t src_type[3];
+    data_type_t dst_type;
+    // Whether a source is broadcast over the whole inner block, in which case
+    // a single value of it is used by a kernel call.
+    bool bcast[3];
+
+    // The dense block of the innermost dimensions processed by the kernel and
+    // the number of such blocks.
+    dim_t inner_size;
+    dim_t outer_size;
+    // The number of elements of the inner block processed by a kernel call.
+    // It is a multiple of the vector length, so only the last part of the
+    // inner block has a tail.
+    dim_t block_size;
+
+    // The dimensions enumerating the inner blocks, the outermost first, with
+    // the corresponding strides of the sources, which are zero for the
+    // broadcast dimensions.
+    int outer_ndims;
+    dims_t outer_dims;
+    dims_t outer_strides[3];
+};
+
+struct jit_select_call_s {
+    const void *src[3];
+    void *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_select_kernel_base_t : public jit_generator {
+    jit_uni_select_kernel_base_t(
+            const char *name, const jit_select_conf_t &conf)
+        : jit_generator(name, conf.isa), conf_(conf) {}
+
+    void operator()(const jit_select_call_s *args) {
+        jit_generator::operator()(args);
+    }
+
+    virtual size_t simd_w() const = 0;
+
+protected:
+    const jit_select_conf_t conf_;
+};
+
+// Computes `dst = src2 ? src0 : src1` over `work_amount` elements. A source
+// broadcast over the inner block is loaded once and used for every vector.
+template <typename Vmm>
+struct jit_uni_select_kernel_t : public jit_uni_select_kernel_base_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_select_kernel_t)
+
+    jit_uni_select_kernel_t(const jit_select_conf_t &conf);
+
+    size_t simd_w() const override { return simd_w_; }
+
+private:
+    static constexpr bool is_zmm_ = std::is_same<Vmm, Xbyak::Zmm>::value;
+    static constexpr size_t simd_w_ = vreg_traits<Vmm>::vlen / sizeof(float);
+    static constexpr int unroll_ = is_zmm_ ? 4 : 2;
+
+    void load_params();
+    void prepare_bcast_srcs();
+    void compute(int unroll, bool tail);
+    void generate() override;
+
+    Xbyak::Address src_ptr(int idx, dim_t offt) const;
+    Xbyak::Address dst_ptr(dim_t offt) const;
+    Vmm vmm_src(int unroll_idx, int idx) const {
+        return Vmm(first_data_vmm_idx_ + 3 * unroll_idx + idx);
+    }
+
+    const Xbyak::Reg64 reg_param_ = abi_param1;
+    const Xbyak::Reg64 reg_src_[3] = {r8, r9, r10};
+    const Xbyak::Reg64 reg_dst_ = r11;
+    const Xbyak::Reg64 reg_work_ = r12;
+    const Xbyak::Reg64 reg_tmp_ = r13;
+
+    const Vmm vmm_tail_mask_ = Vmm(0);
+    const Vmm vmm_zero_ = Vmm(1);
+    const Vmm vmm_bcast_src_[3] = {Vmm(2), Vmm(3), Vmm(4)};
+    static constexpr int first_data_vmm_idx_ = 5;
+    const Xbyak::Zmm vmm_bf16_emu_1_ = Xbyak::Zmm(28);
+    const Xbyak::Zmm vmm_bf16_emu_2_ = Xbyak::Zmm(29);
+    const Xbyak::Zmm vmm_bf16_emu_3_ = Xbyak::Zmm(30);
+    const Xbyak::Zmm vmm_bf16_emu_4_ = Xbyak::Zmm(31);
+
+    const Xbyak::Opmask k_tail_mask_ = k1;
+    const Xbyak::Opmask k_cond_ = k2;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,664 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <functional>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+#include "cpu/x64/matmul/brgemm_dyn_quant_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(call_params_t, field)
+
+// The bf16 data is only used where it is supported natively.
+static cpu_isa_t io_isa() {
+    return mayiuse(avx512_core_bf16) ? avx512_core_bf16 : avx512_core;
+}
+
+// Quantizes a source row of K values and writes the row scale.
+struct dyn_quant_src_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(dyn_quant_src_kernel_t)
+
+    struct call_params_t {
+        const void *src;
+        void *qsrc;
+        float *scale;
+    };
+
+    dyn_quant_src_kernel_t(const brgemm_dyn_quant_matmul_conf_t &conf)
+        : jit_generator(jit_name(), conf.isa)
+        , conf_(conf)
+        , io_(this, io_isa(), {conf.src_dt, conf.qsrc_dt}, {},
+                  io::io_tail_conf_t {simd_w_,
+                          static_cast<size_t>(conf.K % simd_w_), k_tail_mask_,
+                          0, reg_tmp_},
+                  utils::nullopt,
+                  {{conf.qsrc_dt,
+                          io::io_saturation_conf_t {vmm_zero_.getIdx(),
+                                  vmm_ubound_.getIdx(), reg_tmp_}}}) {}
+
+    void operator()(const call_params_t *p) { jit_generator::operator()(p); }
+
+private:
+    static constexpr int simd_w_ = cpu_isa_traits<avx512_core>::vlen
+            / sizeof(float);
+    static constexpr int unroll_ = 4;
+
+    const brgemm_dyn_quant_matmul_conf_t conf_;
+
+    const Reg64 reg_param_ = abi_param1;
+    const Reg64 reg_src_ = r8;
+    const Reg64 reg_qsrc_ = r9;
+    const Reg64 reg_scale_ = r10;
+    const Reg64 reg_tmp_ = r11;
+    const Reg64 reg_iter_ = r12;
+
+    const Zmm vmm_max_ = Zmm(0);
+    const Zmm vmm_abs_mask_ = Zmm(1);
+    const Zmm vmm_qscale_ = Zmm(2);
+    const Zmm vmm_shift_ = Zmm(3);
+    const Zmm vmm_zero_ = Zmm(4);
+    const Zmm vmm_ubound_ = Zmm(5);
+    static constexpr int first_data_vmm_idx_ = 6;
+    const Opmask k_tail_mask_ = k1;
+
+    io::jit_io_multi_dt_helper_t<Zmm> io_;
+
+    Zmm vmm_data(int idx) const { return Zmm(first_data_vmm_idx_ + idx); }
+
+    // Calls `body` for the chunks of up to `unroll_` vectors of the row, the
+    // last vector of the row has the tail if any. The source and the
+    // quantized source pointers are advanced over the row.
+    void loop_over_row(const std::function<void(int, bool)> &body) {
+        const dim_t K = conf_.K;
+        const dim_t chunk = unroll_ * simd_w_;
+        const size_t src_dt_size = types::data_type_size(conf_.src_dt);
+
+        const auto advance = [&](int nvecs) {
+            add(reg_src_, nvecs * simd_w_ * src_dt_size);
+            add(reg_qsrc_, nvecs * simd_w_);
+        };
+
+        if (K / chunk > 0) {
+            Label loop;
+            mov(reg_iter_, K / chunk);
+            L(loop);
+            body(unroll_, false);
+            advance(unroll_);
+            dec(reg_iter_);
+            jnz(loop, T_NEAR);
+        }
+        const int rem_vecs = utils::div_up(K % chunk, simd_w_);
+        if (rem_vecs > 0) {
+            body(rem_vecs, K % simd_w_ != 0);
+            advance(rem_vecs);
+        }
+    }
+
+    Address src_ptr(int v) {
+        return ptr[reg_src_
+                + v * simd_w_ * types::data_type_size(conf_.src_dt)];
+    }
+
+    void generate() override {
+        const bool is_u8 = conf_.qsrc_dt == u8;
+
+        preamble();
+        mov(reg_src_, ptr[reg_param_ + GET_OFF(src)]);
+        mov(reg_qsrc_, ptr[reg_param_ + GET_OFF(qsrc)]);
+        mov(reg_scale_, ptr[reg_param_ + GET_OFF(scale)]);
+        io_.init_saturate_f32({conf_.qsrc_dt});
+        if (conf_.K % simd_w_) io_.prepare_tail_mask();
+
+        mov(reg_tmp_.cvt32(), 0x7fffffff);
+        vpbroadcastd(vmm_abs_mask_, reg_tmp_.cvt32());
+        uni_vpxor(vmm_max_, vmm_max_, vmm_max_);
+
+        // The maximum absolute value of the row. The values past the tail
+        // are loaded as zeros and do not affect it.
+        push(reg_src_);
+        loop_over_row([&](int nv, bool tail) {
+            for (int v = 0; v < nv; v++)
+                io_.at(conf_.src_dt)
+                        ->load(src_ptr(v), vmm_data(v), tail && v == nv - 1);
+            for (int v = 0; v < nv; v++) {
+                vandps(vmm_data(v), vmm_data(v), vmm_abs_mask_);
+                vmaxps(vmm_max_, vmm_max_, vmm_data(v));
+            }
+        });
+        pop(reg_src_);
+        mov(reg_qsrc_, ptr[reg_param_ + GET_OFF(qsrc)]);
+
+        const Ymm ymm_max(vmm_max_.getIdx()), ymm_tmp(vmm_data(0).getIdx());
+        const Xmm xmm_max(vmm_max_.getIdx()), xmm_tmp(vmm_data(0).getIdx());
+        const Xmm xmm_127(vmm_data(1).getIdx());
+        const Xmm xmm_qscale(vmm_qscale_.getIdx());
+        vextractf64x4(ymm_tmp, vmm_max_, 1);
+        vmaxps(ymm_max, ymm_max, ymm_tmp);
+        vextractf128(xmm_tmp, ymm_max, 1);
+        vmaxps(xmm_max, xmm_max, xmm_tmp);
+        vshufps(xmm_tmp, xmm_max, xmm_max, 0x4e);
+        vmaxps(xmm_max, xmm_max, xmm_tmp);
+        vshufps(xmm_tmp, xmm_max, xmm_max, 0xb1);
+        vmaxps(xmm_max, xmm_max, xmm_tmp);
+        // A row of zeros gets a finite scale and is quantized to zeros.
+        mov(reg_tmp_.cvt32(), float2int(FLT_MIN));
+        vmovd(xmm_tmp, reg_tmp_.cvt32());
+        vmaxss(xmm_max, xmm_max, xmm_tmp);
+
+        const float qmax = 127.f;
+        mov(reg_tmp_.cvt32(), float2int(qmax));
+        vmovd(xmm_127, reg_tmp_.cvt32());
+        vdivss(xmm_tmp, xmm_max, xmm_127);
+        vmovss(ptr[reg_scale_], xmm_tmp);
+        vdivss(xmm_qscale, xmm_127, xmm_max);
+        vbroadcastss(vmm_qscale_, xmm_qscale);
+        if (is_u8) {
+            mov(reg_tmp_.cvt32(), float2int(128.f));
+            vpbroadcastd(vmm_shift_, reg_tmp_.cvt32());
+        }
+
+        loop_over_row([&](int nv, bool tail) {
+            for (int v = 0; v < nv; v++)
+                io_.at(conf_.src_dt)
+                        ->load(src_ptr(v), vmm_data(v), tail && v == nv - 1);
+            for (int v = 0; v < nv; v++) {
+                vmulps(vmm_data(v), vmm_data(v), vmm_qscale_);
+                if (is_u8) vaddps(vmm_data(v), vmm_data(v), vmm_shift_);
+                io_.at(conf_.qsrc_dt)
+                        ->store(vmm_data(v), ptr[reg_qsrc_ + v * simd_w_],
+                                tail && v == nv - 1);
+            }
+        });
+
+        postamble();
+    }
+};
+
+// Converts `nrows` rows of the s32 accumulators to dst, applying the shift
+// compensation, the source row scales and the weights scales.
+struct dyn_quant_dst_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(dyn_quant_dst_kernel_t)
+
+    struct call_params_t {
+        const int32_t *acc;
+        const int32_t *comp;
+        const float *src_scales;
+        const float *wei_scales;
+        void *dst;
+        size_t nrows;
+        size_t is_n_tail;
+    };
+
+    dyn_quant_dst_kernel_t(const brgemm_dyn_quant_matmul_conf_t &conf)
+        : jit_generator(jit_name(), conf.isa)
+        , conf_(conf)
+        , io_(this, io_isa(), {conf.dst_dt}, {},
+                  io::io_tail_conf_t {simd_w_,
+                          static_cast<size_t>(conf.N_tail % simd_w_),
+                          k_tail_mask_, 0, reg_tmp_}) {}
+
+    void operator()(const call_params_t *p) { jit_generator::operator()(p); }
+
+private:
+    static constexpr int simd_w_ = cpu_isa_traits<avx512_core>::vlen
+            / sizeof(float);
+
+    const brgemm_dyn_quant_matmul_conf_t conf_;
+
+    const Reg64 reg_param_ = abi_param1;
+    const Reg64 reg_acc_ = r8;
+    const Reg64 reg_src_scales_ = r9;
+    const Reg64 reg_dst_ = r10;
+    const Reg64 reg_nrows_ = r11;
+    const Reg64 reg_tmp_ = r12;
+    const Reg64 reg_ptr_ = r13;
+
+    const Opmask k_tail_mask_ = k1;
+    const Zmm vmm_src_scale_ = Zmm(31);
+
+    io::jit_io_multi_dt_helper_t<Zmm> io_;
+
+    // The accumulators and the per column values of the block.
+    Zmm vmm_acc(int idx) const { return Zmm(idx); }
+    Zmm vmm_comp(int idx) const { return Zmm(8 + idx); }
+    Zmm vmm_wei_scale(int idx) const { return Zmm(16 + idx); }
+
+    void compute_rows(dim_t width) {
+        const bool is_u8 = conf_.qsrc_dt == u8;
+        const size_t dst_dt_size = types::data_type_size(conf_.dst_dt);
+        const int nvecs = utils::div_up(width, simd_w_);
+        const bool has_tail = width % simd_w_ != 0;
+        const auto is_tail
+                = [&](int v) { return has_tail && v == nvecs - 1; };
+        const auto maybe_mask = [&](const Zmm &vmm, int v) {
+            return is_tail(v) ? vmm | k_tail_mask_ | T_z : vmm;
+        };
+
+        if (is_u8) {
+            mov(reg_ptr_, ptr[reg_param_ + GET_OFF(comp)]);
+            for (int v = 0; v < nvecs; v++)
+                vmovdqu32(maybe_mask(vmm_comp(v), v),
+                        ptr[reg_ptr_ + v * simd_w_ * sizeof(int32_t)]);
+        }
+        if (conf_.with_wei_scales) {
+            mov(reg_ptr_, ptr[reg_param_ + GET_OFF(wei_scales)]);
+            for (int v = 0; v < nvecs; v++) {
+                if (conf_.wei_scales_per_n)
+                    vmovups(maybe_mask(vmm_wei_scale(v), v),
+                            ptr[reg_ptr_ + v * simd_w_ * sizeof(float)]);
+                else
+                    vbroadcastss(vmm_wei_scale(v), ptr[reg_ptr_]);
+            }
+        }
+
+        Label row_loop;
+        L(row_loop);
+        {
+            vbroadcastss(vmm_src_scale_, ptr[reg_src_scales_]);
+            for (int v = 0; v < nvecs; v++) {
+                const Zmm vmm = vmm_acc(v);
+                vmovdqu32(maybe_mask(vmm, v),
+                        ptr[reg_acc_ + v * simd_w_ * sizeof(int32_t)]);
+                if (is_u8) vpaddd(vmm, vmm, vmm_comp(v));
+                vcvtdq2ps(vmm, vmm);
+                vmulps(vmm, vmm, vmm_src_scale_);
+                if (conf_.with_wei_scales)
+                    vmulps(vmm, vmm, vmm_wei_scale(v));
+                io_.at(conf_.dst_dt)
+                        ->store(vmm, ptr[reg_dst_ + v * simd_w_ * dst_dt_size],
+                                is_tail(v));
+            }
+            add(reg_acc_, conf_.N_blk * sizeof(int32_t));
+            add(reg_src_scales_, sizeof(float));
+            add(reg_dst_, conf_.LDD * dst_dt_size);
+            dec(reg_nrows_);
+            jnz(row_loop, T_NEAR);
+        }
+    }
+
+    void generate() override {
+        preamble();
+        mov(reg_acc_, ptr[reg_param_ + GET_OFF(acc)]);
+        mov(reg_src_scales_, ptr[reg_param_ + GET_OFF(src_scales)]);
+        mov(reg_dst_, ptr[reg_param_ + GET_OFF(dst)]);
+        mov(reg_nrows_, ptr[reg_param_ + GET_OFF(nrows)]);
+        io_.init_bf16();
+        if (conf_.N_tail % simd_w_) io_.prepare_tail_mask();
+
+        Label n_tail, end;
+        if (conf_.N_tail > 0) {
+            cmp(qword[reg_param_ + GET_OFF(is_n_tail)], 0);
+            jne(n_tail, T_NEAR);
+        }
+        compute_rows(conf_.N_blk);
+        jmp(end, T_NEAR);
+
+        L(n_tail);
+        if (conf_.N_tail > 0) compute_rows(conf_.N_tail);
+
+        L(end);
+        postamble();
+    }
+};
+
+#undef GET_OFF
+
+status_t brgemm_dyn_quant_matmul_t::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_dt = src_md()->data_type;
+    const auto wei_dt = weights_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    VDISPATCH_MATMUL(with_src_dyn_quant(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(utils::one_of(src_dt, f32, bf16) && wei_dt == s8
+                    && utils::one_of(dst_dt, f32, bf16),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(
+            attr()->has_default_values(smask_t::src_dyn_quant
+                    | smask_t::scales_runtime | smask_t::fpmath_mode),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(!has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(
+            ndims() == 2 || (ndims() == 3 && weights_md()->dims[0] == 1),
+            VERBOSE_BAD_NDIMS, "weights", weights_md()->ndims);
+    // The groups of 4 K values are interleaved in the int8 weights.
+    VDISPATCH_MATMUL(K() % 4 == 0, VERBOSE_BAD_DIM, "src", ndims() - 1);
+
+    const cpu_isa_t isa = mayiuse(avx512_core_amx)
+            ? avx512_core_amx
+            : (mayiuse(avx512_core_vnni) ? avx512_core_vnni : isa_undef);
+    VDISPATCH_MATMUL(isa != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(IMPLICATION(utils::one_of(bf16, src_dt, dst_dt),
+                             mayiuse(avx512_core_bf16)),
+            VERBOSE_UNSUPPORTED_ISA);
+
+    conf_.isa = isa;
+    conf_.src_dt = src_dt;
+    conf_.dst_dt = dst_dt;
+    CHECK(init_conf(engine));
+
+    // The AMX kernels do not cover every shape, the VNNI ones are used
+    // instead.
+    if (init_brgemm_descs() != status::success) {
+        VDISPATCH_MATMUL(conf_.isa == avx512_core_amx, VERBOSE_UNSUPPORTED_ISA);
+        conf_.isa = avx512_core_vnni;
+        conf_.qsrc_dt = u8;
+        VDISPATCH_MATMUL(init_brgemm_descs() == status::success,
+                VERBOSE_UNSUPPORTED_ISA);
+    }
+    // The weights format depends on the quantized source data type, so it is
+    // chosen once the isa is final.
+    CHECK(init_formats(engine));
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_dyn_quant_matmul_t::pd_t::init_conf(engine_t *engine) {
+    auto &c = conf_;
+
+    c.qsrc_dt = is_superset(c.isa, avx512_core_amx) ? s8 : u8;
+    c.M = batch() * M();
+    c.N = N();
+    c.K = K();
+    c.N_blk = 64;
+    c.M_blk = nstl::min<dim_t>(32, c.M);
+    c.M_tail = c.M % c.M_blk;
+    c.N_tail = c.N % c.N_blk;
+
+    const auto &wei_scales = attr()->scales_.get(DNNL_ARG_WEIGHTS);
+    c.with_wei_scales = !wei_scales.has_default_values();
+    c.wei_scales_per_n = wei_scales.mask_ & wei_qmask_N();
+
+    c.LDA = c.K;
+    c.LDD = c.N;
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+status_t brgemm_dyn_quant_matmul_t::pd_t::init_formats(engine_t *engine) {
+    using namespace memory_extra_flags;
+    auto &c = conf_;
+    const bool is_3d = ndims() == 3;
+    const bool is_u8 = c.qsrc_dt == u8;
+    // The compensation is stored for every column of the padded weights.
+    const int comp_mask = is_3d ? (1 << 0) + (1 << 2) : (1 << 1);
+
+    const auto wei_tag = is_3d ? aCB16b64c4b : BA16a64b4a;
+    const auto plain_tag = is_3d ? abc : ab;
+    if (memory_desc_wrapper(weights_md_).format_any()) {
+        CHECK(memory_desc_init_by_tag(weights_md_, wei_tag));
+        if (is_u8) {
+            weights_md_.extra.flags = compensation_conv_s8s8;
+            weights_md_.extra.compensation_mask = comp_mask;
+        }
+    }
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    const memory_desc_wrapper src_d(src_md_), wei_d(weights_md_),
+            dst_d(dst_md_);
+    VDISPATCH_MATMUL(src_d.matches_tag(plain_tag), VERBOSE_UNSUPPORTED_TAG_S,
+            "src");
+    VDISPATCH_MATMUL(dst_d.matches_tag(plain_tag), VERBOSE_UNSUPPORTED_TAG_S,
+            "dst");
+    VDISPATCH_MATMUL(wei_d.matches_tag(wei_tag), VERBOSE_UNSUPPORTED_TAG_S,
+            "weights");
+
+    // The user weights may come without the compensation, which is then
+    // computed at execution.
+    const auto &extra = wei_d.extra();
+    c.wei_has_comp = extra.flags == compensation_conv_s8s8;
+    VDISPATCH_MATMUL(extra.flags == none
+                    || (is_u8 && c.wei_has_comp
+                            && extra.compensation_mask == comp_mask),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "weights");
+
+    return status::success;
+}
+
+status_t brgemm_dyn_quant_matmul_t::pd_t::init_brgemm_descs() {
+    auto &c = conf_;
+    const bool is_amx = is_superset(c.isa, avx512_core_amx);
+    c.wsp_tile_per_thr_bytes = 0;
+
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        const dim_t vM = i_M ? c.M_tail : c.M_blk;
+        const dim_t vN = i_N ? c.N_tail : c.N_blk;
+        if (vM == 0 || vN == 0) continue;
+
+        brgemm_desc_t &brg = brg_descs_[get_brg_kernel_idx(i_M, i_N)];
+        CHECK(brgemm_desc_init(&brg, c.isa, brgemm_addr, c.qsrc_dt, s8, false,
+                false, brgemm_row_major, 1.f, 0.f, c.LDA, c.N_blk, c.N_blk, vM,
+                vN, c.K));
+
+        brgemm_attr_t brgattr;
+        if (is_amx) {
+            brgattr.use_uker = true;
+            brgattr.use_interleave_stores = true;
+            brgattr.max_bs = 1;
+            brgattr.hint_expected_A_size = vM * c.K;
+            brgattr.hint_expected_B_size = vN * c.K;
+            brgattr.hint_expected_C_size = vM * vN;
+            brgattr.hint_innermost_loop = brgemm_innermost_undef;
+        }
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        c.wsp_tile_per_thr_bytes = nstl::max(
+                brg.get_wsp_buffer_size(), c.wsp_tile_per_thr_bytes);
+    }
+
+    return status::success;
+}
+
+void brgemm_dyn_quant_matmul_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    scratchpad.book(key_brgemm_primitive_buffer_a, c.M * c.K, sizeof(int8_t));
+    scratchpad.book<float>(key_matmul_src_dyn_quant_scales, c.M);
+    scratchpad.book<int32_t>(
+            key_brgemm_primitive_buffer, c.nthr * c.M_blk * c.N_blk);
+    if (c.qsrc_dt == u8 && !c.wei_has_comp)
+        scratchpad.book<int32_t>(key_brgemm_primitive_buffer_comp,
+                utils::rnd_up(c.N, c.N_blk));
+    if (is_superset(c.isa, avx512_core_amx))
+        scratchpad.book(key_conv_amx_tile_buffer,
+                static_cast<size_t>(c.nthr) * c.wsp_tile_per_thr_bytes,
+                sizeof(char));
+}
+
+brgemm_dyn_quant_matmul_t::brgemm_dyn_quant_matmul_t(const pd_t *apd)
+    : primitive_t(apd) {}
+brgemm_dyn_quant_matmul_t::~brgemm_dyn_quant_matmul_t() = default;
+
+status_t brgemm_dyn_quant_matmul_t::init(engine_t *engine) {
+    const auto &c = pd()->get_conf();
+
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        if ((i_M && c.M_tail == 0) || (i_N && c.N_tail == 0)) continue;
+
+        const int idx = pd_t::get_brg_kernel_idx(i_M, i_N);
+        const auto &brg = pd()->get_brg_desc(idx);
+        CHECK(brg_kernels_.insert(idx, brg));
+        if (is_superset(brg.isa_impl, avx512_core_amx))
+            brgemm_palettes_.insert(idx, brg);
+    }
+
+    CHECK(safe_ptr_assign(src_kernel_, new dyn_quant_src_kernel_t(c)));
+    CHECK(src_kernel_->create_kernel());
+    CHECK(safe_ptr_assign(dst_kernel_, new dyn_quant_dst_kernel_t(c)));
+    return dst_kernel_->create_kernel();
+}
+
+status_t brgemm_dyn_quant_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->get_conf();
+
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const int8_t *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const size_t src_dt_size = src_d.data_type_size();
+    const size_t dst_dt_size = dst_d.data_type_size();
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto qsrc = scratchpad.get<int8_t>(key_brgemm_primitive_buffer_a);
+    auto src_scales = scratchpad.get<float>(key_matmul_src_dyn_quant_scales);
+    auto acc_buffer = scratchpad.get<int32_t>(key_brgemm_primitive_buffer);
+    auto wsp_tile_buffer = scratchpad.get<char>(key_conv_amx_tile_buffer);
+
+    // The source rows are quantized before the multiplication, as a row is
+    // used by all the N blocks.
+    parallel_nd(c.M, [&](dim_t m) {
+        dyn_quant_src_kernel_t::call_params_t p;
+        p.src = src + (src_d.offset0() + m * c.LDA) * src_dt_size;
+        p.qsrc = qsrc + m * c.LDA;
+        p.scale = src_scales + m;
+        (*src_kernel_)(&p);
+    });
+
+    // The beginning of the weights block of the column `n`.
+    const auto wei_ptr = [&](dim_t n) {
+        dims_t pos = {0};
+        pos[pd()->ndims() - 1] = n;
+        return wei + wei_d.off_v(pos);
+    };
+
+    const bool is_amx = is_superset(c.isa, avx512_core_amx);
+    const bool is_u8 = c.qsrc_dt == u8;
+    const dim_t M_blocks = utils::div_up(c.M, c.M_blk);
+    const dim_t N_blocks = utils::div_up(c.N, c.N_blk);
+    const dim_t work_amount = M_blocks * N_blocks;
+
+    // The u8 source is shifted by 128, which adds 128 times the sum of the
+    // weights column to the accumulator. The compensation is either stored
+    // after the weights by the reorder or computed here once for all the
+    // threads. The padded columns and rows of the weights blocks are zeros.
+    const int32_t *comp_buffer = nullptr;
+    if (is_u8 && c.wei_has_comp) {
+        comp_buffer = reinterpret_cast<const int32_t *>(
+                wei + wei_d.size() - wei_d.additional_buffer_size());
+    } else if (is_u8) {
+        auto comp = scratchpad.get<int32_t>(key_brgemm_primitive_buffer_comp);
+        parallel_nd(N_blocks, [&](dim_t nb) {
+            const int8_t *wei_blk = wei_ptr(nb * c.N_blk);
+            int32_t *comp_blk = comp + nb * c.N_blk;
+            PRAGMA_OMP_SIMD()
+            for (dim_t j = 0; j < c.N_blk; j++)
+                comp_blk[j] = 0;
+            for (dim_t k4 = 0; k4 < c.K / 4; k4++) {
+                const int8_t *w = wei_blk + k4 * c.N_blk * 4;
+                PRAGMA_OMP_SIMD()
+                for (dim_t j = 0; j < c.N_blk; j++)
+                    comp_blk[j] += w[4 * j] + w[4 * j + 1] + w[4 * j + 2]
+                            + w[4 * j + 3];
+            }
+            PRAGMA_OMP_SIMD()
+            for (dim_t j = 0; j < c.N_blk; j++)
+                comp_blk[j] *= -128;
+        });
+        comp_buffer = comp;
+    }
+
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        int32_t *acc = acc_buffer + ithr * c.M_blk * c.N_blk;
+        char *wsp_tile = is_amx ? wsp_tile_buffer
+                        + static_cast<size_t>(ithr) * c.wsp_tile_per_thr_bytes
+                                : nullptr;
+
+        int prev_ker_idx = -1;
+        brgemm_batch_element_t batch;
+
+        // The M blocks go innermost, so the weights block is reused by all of
+        // them while it is in cache.
+        dim_t mb {0}, nb {0};
+        utils::nd_iterator_init(start, nb, N_blocks, mb, M_blocks);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t m = mb * c.M_blk;
+            const dim_t n = nb * c.N_blk;
+            const bool is_M_tail = c.M - m < c.M_blk;
+            const bool is_N_tail = c.N - n < c.N_blk;
+            const int8_t *wei_blk = wei_ptr(n);
+
+            const int ker_idx = pd_t::get_brg_kernel_idx(is_M_tail, is_N_tail);
+            brgemm_palettes_.maybe_tile_configure(
+                    is_amx, prev_ker_idx, ker_idx);
+            batch.ptr.A = qsrc + m * c.LDA;
+            batch.ptr.B = wei_blk;
+            brgemm_kernel_execute(
+                    brg_kernels_[ker_idx], 1, &batch, acc, wsp_tile);
+
+            dyn_quant_dst_kernel_t::call_params_t p;
+            p.acc = acc;
+            p.comp = is_u8 ? comp_buffer + n : nullptr;
+            p.src_scales = src_scales + m;
+            p.wei_scales = wei_scales + (c.wei_scales_per_n ? n : 0);
+            p.dst = dst + (dst_d.offset0() + m * c.LDD + n) * dst_dt_size;
+            p.nrows = is_M_tail ? c.M_tail : c.M_blk;
+            p.is_n_tail = is_N_tail;
+            (*dst_kernel_)(&p);
+
+            utils::nd_iterator_step(nb, N_blocks, mb, M_blocks);
+        }
+
+        if (is_amx) amx_tile_release();
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
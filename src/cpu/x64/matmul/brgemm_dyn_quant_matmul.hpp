@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_DYN_QUANT_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_DYN_QUANT_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+struct brgemm_dyn_quant_matmul_conf_t {
+    cpu_isa_t isa;
+    data_type_t src_dt, dst_dt;
+    // The data type of the quantized source. It is u8 on the isa without the
+    // s8s8 dot product, in which case the quantized values are shifted by 128
+    // and the shift is compensated with the sums of the weights columns.
+    data_type_t qsrc_dt;
+    // Whether the compensation is stored after the weights by the weights
+    // reorder, as for the s8s8 compensation of the brgemm matmul. Otherwise
+    // it is computed from the weights at each execution.
+    bool wei_has_comp;
+
+    // The batch of the source and the destination is folded into M, as the
+    // weights are shared by all the batch entries.
+    dim_t M, N, K;
+    dim_t M_blk, N_blk;
+    dim_t M_tail, N_tail;
+    dim_t LDA, LDD;
+
+    bool with_wei_scales;
+    bool wei_scales_per_n;
+
+    int nthr;
+    int wsp_tile_per_thr_bytes;
+};
+
+struct dyn_quant_src_kernel_t;
+struct dyn_quant_dst_kernel_t;
+
+// Matmul with the dynamic quantization of the source, which computes
+// `dst = (q(src) * wei) * src_scale(m) * wei_scale(n)`, where each row of
+// the source is quantized with the scale of its maximum absolute value.
+//
+// The source rows are quantized into a scratchpad buffer by a single pass,
+// which computes the row scale and the quantized values while the row is in
+// L1. The int8 brgemm kernels then compute the dst blocks into thread local
+// accumulators, which are scaled on the way to dst.
+struct brgemm_dyn_quant_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brg_dyn_quant_matmul:", conf_.isa, ""),
+                brgemm_dyn_quant_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        static int get_brg_kernel_idx(bool is_M_tail, bool is_N_tail) {
+            return 2 * is_M_tail + is_N_tail;
+        }
+
+        const brgemm_desc_t &get_brg_desc(int idx) const {
+            return brg_descs_[idx];
+        }
+        const brgemm_dyn_quant_matmul_conf_t &get_conf() const {
+            return conf_;
+        }
+
+    private:
+        brgemm_dyn_quant_matmul_conf_t conf_;
+        brgemm_desc_t brg_descs_[4];
+
+        status_t init_conf(engine_t *engine);
+        status_t init_formats(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_dyn_quant_matmul_t(const pd_t *apd);
+    ~brgemm_dyn_quant_matmul_t() override;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    brgemm_containers::brgemm_kernel_container_t brg_kernels_ {4};
+    brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {4};
+    std::unique_ptr<dyn_quant_src_kernel_t> src_kernel_;
+    std::unique_ptr<dyn_quant_dst_kernel_t> dst_kernel_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,450 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+#include "cpu/x64/matmul/brgemm_gated_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace Xbyak;
+
+struct gating_kernel_t : public jit_generator {
+    struct call_params_t {
+        const float *gate, *up;
+        void *dst;
+        size_t nrows;
+        size_t is_n_tail;
+    };
+
+    gating_kernel_t(const char *name, const brgemm_gated_matmul_conf_t &conf)
+        : jit_generator(name, conf.isa), conf_(conf) {}
+
+    void operator()(const call_params_t *p) { jit_generator::operator()(p); }
+
+protected:
+    const brgemm_gated_matmul_conf_t conf_;
+};
+
+// Reads `nrows` rows of the gate and of the up projection accumulators and
+// writes `act(gate) * up` to the corresponding dst rows.
+template <cpu_isa_t isa>
+struct jit_uni_gating_kernel_t : public gating_kernel_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gating_kernel_t)
+
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    jit_uni_gating_kernel_t(
+            const brgemm_gated_matmul_conf_t &conf, const gating_t &gating)
+        : gating_kernel_t(jit_name(), conf)
+        , tail_size_(conf.N_tail % simd_w_)
+        , eltwise_injector_(this, gating.alg_, gating.alpha_, gating.beta_,
+                  1.f, true, reg_table_, k_eltwise_mask_)
+        , io_(this, isa, {f32, conf.dst_dt}, {false},
+                  io::io_tail_conf_t {simd_w_, static_cast<size_t>(tail_size_),
+                          k_tail_mask_, vmm_tail_mask_.getIdx(), reg_tmp_}) {}
+
+private:
+    static constexpr int simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+    // The number of vectors that go through the activation at once.
+    static constexpr int unroll_ = 4;
+
+    const dim_t tail_size_;
+
+    const Reg64 reg_param_ = abi_param1;
+    const Reg64 reg_gate_ = r8;
+    const Reg64 reg_up_ = r9;
+    const Reg64 reg_dst_ = r10;
+    const Reg64 reg_nrows_ = r11;
+    const Reg64 reg_tmp_ = r12;
+    const Reg64 reg_table_ = rax;
+
+    const Vmm vmm_tail_mask_ = Vmm(15);
+    const Opmask k_eltwise_mask_ = k1;
+    const Opmask k_tail_mask_ = k2;
+
+    jit_uni_eltwise_injector_f32<isa> eltwise_injector_;
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+
+    Vmm vmm_gate(int idx) const { return Vmm(idx); }
+    Vmm vmm_up(int idx) const { return Vmm(unroll_ + idx); }
+
+    void compute_rows(dim_t width) {
+        const size_t dst_dt_size = types::data_type_size(conf_.dst_dt);
+        const int nvecs = utils::div_up(width, simd_w_);
+        const bool has_tail = width % simd_w_ != 0;
+
+        Label row_loop;
+        L(row_loop);
+        for (int v0 = 0; v0 < nvecs; v0 += unroll_) {
+            const int nv = nstl::min(unroll_, nvecs - v0);
+            const auto is_tail
+                    = [&](int v) { return has_tail && v0 + v == nvecs - 1; };
+
+            for (int v = 0; v < nv; v++)
+                io_.at(f32)->load(ptr[reg_gate_ + (v0 + v) * vlen()],
+                        vmm_gate(v), is_tail(v));
+            eltwise_injector_.compute_vector_range(0, nv);
+            for (int v = 0; v < nv; v++)
+                io_.at(f32)->load(ptr[reg_up_ + (v0 + v) * vlen()], vmm_up(v),
+                        is_tail(v));
+            for (int v = 0; v < nv; v++)
+                uni_vmulps(vmm_gate(v), vmm_gate(v), vmm_up(v));
+            for (int v = 0; v < nv; v++)
+                io_.at(conf_.dst_dt)
+                        ->store(vmm_gate(v),
+                                ptr[reg_dst_
+                                        + (v0 + v) * simd_w_ * dst_dt_size],
+                                is_tail(v));
+        }
+        add(reg_gate_, conf_.N_blk * sizeof(float));
+        add(reg_up_, conf_.N_blk * sizeof(float));
+        add(reg_dst_, conf_.LDD * dst_dt_size);
+        dec(reg_nrows_);
+        jnz(row_loop, T_NEAR);
+    }
+
+    static constexpr int vlen() { return cpu_isa_traits<isa>::vlen; }
+
+    void generate() override {
+#define GET_OFF(field) offsetof(call_params_t, field)
+        preamble();
+        mov(reg_gate_, ptr[reg_param_ + GET_OFF(gate)]);
+        mov(reg_up_, ptr[reg_param_ + GET_OFF(up)]);
+        mov(reg_dst_, ptr[reg_param_ + GET_OFF(dst)]);
+        mov(reg_nrows_, ptr[reg_param_ + GET_OFF(nrows)]);
+        if (tail_size_ > 0) io_.prepare_tail_mask();
+        eltwise_injector_.load_table_addr();
+
+        Label n_tail, end;
+        if (conf_.N_tail > 0) {
+            cmp(qword[reg_param_ + GET_OFF(is_n_tail)], 0);
+            jne(n_tail, T_NEAR);
+        }
+        compute_rows(conf_.N_blk);
+        jmp(end, T_NEAR);
+
+        L(n_tail);
+        if (conf_.N_tail > 0) compute_rows(conf_.N_tail);
+
+        L(end);
+        postamble();
+
+        eltwise_injector_.prepare_table();
+#undef GET_OFF
+    }
+};
+
+// The isa of the gating kernel, which computes in f32. The bf16 kernels
+// need the native conversion to store the bf16 dst.
+static cpu_isa_t get_gating_isa(cpu_isa_t brg_isa) {
+    if (is_superset(brg_isa, avx512_core_bf16)) return avx512_core_bf16;
+    return is_superset(brg_isa, avx512_core) ? avx512_core : avx2;
+}
+
+status_t brgemm_gated_matmul_t::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_dt = src_md()->data_type;
+    const auto wei_dt = weights_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    const bool is_f32 = utils::everyone_is(f32, src_dt, wei_dt, dst_dt);
+    const bool is_bf16 = utils::everyone_is(bf16, src_dt, wei_dt)
+            && utils::one_of(dst_dt, bf16, f32);
+
+    VDISPATCH_MATMUL(with_gating(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(is_f32 || is_bf16, VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(smask_t::gating),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(!has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(
+            ndims() == 2 || (ndims() == 3 && weights_md()->dims[0] == 1),
+            VERBOSE_BAD_NDIMS, "weights", weights_md()->ndims);
+
+    cpu_isa_t isa = isa_undef;
+    if (is_f32)
+        isa = mayiuse(avx512_core) ? avx512_core
+                                   : (mayiuse(avx2) ? avx2 : isa_undef);
+    else
+        isa = mayiuse(avx512_core_amx)
+                ? avx512_core_amx
+                : (mayiuse(avx512_core_bf16) ? avx512_core_bf16 : isa_undef);
+    VDISPATCH_MATMUL(isa != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(eltwise_injector::is_supported(
+                             get_gating_isa(isa), attr()->gating_.alg_),
+            VERBOSE_BAD_ALGORITHM);
+    // The pairs of K values are interleaved in the bf16 weights.
+    VDISPATCH_MATMUL(is_f32 || K() % 2 == 0, VERBOSE_BAD_DIM, "src",
+            ndims() - 1);
+
+    conf_.isa = isa;
+    conf_.src_dt = src_dt;
+    conf_.wei_dt = wei_dt;
+    conf_.dst_dt = dst_dt;
+    CHECK(init_conf(engine));
+
+    // The AMX kernels do not cover every shape, the AVX-512 ones are used
+    // instead.
+    if (init_brgemm_descs(conf_.isa) != status::success) {
+        VDISPATCH_MATMUL(is_bf16 && conf_.isa == avx512_core_amx,
+                VERBOSE_UNSUPPORTED_ISA);
+        conf_.isa = avx512_core_bf16;
+        VDISPATCH_MATMUL(init_brgemm_descs(conf_.isa) == status::success,
+                VERBOSE_UNSUPPORTED_ISA);
+    }
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_gated_matmul_t::pd_t::init_conf(engine_t *engine) {
+    auto &c = conf_;
+    const bool is_3d = ndims() == 3;
+
+    c.M = batch() * M();
+    c.N = N();
+    c.K = K();
+    c.N_blk = 64;
+    c.M_blk = nstl::min<dim_t>(32, c.M);
+    c.M_tail = c.M % c.M_blk;
+    c.N_tail = c.N % c.N_blk;
+
+    // The blocked weights keep a block of the gate and of the up projection
+    // apart only if the gate part ends at a block boundary.
+    const auto blocked_tag = c.wei_dt == bf16
+            ? (is_3d ? aCB16b64c2b : BA16a64b2a)
+            : (is_3d ? aCB16b64c : BA16a64b);
+    const auto plain_tag = is_3d ? abc : ab;
+    const bool can_block = c.N_tail == 0;
+
+    if (memory_desc_wrapper(weights_md_).format_any()) {
+        VDISPATCH_MATMUL(can_block || c.wei_dt == f32, VERBOSE_UNSUPPORTED_TAG);
+        CHECK(memory_desc_init_by_tag(
+                weights_md_, can_block ? blocked_tag : plain_tag));
+    }
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    const memory_desc_wrapper src_d(src_md_), wei_d(weights_md_),
+            dst_d(dst_md_);
+    VDISPATCH_MATMUL(src_d.matches_tag(plain_tag), VERBOSE_UNSUPPORTED_TAG_S,
+            "src");
+    VDISPATCH_MATMUL(dst_d.matches_tag(plain_tag), VERBOSE_UNSUPPORTED_TAG_S,
+            "dst");
+
+    c.wei_plain = c.wei_dt == f32 && wei_d.matches_tag(plain_tag);
+    VDISPATCH_MATMUL(
+            c.wei_plain || (can_block && wei_d.matches_tag(blocked_tag)),
+            VERBOSE_UNSUPPORTED_TAG_S, "weights");
+
+    c.LDA = c.K;
+    c.LDB = c.wei_plain ? 2 * c.N : c.N_blk;
+    c.LDD = c.N;
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+status_t brgemm_gated_matmul_t::pd_t::init_brgemm_descs(cpu_isa_t isa) {
+    auto &c = conf_;
+    const bool is_amx = is_superset(isa, avx512_core_amx);
+    c.wsp_tile_per_thr_bytes = 0;
+
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        const dim_t vM = i_M ? c.M_tail : c.M_blk;
+        const dim_t vN = i_N ? c.N_tail : c.N_blk;
+        if (vM == 0 || vN == 0) continue;
+
+        brgemm_desc_t &brg = brg_descs_[get_brg_kernel_idx(i_M, i_N)];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, c.src_dt, c.wei_dt,
+                false, false, brgemm_row_major, 1.f, 0.f, c.LDA, c.LDB,
+                c.N_blk, vM, vN, c.K));
+
+        brgemm_attr_t brgattr;
+        if (is_amx) {
+            brgattr.use_uker = true;
+            brgattr.use_interleave_stores = true;
+            brgattr.max_bs = 1;
+            brgattr.wary_tail_read = false;
+            brgattr.hint_expected_A_size = vM * c.K;
+            brgattr.hint_expected_B_size = vN * c.K;
+            brgattr.hint_expected_C_size = vM * vN;
+            brgattr.hint_innermost_loop = brgemm_innermost_undef;
+        }
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        c.wsp_tile_per_thr_bytes = nstl::max(
+                brg.get_wsp_buffer_size(), c.wsp_tile_per_thr_bytes);
+    }
+
+    return status::success;
+}
+
+void brgemm_gated_matmul_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    // The gate and the up projection accumulators of each thread.
+    scratchpad.book<float>(
+            key_brgemm_primitive_buffer, c.nthr * 2 * c.M_blk * c.N_blk);
+    if (is_superset(c.isa, avx512_core_amx))
+        scratchpad.book(key_conv_amx_tile_buffer,
+                static_cast<size_t>(c.nthr) * c.wsp_tile_per_thr_bytes,
+                sizeof(char));
+}
+
+brgemm_gated_matmul_t::brgemm_gated_matmul_t(const pd_t *apd)
+    : primitive_t(apd) {}
+brgemm_gated_matmul_t::~brgemm_gated_matmul_t() = default;
+
+status_t brgemm_gated_matmul_t::init(engine_t *engine) {
+    const auto &c = pd()->get_conf();
+
+    for_(int i_M = 0; i_M < 2; i_M++)
+    for (int i_N = 0; i_N < 2; i_N++) {
+        if ((i_M && c.M_tail == 0) || (i_N && c.N_tail == 0)) continue;
+
+        const int idx = pd_t::get_brg_kernel_idx(i_M, i_N);
+        const auto &brg = pd()->get_brg_desc(idx);
+        CHECK(brg_kernels_.insert(idx, brg));
+        if (is_superset(brg.isa_impl, avx512_core_amx))
+            brgemm_palettes_.insert(idx, brg);
+    }
+
+    const auto &gating = pd()->attr()->gating_;
+    const cpu_isa_t gating_isa = get_gating_isa(c.isa);
+    if (gating_isa == avx512_core_bf16)
+        CHECK(safe_ptr_assign(gating_kernel_,
+                new jit_uni_gating_kernel_t<avx512_core_bf16>(c, gating)));
+    else if (gating_isa == avx512_core)
+        CHECK(safe_ptr_assign(gating_kernel_,
+                new jit_uni_gating_kernel_t<avx512_core>(c, gating)));
+    else
+        CHECK(safe_ptr_assign(gating_kernel_,
+                new jit_uni_gating_kernel_t<avx2>(c, gating)));
+    return gating_kernel_->create_kernel();
+}
+
+status_t brgemm_gated_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->get_conf();
+
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const size_t src_dt_size = src_d.data_type_size();
+    const size_t wei_dt_size = wei_d.data_type_size();
+    const size_t dst_dt_size = dst_d.data_type_size();
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto acc_buffer = scratchpad.get<float>(key_brgemm_primitive_buffer);
+    auto wsp_tile_buffer = scratchpad.get<char>(key_conv_amx_tile_buffer);
+
+    // The offset of the weights column `n`, which is the beginning of a block
+    // for the blocked weights.
+    const auto wei_ptr = [&](dim_t n) {
+        dims_t pos = {0};
+        pos[pd()->ndims() - 1] = n;
+        return wei + wei_d.off_v(pos) * wei_dt_size;
+    };
+
+    const bool is_amx = is_superset(c.isa, avx512_core_amx);
+    const dim_t M_blocks = utils::div_up(c.M, c.M_blk);
+    const dim_t N_blocks = utils::div_up(c.N, c.N_blk);
+    const dim_t work_amount = M_blocks * N_blocks;
+
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *acc_gate = acc_buffer + ithr * 2 * c.M_blk * c.N_blk;
+        float *acc_up = acc_gate + c.M_blk * c.N_blk;
+        char *wsp_tile = is_amx ? wsp_tile_buffer
+                        + static_cast<size_t>(ithr) * c.wsp_tile_per_thr_bytes
+                                : nullptr;
+
+        int prev_ker_idx = -1;
+        brgemm_batch_element_t batch;
+
+        // The M blocks go innermost, so the weights block is reused by all of
+        // them while it is in cache.
+        dim_t mb {0}, nb {0};
+        utils::nd_iterator_init(start, nb, N_blocks, mb, M_blocks);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t m = mb * c.M_blk;
+            const dim_t n = nb * c.N_blk;
+            const bool is_M_tail = c.M - m < c.M_blk;
+            const bool is_N_tail = c.N - n < c.N_blk;
+            const int ker_idx = pd_t::get_brg_kernel_idx(is_M_tail, is_N_tail);
+            const auto brg_kernel = brg_kernels_[ker_idx];
+            brgemm_palettes_.maybe_tile_configure(
+                    is_amx, prev_ker_idx, ker_idx);
+
+            batch.ptr.A = src + (src_d.offset0() + m * c.LDA) * src_dt_size;
+            batch.ptr.B = wei_ptr(n);
+            brgemm_kernel_execute(brg_kernel, 1, &batch, acc_gate, wsp_tile);
+            batch.ptr.B = wei_ptr(c.N + n);
+            brgemm_kernel_execute(brg_kernel, 1, &batch, acc_up, wsp_tile);
+
+            gating_kernel_t::call_params_t p;
+            p.gate = acc_gate;
+            p.up = acc_up;
+            p.dst = dst + (dst_d.offset0() + m * c.LDD + n) * dst_dt_size;
+            p.nrows = is_M_tail ? c.M_tail : c.M_blk;
+            p.is_n_tail = is_N_tail;
+            (*gating_kernel_)(&p);
+
+            utils::nd_iterator_step(nb, N_blocks, mb, M_blocks);
+        }
+
+        if (is_amx) amx_tile_release();
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
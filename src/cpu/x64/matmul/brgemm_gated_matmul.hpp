@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_GATED_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_GATED_MATMUL_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+struct brgemm_gated_matmul_conf_t {
+    cpu_isa_t isa;
+    data_type_t src_dt, wei_dt, dst_dt;
+
+    // The batch of the source and the destination is folded into M, as the
+    // weights are shared by all the batch entries.
+    dim_t M, N, K;
+    dim_t M_blk, N_blk;
+    dim_t M_tail, N_tail;
+    dim_t LDA, LDB, LDD;
+    // Plain weights are used as is, otherwise the weights are blocked by
+    // N_blk, so a block of the gate and of the up projection is contiguous.
+    bool wei_plain;
+
+    int nthr;
+    int wsp_tile_per_thr_bytes;
+};
+
+struct gating_kernel_t;
+
+// Matmul with the gating attribute, which computes a gated feed-forward
+// projection `dst = act(src * W_gate) * (src * W_up)`.
+//
+// The gate and the up projection of a dst block are computed by two brgemm
+// calls into thread local accumulators that stay in L1, and the activation
+// and the product are applied on the way to dst, so neither of the
+// intermediate projections is ever written to memory.
+struct brgemm_gated_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brg_gated_matmul:", conf_.isa, ""),
+                brgemm_gated_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        static int get_brg_kernel_idx(bool is_M_tail, bool is_N_tail) {
+            return 2 * is_M_tail + is_N_tail;
+        }
+
+        const brgemm_desc_t &get_brg_desc(int idx) const {
+            return brg_descs_[idx];
+        }
+        const brgemm_gated_matmul_conf_t &get_conf() const { return conf_; }
+
+    private:
+        brgemm_gated_matmul_conf_t conf_;
+        brgemm_desc_t brg_descs_[4];
+
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs(cpu_isa_t isa);
+        void init_scratchpad();
+    };
+
+    brgemm_gated_matmul_t(const pd_t *apd);
+    ~brgemm_gated_matmul_t() override;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    brgemm_containers::brgemm_kernel_container_t brg_kernels_ {4};
+    brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {4};
+    std::unique_ptr<gating_kernel_t> gating_kernel_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -59,6 +59,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             = everyone_is(f16, src_dt, wei_dt) && one_of(dst_dt, f16, f32);
     const bool is_bf16_with_int_wei = src_dt == bf16 && one_of(wei_dt, s8, u8)
             && one_of(dst_dt, bf16, f32);
+    const bool is_bf16_with_fp8_wei = src_dt == bf16
+            && one_of(wei_dt, f8_e5m2, f8_e4m3) && one_of(dst_dt, bf16, f32);
 
     auto check_bias = [&]() -> bool {
         const auto bia_dt = weights_md(1)->data_type;
@@ -86,8 +88,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
     auto check_attr_zero_points
             = [&]() -> bool { return attr()->zero_points_.common(); };
-    const bool problem_dt_correct = one_of(
-            true, is_int8, is_bf16, is_f32, is_f16, is_bf16_with_int_wei);
+    const bool problem_dt_correct = one_of(true, is_int8, is_bf16, is_f32,
+            is_f16, is_bf16_with_int_wei, is_bf16_with_fp8_wei);
 
     auto src_d = memory_desc_wrapper(src_md_);
     auto weights_d = memory_desc_wrapper(weights_md_);
@@ -222,9 +224,7 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
         if (idx < 0) continue;
 
-        brgemm_kernel_t *ker = nullptr;
-        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
-        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        CHECK(brg_kernels_.insert(idx, pd()->get_brg_desc(idx)));
         if (is_superset(pd()->get_brg_desc(idx).isa_impl, avx512_core_amx))
             brgemm_palettes_.insert(idx, pd()->get_brg_desc(idx));
     }
@@ -431,7 +431,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
     if (gemm_batch > 0 && brg_ker_idx >= 0) {
         const bool is_amx = is_superset(
                 pd()->get_brg_desc(brg_ker_idx).isa_impl, avx512_core_amx);
-        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+        const auto brg_kernel = brg_kernels_[brg_ker_idx];
         assert(brg_kernel != nullptr);
         brgemm_palettes_.maybe_tile_configure(
                 is_amx, prev_ker_idx, brg_ker_idx);
@@ -488,7 +488,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
                 pd()->get_brg_desc(brg_ker_idx).isa_impl, avx512_core_amx);
         brgemm_palettes_.maybe_tile_configure(
                 is_amx, prev_ker_idx, brg_ker_idx);
-        const auto brg_kernel_k_tail = brg_kernels_[brg_ker_idx].get();
+        const auto brg_kernel_k_tail = brg_kernels_[brg_ker_idx];
 
         if (post_ops_applicable) {
             void *scratch = is_amx
@@ -614,7 +614,7 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                                 avx512_core_amx);
                         brgemm_palettes_.maybe_tile_configure(
                                 is_amx, prev_ker_idx, brg_ker_idx);
-                        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+                        const auto brg_kernel = brg_kernels_[brg_ker_idx];
                         const int m = brgmm_ctx.get_M_idx(mb);
                         const int n = nb * bgmmc.N_blk;
                         const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
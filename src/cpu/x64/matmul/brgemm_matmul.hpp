@@ -144,7 +144,8 @@ private:
     void accumulate(
             char *result_ptr, const char *reduce_ptr, size_t size) const;
 
-    std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
+    brgemm_containers::brgemm_kernel_container_t brg_kernels_ {
+            max_num_brg_kernels_matmul};
     brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
             max_num_brg_kernels_matmul};
 
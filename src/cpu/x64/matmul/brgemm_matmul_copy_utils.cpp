@@ -18,6 +18,7 @@
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
+#include "cpu/x64/jit_avx512_core_fp8cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/matmul/brgemm_matmul_copy_utils.hpp"
@@ -34,6 +35,23 @@ using namespace Xbyak;
 
 #define GET_OFF(x) offsetof(ctx_t, x)
 
+// The fp8 to f32 conversion used by the copy routines of the fp8 weights. It
+// takes the `fp8_emu_vregs` topmost vector registers.
+static constexpr int fp8_emu_vregs = 3;
+static std::unique_ptr<fp8_emulation_base_t> create_fp8_emulation(
+        jit_generator *host, const brgemm_matmul_conf_t *conf,
+        const Reg64 &reg_aux, const Opmask &kmask_aux) {
+    if (!conf->is_bf16_with_fp8_wei) return nullptr;
+
+    const int nvregs = isa_num_vregs(conf->isa);
+    const Zmm aux1(nvregs - 1), aux2(nvregs - 2), aux3(nvregs - 3);
+    if (conf->orig_wei_dt == data_type::f8_e5m2)
+        return utils::make_unique<fp8_emulation_e5m2_t>(
+                host, aux1, aux2, aux3, kmask_aux, reg_aux);
+    return utils::make_unique<fp8_emulation_e4m3_t>(
+            host, aux1, aux2, aux3, aux1, aux2, reg_aux);
+}
+
 template <typename Vmm>
 struct jit_brgemm_matmul_copy_a_impl_t : public jit_brgemm_matmul_copy_a_t,
                                          public jit_generator {
@@ -2833,9 +2851,11 @@ struct jit_brgemm_matmul_copy_b_bf16_t : public jit_brgemm_matmul_copy_b_t,
         , scales_N_stride(conf_->N * scales_typesize)
         , is_dynamic_stride(is_runtime_value(src_stride))
         , is_dynamic_N(conf->is_runtime_N)
-        , req_cvtps2bf16(conf->is_bf32 || conf->is_bf16_with_int_wei)
+        , req_cvtps2bf16(conf->is_bf32 || conf->is_bf16_with_int_wei
+                  || conf->is_bf16_with_fp8_wei)
         , req_zp_b_shift(conf->has_zero_point_b && conf->with_wei_decompression)
-        , req_apply_scales(conf->apply_scales_in_buffer_b) {}
+        , req_apply_scales(conf->apply_scales_in_buffer_b)
+        , fp8_emu_(create_fp8_emulation(this, conf, reg_tmp, kAux)) {}
 
     void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
     status_t create_kernel() override { return jit_generator::create_kernel(); }
@@ -2863,6 +2883,7 @@ private:
 
     opmask_t kTail = k7;
     opmask_t kFFFF = k6;
+    opmask_t kAux = k5;
 
     reg64_t reg_src = rax;
     reg64_t reg_tr_src = rbx;
@@ -2887,6 +2908,8 @@ private:
     Vmm vmm_tmp = Vmm(1); // used only for avx2_vnni_2
     Vmm vmm_zp_b_shift = Vmm(2);
 
+    std::unique_ptr<fp8_emulation_base_t> fp8_emu_;
+
     void kmovx(Opmask k, unsigned w) {
         if (!isa_has_masks(conf_->isa)) return;
         const auto regw_tmp = reg_tmp.cvt32();
@@ -2925,7 +2948,8 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::copy_2x32(int nrows, int ncolumns) {
 
     static constexpr int blk_sz = k_blk_step;
     const int reserved_regs = req_zp_b_shift ? 3 : 2;
-    const int max_isa_regs = isa_num_vregs(conf_->isa);
+    const int max_isa_regs
+            = isa_num_vregs(conf_->isa) - (fp8_emu_ ? fp8_emu_vregs : 0);
     const int max_regs_available = max_isa_regs - reserved_regs;
     const int max_unroll = max_regs_available / blk_sz;
 
@@ -2954,7 +2978,11 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::copy_2x32(int nrows, int ncolumns) {
         } else {
             if (conf_->is_bf32)
                 uni_vmovups(src_load, load_addr);
-            else if (conf_->is_bf16_with_int_wei) {
+            else if (conf_->is_bf16_with_fp8_wei) {
+                // The conversion merges into the tail of the register.
+                if (is_tail) uni_vpxor(src_reg, src_reg, src_reg);
+                fp8_emu_->vcvt_f8_to_f32(src_load, load_addr);
+            } else if (conf_->is_bf16_with_int_wei) {
                 if (conf_->orig_wei_dt == data_type::s8)
                     uni_vpmovsxbd(src_load, load_addr);
                 else
@@ -3203,6 +3231,8 @@ void jit_brgemm_matmul_copy_b_bf16_t<Vmm>::generate() {
 
     add(rsp, stack_space_needed);
     postamble();
+
+    if (fp8_emu_) fp8_emu_->prepare_table();
 }
 
 template struct jit_brgemm_matmul_copy_b_bf16_t<Zmm>;
@@ -4145,7 +4175,10 @@ struct jit_brgemm_matmul_copy_b_cvt_bf16_t : public jit_brgemm_matmul_copy_b_t,
         , req_apply_scales_(conf_->apply_scales_in_buffer_b)
         , reserved_regs_(req_apply_scales_  ? 5
                           : req_zp_b_shift_ ? 1
-                                            : 0) {}
+                                            : 0)
+        , fp8_emu_(create_fp8_emulation(this, conf, reg_tmp, kAux))
+        , max_vregs_(isa_num_vregs(conf->isa)
+                  - (fp8_emu_ ? fp8_emu_vregs : 0)) {}
 
     void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
     status_t create_kernel() override { return jit_generator::create_kernel(); }
@@ -4166,6 +4199,7 @@ private:
 
     opmask_t kTail = k7;
     opmask_t kFFFF = k6;
+    opmask_t kAux = k5;
 
     reg64_t reg_src = rax;
     reg64_t reg_tr_src = rbx;
@@ -4175,6 +4209,10 @@ private:
     reg64_t reg_scales = r10;
     reg64_t reg_tmp = r11;
 
+    std::unique_ptr<fp8_emulation_base_t> fp8_emu_;
+    // The number of vector registers available to the copy routine.
+    const int max_vregs_;
+
     Vmm vmm_zp_b_val = Vmm(0);
     Vmm vmm_scales0 = Vmm(1);
     Vmm vmm_scales1 = Vmm(2);
@@ -4190,7 +4228,7 @@ private:
     }
 
     Vmm get_vmm(const int blk, const int idx) {
-        const int max_isa_regs = isa_num_vregs(conf_->isa);
+        const int max_isa_regs = max_vregs_;
         const int max_unroll = (max_isa_regs - reserved_regs_) / k_blk_step;
         assert(idx >= 0 && idx < k_blk_step && blk >= 0);
         const auto reg_idx
@@ -4253,7 +4291,7 @@ void jit_brgemm_matmul_copy_b_cvt_bf16_t<Vmm>::copy_block(
     }
 
     static constexpr int blk_sz = k_blk_step;
-    const int max_regs_available = isa_num_vregs(conf_->isa) - reserved_regs_;
+    const int max_regs_available = max_vregs_ - reserved_regs_;
     const int max_unroll = max_regs_available / blk_sz;
 
     // Every load converts unroll * k_blk_step * n_blk_step
@@ -4265,6 +4303,13 @@ void jit_brgemm_matmul_copy_b_cvt_bf16_t<Vmm>::copy_block(
         const auto stride = n_blk_step * typesize_;
         auto load_addr0 = maybe_EVEX_compress_addr(reg_src, offset);
         auto load_addr1 = maybe_EVEX_compress_addr(reg_src, offset + stride);
+        if (fp8_emu_) {
+            // The padded part of the blocked weights holds zeros.
+            fp8_emu_->vcvt_f8_to_f32(src_vmm0, load_addr0);
+            fp8_emu_->vcvt_f8_to_f32(src_vmm1, load_addr1);
+            vcvtne2ps2bf16(src_vmm0, src_vmm1, src_vmm0);
+            return;
+        }
         if (conf_->orig_wei_dt == data_type::s8) {
             vpmovsxbd(src_vmm0, load_addr0);
             vpmovsxbd(src_vmm1, load_addr1);
@@ -4385,6 +4430,8 @@ void jit_brgemm_matmul_copy_b_cvt_bf16_t<Vmm>::generate() {
     L(done);
 
     postamble();
+
+    if (fp8_emu_) fp8_emu_->prepare_table();
 }
 
 template struct jit_brgemm_matmul_copy_b_cvt_bf16_t<Zmm>;
@@ -4408,7 +4455,8 @@ status_t create_brgemm_matmul_copy_b(
                     new jit_brgemm_matmul_copy_b_transposed_t<Ymm>(conf)));
         }
     } else {
-        if (conf->is_bf16_with_int_wei && conf->blocked_B) {
+        if ((conf->is_bf16_with_int_wei || conf->is_bf16_with_fp8_wei)
+                && conf->blocked_B) {
             if (is_superset(conf->isa, avx512_core))
                 CHECK(safe_ptr_assign(copy_ker,
                         new jit_brgemm_matmul_copy_b_cvt_bf16_t<Zmm>(conf)));
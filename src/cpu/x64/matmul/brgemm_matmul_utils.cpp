@@ -164,7 +164,11 @@ status_t check_isa_with_datatype(
             && IMPLICATION(bm_conf_utils.is_int8_with_bf16_dst(),
                     is_superset(isa, avx512_core) || isa == avx2_vnni_2)
             && IMPLICATION(bm_conf_utils.is_bf16_with_int_wei(),
-                    is_superset(isa, avx512_core_bf16));
+                    is_superset(isa, avx512_core_bf16))
+            // The fp8 conversion relies on the avx512_core_fp16 instructions.
+            && IMPLICATION(bm_conf_utils.is_bf16_with_fp8_wei(),
+                    one_of(isa, avx512_core_amx, avx512_core_bf16)
+                            && mayiuse(avx512_core_fp16));
     return ok ? status::success : status::unimplemented;
 }
 
@@ -172,7 +176,8 @@ status_t check_datatype_cfg(const brgemm_matmul_conf_utils_t &bm_conf_utils) {
     const bool ok = one_of(true, bm_conf_utils.is_f32(),
                             bm_conf_utils.is_bf16(), bm_conf_utils.is_f16(),
                             bm_conf_utils.is_bf32(), bm_conf_utils.is_int8(),
-                            bm_conf_utils.is_bf16_with_int_wei())
+                            bm_conf_utils.is_bf16_with_int_wei(),
+                            bm_conf_utils.is_bf16_with_fp8_wei())
             && IMPLICATION(bm_conf_utils.is_bf16_with_int_wei(),
                     bm_conf_utils.with_weights_decompression());
     return ok ? status::success : status::unimplemented;
@@ -196,6 +201,9 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
     , bf16_with_int_wei_dt(bgmmc.src_dt == bf16
               && utils::one_of(bgmmc.wei_dt, u8, s8)
               && one_of(bgmmc.dst_dt, bf16, f32))
+    , bf16_with_fp8_wei_dt(bgmmc.src_dt == bf16
+              && utils::one_of(bgmmc.wei_dt, f8_e5m2, f8_e4m3)
+              && one_of(bgmmc.dst_dt, bf16, f32))
     , weights_decompression_support(one_of(bgmmc.wei_dt, u8, s8)
               && one_of(attr.fpmath_.mode_, fpmath_mode::bf16, fpmath_mode::any)
               && attr.fpmath_.apply_to_int_)
@@ -304,7 +312,8 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_tags(memory_desc_t &A_md,
                 = this->is_int8() && is_superset(bgmmc.isa, avx512_core);
         bgmmc.src_tag
                 = (this->is_bf16() || this->is_f32() || this->is_bf32()
-                          || this->is_f16() || this->is_bf16_with_int_wei())
+                          || this->is_f16() || this->is_bf16_with_int_wei()
+                          || this->is_bf16_with_fp8_wei())
                         && !xf16_avx2_vnni_2
                 ? memory_desc_matches_one_of_tag(A_md, plain_tensor_layout_tag,
                         transposed_tensor_layout_tag, acbd, adbc)
@@ -377,6 +386,7 @@ format_tag_t brgemm_matmul_conf_utils_t::pick_blocked_B_layout(
         }
 
     if (this->is_bf16() || this->is_bf16_with_int_wei()
+            || this->is_bf16_with_fp8_wei()
             || (this->is_f16() && bgmmc.isa != avx512_core_fp16))
         switch (n_blk) {
             case 64: return bgmmc.ndims == 3 ? aCB16b64c2b : BA16a64b2a;
@@ -640,7 +650,8 @@ void compute_blocking_heuristic_amx(const brgemm_matmul_conf_t &bgmmc,
     const bool is_amx_xf16 = bgmmc.is_amx
             && (bm_conf_utils.is_bf16() || bm_conf_utils.is_f16()
                     || bm_conf_utils.is_bf32()
-                    || bm_conf_utils.is_bf16_with_int_wei());
+                    || bm_conf_utils.is_bf16_with_int_wei()
+                    || bm_conf_utils.is_bf16_with_fp8_wei());
     const bool is_amx_int8 = bgmmc.is_amx && bm_conf_utils.is_int8();
 
     const bool runtime_dims
@@ -1189,11 +1200,13 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     }
     bgmmc.is_bf32 = bm_conf_utils.is_bf32();
     bgmmc.is_bf16_with_int_wei = bm_conf_utils.is_bf16_with_int_wei();
+    bgmmc.is_bf16_with_fp8_wei = bm_conf_utils.is_bf16_with_fp8_wei();
     bgmmc.with_wei_decompression = bm_conf_utils.with_weights_decompression();
 
     // Make BRGeMM compute MatMul as if it were in bfloat16, while down-convert
     // happens during copy-buffer computations
-    if (bgmmc.is_bf32 || bgmmc.is_bf16_with_int_wei) {
+    if (bgmmc.is_bf32 || bgmmc.is_bf16_with_int_wei
+            || bgmmc.is_bf16_with_fp8_wei) {
         bgmmc.src_dt = bf16;
         bgmmc.wei_dt = bf16;
         bgmmc.tr_a_dt_sz = types::data_type_size(bf16);
@@ -1320,6 +1333,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.blocked_B = bm_conf_utils.get_blocked_B();
     bgmmc.transposed_B = bm_conf_utils.check_is_transposed(bgmmc.wei_tag)
             || bgmmc.wei_tag == adbc;
+    // The transposed weights copy routine does not convert fp8 values.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.is_bf16_with_fp8_wei, !bgmmc.transposed_B),
+            VERBOSE_UNSUPPORTED_TAG);
     bgmmc.use_buffer_b = bm_conf_utils.use_buffer_b();
     bgmmc.req_transpose_scales = bgmmc.apply_scales_in_buffer_b
             && bgmmc.is_oscale_per_k && bgmmc.is_oscale_per_n
@@ -1406,6 +1422,7 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             = one_of(true, bm_conf_utils.is_f32() && bgmmc.isa == avx2,
                       bm_conf_utils.is_bf16(),
                       bm_conf_utils.is_bf16_with_int_wei(),
+                      bm_conf_utils.is_bf16_with_fp8_wei(),
                       (bgmmc.is_amx && bm_conf_utils.is_f16()))
             && (bgmmc.isa != avx2_vnni_2) // no perf study yet.
             && bgmmc.lda_big_pow2() && bgmmc.M >= 1024;
@@ -1512,7 +1529,8 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     is_small_shapes = is_small_shapes && (bgmmc.isa != avx512_core_amx_fp16);
 
     if (bm_conf_utils.is_bf16() || bm_conf_utils.is_f16()
-            || bm_conf_utils.is_bf16_with_int_wei()) {
+            || bm_conf_utils.is_bf16_with_int_wei()
+            || bm_conf_utils.is_bf16_with_fp8_wei()) {
         // empirical observation for performance breakpoint between amx and vnni
         // bf16/f16
         const dim_t buffer_a_chunk_sz_limit = 126;
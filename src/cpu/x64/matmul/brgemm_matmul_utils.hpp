@@ -188,6 +188,8 @@ struct brgemm_matmul_conf_t {
     int required_k_granularity;
     bool is_bf32 = false;
     bool is_bf16_with_int_wei = false;
+    // The fp8 weights are up-converted to bf16 in the copy routines.
+    bool is_bf16_with_fp8_wei = false;
     bool req_wei_vnni_downconvert = false;
     bool is_runtime_M = false;
     bool is_runtime_N = false;
@@ -220,7 +222,8 @@ struct brgemm_matmul_conf_utils_t {
 
     inline bool use_buffer_b(bool use_heuristic = true) const {
         if (bgmmc.is_runtime_N) return true;
-        if (bgmmc.is_bf16_with_int_wei) return true;
+        if (bgmmc.is_bf16_with_int_wei || bgmmc.is_bf16_with_fp8_wei)
+            return true;
         if (bgmmc.apply_scales_in_buffer_b) return true;
 
         if (bgmmc.is_amx)
@@ -287,6 +290,8 @@ struct brgemm_matmul_conf_utils_t {
 
     inline bool is_bf16_with_int_wei() const { return bf16_with_int_wei_dt; }
 
+    inline bool is_bf16_with_fp8_wei() const { return bf16_with_fp8_wei_dt; }
+
     inline bool with_weights_decompression() const {
         return !utils::one_of(bgmmc.src_dt, data_type::s8, data_type::u8)
                 && weights_decompression_support;
@@ -297,7 +302,8 @@ struct brgemm_matmul_conf_utils_t {
     }
 
     inline bool wei_down_convert_to_vnni() const {
-        return (bf32_dt || bf16_with_int_wei_dt) && get_blocked_B();
+        return (bf32_dt || bf16_with_int_wei_dt || bf16_with_fp8_wei_dt)
+                && get_blocked_B();
     }
 
     inline bool is_any_B_layout() const { return B_any_layout; }
@@ -316,7 +322,8 @@ struct brgemm_matmul_conf_utils_t {
 private:
     brgemm_matmul_conf_t &bgmmc;
 
-    const bool f32_dt, bf16_dt, f16_dt, int8_dt, bf32_dt, bf16_with_int_wei_dt;
+    const bool f32_dt, bf16_dt, f16_dt, int8_dt, bf32_dt, bf16_with_int_wei_dt,
+            bf16_with_fp8_wei_dt;
     const bool weights_decompression_support;
     const bool A_any_layout;
     const bool B_any_layout;
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2022 Intel Corporation
+* Copyright 2020-2024 Intel Corporation
 * Copyright 2020 Codeplay Software Limited
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
@@ -42,6 +42,8 @@ struct miopen_binary_t : public primitive_t {
         status_t init(engine_t *) {
             using namespace data_type;
 
+            if (is_ternary_op()) return status::unimplemented;
+
             bool ok = (set_default_params() == status::success)
                     && check_data_types() && check_no_blocking()
                     && check_broadcast()
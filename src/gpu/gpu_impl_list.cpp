@@ -48,6 +48,10 @@ const impl_list_item_t *gpu_impl_list_t::get_implementation_list(
             CASE(shuffle);
             CASE(softmax);
             CASE(zero_pad);
+            // embedding bag, rope and top-k are not implemented on GPU
+            case primitive_kind::embedding_bag:
+            case primitive_kind::rope:
+            case primitive_kind::top_k: return empty_list;
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -41,6 +41,8 @@ struct gen9_binary_t : public gpu_primitive_t {
             using namespace format_tag;
             using sm = primitive_attr_t::skip_mask_t;
 
+            VDISPATCH_BINARY(!is_ternary_op(), VERBOSE_BAD_ALGORITHM);
+
             auto *compute_engine
                     = utils::downcast<compute::compute_engine_t *>(engine);
 
@@ -41,6 +41,7 @@ struct multi_po_reorder_binary : public gpu_primitive_t {
         DECLARE_COMMON_PD_T("multi_po_reorder_binary", multi_po_reorder_binary);
 
         status_t init(engine_t *engine) {
+            VDISPATCH_BINARY(!is_ternary_op(), VERBOSE_BAD_ALGORITHM);
             if (attr()->scales_.get(DNNL_ARG_SRC_0).is_set_
                     || attr()->scales_.get(DNNL_ARG_SRC_1).is_set_
                     || attr()->post_ops_.len() >= 1) {
@@ -42,6 +42,7 @@ struct ref_binary_t : public gpu_primitive_t {
 
             const auto attr_skip_mask = sm::post_ops | sm::scales_runtime;
 
+            VDISPATCH_BINARY(!is_ternary_op(), VERBOSE_BAD_ALGORITHM);
             VDISPATCH_BINARY_SC(set_default_params(), VERBOSE_UNSUPPORTED_TAG);
             VDISPATCH_BINARY(
                     ((utils::everyone_is(
@@ -53,6 +53,8 @@ struct ref_layer_normalization_fwd_t : public gpu_primitive_t {
             bool uses_f64 = utils::one_of(f64, src_dt, dst_dt);
 
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(
+                    !skip_mean(), VERBOSE_UNSUPPORTED_FEATURE, "rms norm");
             VDISPATCH_LNORM(IMPLICATION(uses_f16,
                                     compute_engine->mayiuse(
                                             compute::device_ext_t::khr_fp16))
@@ -138,6 +140,8 @@ struct ref_layer_normalization_bwd_t : public gpu_primitive_t {
                     = utils::one_of(f64, src_dt, diff_dst_dt, diff_src_dt);
 
             VDISPATCH_LNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(
+                    !skip_mean(), VERBOSE_UNSUPPORTED_FEATURE, "rms norm");
             VDISPATCH_LNORM(IMPLICATION(uses_f16,
                                     compute_engine->mayiuse(
                                             compute::device_ext_t::khr_fp16))
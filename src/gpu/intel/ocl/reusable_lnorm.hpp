@@ -107,6 +107,8 @@ struct reusable_layer_normalization_fwd_t : public gpu_primitive_t {
                     compute_engine->mayiuse(compute::device_ext_t::khr_fp64));
 
             VDISPATCH_LNORM(is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(
+                    !skip_mean(), VERBOSE_UNSUPPORTED_FEATURE, "rms norm");
             VDISPATCH_LNORM(f16_ok, VERBOSE_UNSUPPORTED_DEVICE_FEATURE, "fp16");
             VDISPATCH_LNORM(f64_ok, VERBOSE_UNSUPPORTED_DEVICE_FEATURE, "fp64");
             VDISPATCH_LNORM(check_scale_shift_data_type({f32, bf16, f16}),
@@ -186,6 +188,8 @@ struct reusable_layer_normalization_bwd_t : public gpu_primitive_t {
                     compute_engine->mayiuse(compute::device_ext_t::khr_fp64));
 
             VDISPATCH_LNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_LNORM(
+                    !skip_mean(), VERBOSE_UNSUPPORTED_FEATURE, "rms norm");
             VDISPATCH_LNORM(f16_ok, VERBOSE_UNSUPPORTED_DEVICE_FEATURE, "fp16");
             VDISPATCH_LNORM(f64_ok, VERBOSE_UNSUPPORTED_DEVICE_FEATURE, "fp64");
             VDISPATCH_LNORM(check_scale_shift_data_type({f32, bf16, f16}),
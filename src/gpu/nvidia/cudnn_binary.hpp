@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2023 Intel Corporation
+* Copyright 2020-2024 Intel Corporation
 * Copyright 2020 Codeplay Software Limited
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
@@ -43,6 +43,8 @@ struct cudnn_binary_t : public primitive_t {
         status_t init(engine_t *engine) {
             using namespace data_type;
 
+            if (is_ternary_op()) return status::unimplemented;
+
             bool ok = (set_default_params() == status::success)
                     && check_data_types(engine) && check_no_blocking()
                     && check_broadcast()
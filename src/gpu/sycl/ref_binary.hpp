@@ -43,6 +43,8 @@ struct ref_binary_t : public sycl_gpu_primitive_t {
             using namespace data_type;
             using sm = primitive_attr_t::skip_mask_t;
 
+            VDISPATCH_BINARY(!is_ternary_op(), VERBOSE_BAD_ALGORITHM);
+
             const memory_desc_wrapper src0_d(src_md(0));
             const memory_desc_wrapper src1_d(src_md(1));
             const memory_desc_wrapper dst_d(dst_md());
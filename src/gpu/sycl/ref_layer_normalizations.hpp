@@ -52,6 +52,7 @@ struct ref_layer_normalization_fwd_t : public sycl_gpu_primitive_t {
             const memory_desc_wrapper var_d(src_md(2));
 
             const bool ok = is_fwd()
+                    && !skip_mean()
                     && (src_md(0)->format_desc.blocking.inner_nblks == 0)
                     && utils::one_of(
                             src_md(0)->data_type, f32, bf16, f16, s8, u8)
@@ -101,6 +102,7 @@ struct ref_layer_normalization_bwd_t : public sycl_gpu_primitive_t {
             const memory_desc_wrapper var_d(src_md(2));
 
             const bool ok = !is_fwd()
+                    && !skip_mean()
                     && (src_md(0)->format_desc.blocking.inner_nblks == 0)
                     && (diff_dst_md(0)->format_desc.blocking.inner_nblks == 0)
                     && utils::one_of(src_md(0)->data_type, f32, bf16)
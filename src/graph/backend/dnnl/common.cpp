@@ -441,6 +441,52 @@ bool is_plain(const memory::desc &adesc) {
     return adesc.get_inner_nblks() == 0;
 }
 
+bool get_concat_src_offsets(const memory::desc &dst,
+        const std::vector<memory::desc> &srcs, int axis,
+        std::vector<size_t> &offsets) {
+    offsets.clear();
+    const int ndims = dst.get_ndims();
+    if (!is_plain(dst) || axis < 0 || axis >= ndims) return false;
+
+    const auto dt = dst.get_data_type();
+    const auto is_dense = [](const memory::desc &md) {
+        const auto &dims = md.get_dims();
+        const auto nelems = std::accumulate(dims.begin(), dims.end(),
+                (dim_t)1, std::multiplies<dim_t>());
+        const size_t dt_size = memory::data_type_size(md.get_data_type());
+        return nelems > 0
+                && md.get_size() == static_cast<size_t>(nelems) * dt_size;
+    };
+    if (!is_dense(dst)) return false;
+
+    const auto &dims = dst.get_dims();
+    const auto &strides = dst.get_strides();
+    for (int d = 0; d < ndims; d++) {
+        if (d != axis && dims[d] != 1 && strides[d] >= strides[axis])
+            return false;
+    }
+
+    size_t offset = 0;
+    for (const auto &src : srcs) {
+        if (!is_plain(src) || src.get_data_type() != dt || !is_dense(src)
+                || src.get_ndims() != ndims)
+            return false;
+        const auto &src_dims = src.get_dims();
+        const auto &src_strides = src.get_strides();
+        for (int d = 0; d < ndims; d++) {
+            if (src_dims[d] != 1 && src_strides[d] != strides[d])
+                return false;
+        }
+        offsets.emplace_back(offset);
+        offset += src.get_size();
+    }
+    if (offset != dst.get_size()) {
+        offsets.clear();
+        return false;
+    }
+    return true;
+}
+
 // get the dense strides of a given shape
 // eg. (3, 4, 5) -> (20, 5, 1)
 dims get_dense_strides(const dims &shape) {
@@ -124,6 +124,13 @@ bool is_4c_blocked(const memory::desc &adesc);
 
 bool is_plain(const memory::desc &adesc);
 
+// Get the byte offsets of the concat sources in the destination if each
+// source is a contiguous part of the destination, which is the case when the
+// dimensions outer to the concat axis are all 1.
+bool get_concat_src_offsets(const memory::desc &dst,
+        const std::vector<memory::desc> &srcs, int axis,
+        std::vector<size_t> &offsets);
+
 memory::desc to_ncx_format(const memory::desc &adesc);
 
 void set_all_layout_to_any(std::vector<std::shared_ptr<op_t>> &subgraph);
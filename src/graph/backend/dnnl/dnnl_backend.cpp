@@ -67,6 +67,7 @@ pass::pass_registry_t dnnl_backend::register_passes() {
     DNNL_BACKEND_REGISTER_PATTERN_CALL(interpolate_fusion, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(softmax_post_ops, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(layernorm_fusion, pass_registry);
+    DNNL_BACKEND_REGISTER_PATTERN_CALL(groupnorm_fusion, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(sum_fusion, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(reorder_fusion, pass_registry);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(shuffle_fusion, pass_registry);
@@ -117,6 +118,10 @@ kernel_ptr large_partition_kernel_creator() {
 kernel_ptr dummy_kernel_creator() {
     return std::make_shared<dummy_kernel_t>();
 }
+
+kernel_ptr dynamic_shape_kernel_creator(const FCreateKernel &kernel_creator) {
+    return std::make_shared<dynamic_shape_kernel_t>(kernel_creator);
+}
 } // namespace dnnl_impl
 
 // This function should be called by backend_registry_t
@@ -70,6 +70,16 @@ struct kernel_base_t {
         return execute_impl(astream, inputs, outputs);
     }
 
+    // Execute the kernel with a scratchpad buffer provided by users, which
+    // should have at least get_scratchpad_size() bytes. The buffer is used for
+    // the internal temporary memory instead of allocating it during execution.
+    status_t execute(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, void *scratchpad) {
+        return execute_with_scratchpad_impl(
+                astream, inputs, outputs, scratchpad);
+    }
+
 #ifdef DNNL_WITH_SYCL
     status_t execute_sycl(const stream_t *astream,
             const std::vector<tensor_t> &inputs,
@@ -114,6 +124,17 @@ struct kernel_base_t {
             const std::vector<tensor_t> &outputs)
             = 0;
 
+    // The size of the user scratchpad required by the kernel. 0 means the
+    // kernel doesn't need or doesn't support user scratchpad.
+    virtual size_t get_scratchpad_size() const { return 0; }
+
+    virtual status_t execute_with_scratchpad_impl(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, void *scratchpad) {
+        UNUSED(scratchpad);
+        return execute_impl(astream, inputs, outputs);
+    }
+
     virtual status_t prepare_inplace_pairs_impl() { return status::success; };
 
     bool enabled_constant_cache() const;
@@ -127,6 +148,7 @@ using FCreateKernel = std::function<kernel_ptr(void)>;
 
 kernel_ptr large_partition_kernel_creator();
 kernel_ptr dummy_kernel_creator();
+kernel_ptr dynamic_shape_kernel_creator(const FCreateKernel &kernel_creator);
 
 class dnnl_backend : public backend_t {
     friend class dnnl_partition_impl_t;
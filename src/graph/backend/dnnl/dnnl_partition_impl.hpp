@@ -17,6 +17,7 @@
 #ifndef GRAPH_BACKEND_DNNL_DNNL_PARTITION_IMPL_HPP
 #define GRAPH_BACKEND_DNNL_DNNL_PARTITION_IMPL_HPP
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -75,6 +76,17 @@ public:
         return kernel_->execute(g_stream, inputs, outputs);
     }
 
+    size_t get_scratchpad_size() const override {
+        return kernel_->get_scratchpad_size();
+    }
+
+    status_t execute_with_scratchpad(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, void *scratchpad) override {
+        // We don't need to resort the inputs and outputs
+        return kernel_->execute(g_stream, inputs, outputs, scratchpad);
+    }
+
 #ifdef DNNL_WITH_SYCL
     status_t execute_sycl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
@@ -217,7 +229,17 @@ public:
             }
         }
 
-        kernel_ptr kernel = kernel_creator();
+        // If some input dimensions are unknown, the partition is compiled for
+        // symbolic shapes and specialized for the concrete shapes given at
+        // execution.
+        const bool is_symbolic = std::any_of(inputs.begin(), inputs.end(),
+                [](const logical_tensor_t &lt) {
+                    return logical_tensor_wrapper_t(lt).is_shape_unknown();
+                });
+
+        kernel_ptr kernel = is_symbolic
+                ? dynamic_shape_kernel_creator(kernel_creator)
+                : kernel_creator();
         if (!kernel) return status::unimplemented;
 
         status_t ret;
@@ -76,7 +76,10 @@ namespace op_kind {
     X(dnnl_layernorm, Dnnl_layernorm) \
     X(dnnl_reorder, Dnnl_reorder) \
     X(dnnl_convtranspose_bwd_data, Dnnl_convtranspose_bwd_data) \
-    X(dnnl_convtranspose_bwd_weights, Dnnl_convtranspose_bwd_weights)
+    X(dnnl_convtranspose_bwd_weights, Dnnl_convtranspose_bwd_weights) \
+    X(dnnl_rope, Dnnl_rope) \
+    X(dnnl_top_k, Dnnl_top_k) \
+    X(dnnl_groupnorm, Dnnl_groupnorm)
 
 enum kind_t {
     kDNNL_INTERNAL_OP_STARTER = 0x1234,
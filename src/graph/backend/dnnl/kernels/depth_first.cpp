@@ -0,0 +1,246 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+#include "cpu/platform.hpp"
+
+#include "graph/backend/dnnl/kernels/depth_first.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+using ltw = logical_tensor_wrapper_t;
+
+namespace {
+
+// A tensor can be split along the batch dimension if it has plain strided
+// layout whose first dimension is the batch.
+bool is_batched(const logical_tensor_t &lt, dim_t batch) {
+    const ltw lt_w(lt);
+    return lt_w.is_strided() && !lt_w.is_constant() && lt_w.ndims() > 1
+            && !lt_w.is_shape_unknown() && !lt_w.is_stride_unknown()
+            && lt_w.dims()[0] == batch;
+}
+
+logical_tensor_t make_tile_lt(const logical_tensor_t &lt, dim_t tile) {
+    logical_tensor_t tile_lt = lt;
+    tile_lt.dims[0] = tile;
+    return tile_lt;
+}
+
+// The compilation transforms the ops of the partition, so each kernel is
+// compiled on its own copy of the partition.
+std::shared_ptr<dnnl_partition_impl_t> clone_partition(
+        const dnnl_partition_impl_t *part) {
+    return std::dynamic_pointer_cast<dnnl_partition_impl_t>(part->clone());
+}
+
+} // namespace
+
+status_t depth_first_kernel_t::compile_tile_kernel(
+        std::shared_ptr<larger_partition_kernel_t> &kernel,
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs, dim_t tile) const {
+    std::vector<logical_tensor_t> tile_inputs, tile_outputs;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        tile_inputs.emplace_back(batched_inputs_[i]
+                        ? make_tile_lt(inputs[i], tile)
+                        : inputs[i]);
+    }
+    for (const auto &out : outputs) {
+        tile_outputs.emplace_back(make_tile_lt(out, tile));
+    }
+
+    kernel = std::make_shared<larger_partition_kernel_t>();
+    status_t ret = kernel->compile(
+            clone_partition(part).get(), g_engine, tile_inputs, tile_outputs);
+    if (ret != status::success) return ret;
+
+    // The tile kernel must produce the same outputs as a sub-tensor of the full
+    // batch outputs, otherwise the ops are not batch independent.
+    for (size_t i = 0; i < outputs.size(); i++) {
+        const ltw full_w(outputs[i]), tile_w(tile_outputs[i]);
+        if (!tile_w.is_strided() || tile_w.ndims() != full_w.ndims()
+                || tile_w.dims()[0] != tile)
+            return status::unimplemented;
+        for (int d = 0; d < full_w.ndims(); d++) {
+            if (tile_w.strides()[d] != full_w.strides()[d]
+                    || (d > 0 && tile_w.dims()[d] != full_w.dims()[d]))
+                return status::unimplemented;
+        }
+    }
+    return status::success;
+}
+
+status_t depth_first_kernel_t::compile_impl(const dnnl_partition_impl_t *part,
+        const engine_t *g_engine, const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    full_kernel_ = std::make_shared<larger_partition_kernel_t>();
+    BACKEND_DNNL_CHECK(full_kernel_->compile(
+            clone_partition(part).get(), g_engine, inputs, outputs));
+    p_engine_ = full_kernel_->p_engine_;
+
+    const int depth_first_mode
+            = graph::utils::getenv_int_internal("ENABLE_DEPTH_FIRST", 0);
+    if (g_engine->kind() != engine_kind::cpu || depth_first_mode <= 0)
+        return status::success;
+
+    // The outputs have been filled with the compiled layouts. All of them must
+    // be splittable along the same batch dimension.
+    if (outputs.empty() || ltw(outputs[0]).ndims() <= 1)
+        return status::success;
+    batch_ = ltw(outputs[0]).dims()[0];
+    if (batch_ <= 1) return status::success;
+    for (const auto &out : outputs) {
+        if (!is_batched(out, batch_)) return status::success;
+    }
+
+    batched_inputs_.clear();
+    for (const auto &in : inputs) {
+        batched_inputs_.push_back(is_batched(in, batch_));
+    }
+    if (std::none_of(batched_inputs_.begin(), batched_inputs_.end(),
+                [](bool b) { return b; }))
+        return status::success;
+
+    // Tile the batch only if the intermediates of the full batch don't fit in
+    // the L2 caches of all threads.
+    dim_t tile = impl::utils::div_up(batch_, 2);
+    if (depth_first_mode == 1) {
+        const size_t temp_size = full_kernel_->get_internal_temporary_size();
+        const size_t cache_size = cpu::platform::get_per_core_cache_size(2)
+                * static_cast<size_t>(dnnl_get_max_threads());
+        if (temp_size <= cache_size) return status::success;
+
+        const size_t sample_size
+                = impl::utils::div_up(temp_size, static_cast<size_t>(batch_));
+        tile = std::max<dim_t>(
+                1, static_cast<dim_t>(cache_size / sample_size));
+    }
+    if (tile >= batch_) return status::success;
+
+    // Fall back to the full batch kernel if the partition can't be compiled
+    // for the tiles.
+    if (compile_tile_kernel(
+                tile_kernel_, part, g_engine, inputs, outputs, tile)
+            != status::success) {
+        tile_kernel_.reset();
+        return status::success;
+    }
+    if (batch_ % tile != 0
+            && compile_tile_kernel(tail_kernel_, part, g_engine, inputs,
+                       outputs, batch_ % tile)
+                    != status::success) {
+        tile_kernel_.reset();
+        tail_kernel_.reset();
+        return status::success;
+    }
+    tile_ = tile;
+
+    input_batch_strides_.clear();
+    for (const auto &in : inputs) {
+        const ltw in_w(in);
+        input_batch_strides_.push_back(in_w.ndims() > 0 && in_w.is_strided()
+                        ? static_cast<size_t>(in_w.strides()[0])
+                                * in_w.data_type_size()
+                        : 0);
+    }
+    output_batch_strides_.clear();
+    for (const auto &out : outputs) {
+        const ltw out_w(out);
+        output_batch_strides_.push_back(
+                static_cast<size_t>(out_w.strides()[0])
+                * out_w.data_type_size());
+    }
+
+    return status::success;
+}
+
+size_t depth_first_kernel_t::get_scratchpad_size() const {
+    if (!is_tiled()) return full_kernel_->get_scratchpad_size();
+    // the tiles are executed one by one, so they can share the scratchpad
+    size_t size = tile_kernel_->get_scratchpad_size();
+    if (tail_kernel_)
+        size = std::max(size, tail_kernel_->get_scratchpad_size());
+    return size;
+}
+
+status_t depth_first_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    return execute_tiles(g_stream, inputs, outputs, nullptr);
+}
+
+status_t depth_first_kernel_t::execute_with_scratchpad_impl(
+        const stream_t *g_stream, const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs, void *scratchpad) {
+    return execute_tiles(g_stream, inputs, outputs, scratchpad);
+}
+
+status_t depth_first_kernel_t::execute_tiles(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs, void *scratchpad) {
+    const auto execute_kernel = [&](larger_partition_kernel_t *kernel,
+                                        const std::vector<tensor_t> &ins,
+                                        const std::vector<tensor_t> &outs) {
+        return scratchpad ? kernel->execute_with_scratchpad_impl(
+                       g_stream, ins, outs, scratchpad)
+                          : kernel->execute_impl(g_stream, ins, outs);
+    };
+
+    if (!is_tiled())
+        return execute_kernel(full_kernel_.get(), inputs, outputs);
+
+    auto get_tile_tensor
+            = [](const tensor_t &ts, size_t batch_stride, dim_t start) {
+                  char *handle = static_cast<char *>(ts.get_data_handle())
+                          + batch_stride * static_cast<size_t>(start);
+                  return tensor_t(ts.get_logical_tensor(), ts.get_engine(),
+                          static_cast<void *>(handle));
+              };
+
+    std::vector<tensor_t> tile_inputs(inputs.size()),
+            tile_outputs(outputs.size());
+    for (dim_t start = 0; start < batch_; start += tile_) {
+        const dim_t cur_tile = std::min(tile_, batch_ - start);
+        for (size_t i = 0; i < inputs.size(); i++) {
+            tile_inputs[i] = batched_inputs_[i]
+                    ? get_tile_tensor(
+                            inputs[i], input_batch_strides_[i], start)
+                    : inputs[i];
+        }
+        for (size_t i = 0; i < outputs.size(); i++) {
+            tile_outputs[i] = get_tile_tensor(
+                    outputs[i], output_batch_strides_[i], start);
+        }
+
+        auto &kernel = cur_tile == tile_ ? tile_kernel_ : tail_kernel_;
+        status_t ret = execute_kernel(kernel.get(), tile_inputs, tile_outputs);
+        if (ret != status::success) return ret;
+    }
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_DEPTH_FIRST_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_DEPTH_FIRST_HPP
+
+#include <memory>
+#include <vector>
+
+#include "graph/interface/backend.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// The depth_first_kernel_t executes a chain of batch independent ops (such as
+// the conv blocks of a CNN) tile by tile along the batch dimension. Instead of
+// writing each full size intermediate tensor to memory, the whole chain is run
+// on a tile of the batch before moving to the next one, so the intermediate
+// tensors of a tile are small enough to stay in cache.
+//
+// The kernel compiles the partition for the full batch first. If the tiling is
+// enabled and the temporary memory footprint of the full batch exceeds the
+// total L2 cache size, it compiles another kernel for the tile size (and one
+// for the tail tile if the batch size is not divisible by the tile size), and
+// executes them on the sub-buffers of batched inputs and outputs. Otherwise, or
+// if the inputs and outputs can't be split along the batch dimension, it falls
+// back to the full batch kernel.
+//
+// Note: The kernel only handles tiling along the batch dimension, so it should
+// only be used for partitions which don't reduce across the batch.
+//
+// The following internal env var can be used to control the kernel:
+// - _ONEDNN_ENABLE_DEPTH_FIRST
+//     - 0 (default): Always execute the partition for the full batch
+//     - 1: Tile the batch if the intermediates don't fit in cache
+//     - 2: Always split the batch into two tiles. For testing purpose only
+// The tiling is disabled by default until it is proven to pay off, since it
+// compiles up to three kernels for a partition.
+class depth_first_kernel_t : public kernel_base_t {
+private:
+    std::shared_ptr<larger_partition_kernel_t> full_kernel_;
+    std::shared_ptr<larger_partition_kernel_t> tile_kernel_;
+    std::shared_ptr<larger_partition_kernel_t> tail_kernel_;
+
+    dim_t batch_ = 0;
+    dim_t tile_ = 0;
+    // whether each input is split along the batch dimension
+    std::vector<bool> batched_inputs_;
+    // the byte strides of the batch dimension of inputs and outputs
+    std::vector<size_t> input_batch_strides_;
+    std::vector<size_t> output_batch_strides_;
+
+    status_t compile_tile_kernel(
+            std::shared_ptr<larger_partition_kernel_t> &kernel,
+            const dnnl_partition_impl_t *part, const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs, dim_t tile) const;
+
+    // execute the tiles with the user scratchpad if it's not nullptr
+    status_t execute_tiles(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, void *scratchpad);
+
+public:
+    // whether the partition is executed tile by tile
+    bool is_tiled() const { return tile_kernel_ != nullptr; }
+    dim_t get_tile_size() const { return tile_; }
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t prepare_inplace_pairs_impl() override {
+        // report the inplace pairs of the kernel which is actually executed
+        if (is_tiled()) {
+            inplace_pairs_ = tile_kernel_->inplace_pairs_;
+            if (tail_kernel_) {
+                std::vector<inplace_pair_t> pairs;
+                for (const auto &pair : inplace_pairs_) {
+                    for (const auto &tail_pair : tail_kernel_->inplace_pairs_) {
+                        if (pair.input_id == tail_pair.input_id
+                                && pair.output_id == tail_pair.output_id)
+                            pairs.emplace_back(pair);
+                    }
+                }
+                inplace_pairs_ = pairs;
+            }
+        } else {
+            inplace_pairs_ = full_kernel_->inplace_pairs_;
+        }
+        return status::success;
+    }
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+    size_t get_scratchpad_size() const override;
+
+    status_t execute_with_scratchpad_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, void *scratchpad) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        return full_kernel_->sycl_execute_impl(
+                g_stream, inputs, outputs, sycl_deps, sycl_event);
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &deps, cl_event *event) override {
+        return full_kernel_->ocl_execute_impl(
+                g_stream, inputs, outputs, deps, event);
+    }
+#endif
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,292 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "graph/utils/utils.hpp"
+
+#include "graph/backend/dnnl/scratchpad.hpp"
+
+#include "graph/backend/dnnl/kernels/dynamic_shape.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+using ltw = logical_tensor_wrapper_t;
+
+namespace {
+
+// Parse the bucket values from ONEDNN_GRAPH_DYNAMIC_SHAPE_BUCKETS, which is a
+// comma separated list of positive values. Return an empty list if the env var
+// is not set or invalid.
+std::vector<dim_t> get_buckets() {
+    const std::string str
+            = impl::getenv_string_user("GRAPH_DYNAMIC_SHAPE_BUCKETS");
+    std::vector<dim_t> buckets;
+    for (const auto &field : graph::utils::split(str, ',')) {
+        if (field.empty()) continue;
+        char *end = nullptr;
+        const long long value = std::strtoll(field.c_str(), &end, 10);
+        if (*end != '\0' || value <= 0) return {};
+        buckets.emplace_back(static_cast<dim_t>(value));
+    }
+    std::sort(buckets.begin(), buckets.end());
+    buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+    return buckets;
+}
+
+bool is_symbolic(const logical_tensor_t &lt) {
+    return std::any_of(lt.dims, lt.dims + std::max(lt.ndims, 0),
+            [](dim_t d) { return d == DNNL_GRAPH_UNKNOWN_DIM; });
+}
+
+// Check if the tensor is in dense row-major layout.
+bool is_row_major(const logical_tensor_t &lt) {
+    const ltw lt_w(lt);
+    if (!lt_w.is_strided()) return false;
+    dim_t stride = 1;
+    for (int d = lt_w.ndims() - 1; d >= 0; d--) {
+        if (lt_w.dims()[d] != 1 && lt_w.strides()[d] != stride) return false;
+        stride *= lt_w.dims()[d];
+    }
+    return true;
+}
+
+// Bind the symbol of a logical tensor given at compilation to the value. The
+// symbolic tensors and the ones without a concrete layout are bound to dense
+// row-major layouts.
+logical_tensor_t bind_symbol(const logical_tensor_t &lt, dim_t value) {
+    logical_tensor_t bound = lt;
+    const ltw lt_w(lt);
+    if (!is_symbolic(lt) && !lt_w.is_any() && !lt_w.is_stride_unknown())
+        return bound;
+
+    dim_t stride = 1;
+    for (int d = bound.ndims - 1; d >= 0; d--) {
+        if (bound.dims[d] == DNNL_GRAPH_UNKNOWN_DIM) bound.dims[d] = value;
+        bound.layout.strides[d] = stride;
+        stride *= bound.dims[d];
+    }
+    bound.layout_type = layout_type::strided;
+    return bound;
+}
+
+// Copy the common region of two dense row-major tensors of the same rank, one
+// of which is a zero padded copy of the other.
+void copy_region(const logical_tensor_t &dst_lt, void *dst,
+        const logical_tensor_t &src_lt, const void *src) {
+    const int ndims = dst_lt.ndims;
+    const size_t dt_size = ltw(dst_lt).data_type_size();
+    if (ndims == 0) {
+        std::memcpy(dst, src, dt_size);
+        return;
+    }
+
+    std::vector<dim_t> region(ndims);
+    dim_t nrows = 1;
+    for (int d = 0; d < ndims; d++) {
+        region[d] = std::min(dst_lt.dims[d], src_lt.dims[d]);
+        if (d < ndims - 1) nrows *= region[d];
+    }
+    const size_t row_size = static_cast<size_t>(region[ndims - 1]) * dt_size;
+    if (row_size == 0) return;
+
+    parallel_nd(nrows, [&](dim_t row) {
+        dim_t dst_off = 0, src_off = 0;
+        for (int d = ndims - 2; d >= 0; d--) {
+            const dim_t idx = row % region[d];
+            row /= region[d];
+            dst_off += idx * dst_lt.layout.strides[d];
+            src_off += idx * src_lt.layout.strides[d];
+        }
+        std::memcpy(static_cast<char *>(dst) + dst_off * dt_size,
+                static_cast<const char *>(src) + src_off * dt_size,
+                row_size);
+    });
+}
+
+} // namespace
+
+status_t dynamic_shape_kernel_t::compile_impl(const dnnl_partition_impl_t *part,
+        const engine_t *g_engine, const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    buckets_ = get_buckets();
+    if (buckets_.empty()) return status::unimplemented;
+
+    // the rank of inputs and outputs must be known to bind the symbol
+    for (const auto &in : inputs) {
+        if (ltw(in).ndims() < 0) return status::invalid_arguments;
+    }
+    for (const auto &out : outputs) {
+        if (ltw(out).ndims() < 0) return status::invalid_arguments;
+    }
+
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_ = reinterpret_cast<graph::allocator_t *>(
+            g_engine->get_allocator());
+    inputs_ = inputs;
+    outputs_ = outputs;
+
+    kernels_.clear();
+    for (const dim_t bucket : buckets_) {
+        std::vector<logical_tensor_t> bucket_inputs, bucket_outputs;
+        for (const auto &in : inputs) {
+            bucket_inputs.emplace_back(bind_symbol(in, bucket));
+        }
+        for (const auto &out : outputs) {
+            bucket_outputs.emplace_back(bind_symbol(out, bucket));
+        }
+
+        kernel_ptr kernel = kernel_creator_();
+        if (!kernel) return status::unimplemented;
+
+        // The compilation will transform the partition, so it's done on a
+        // copy.
+        auto bucket_part = std::dynamic_pointer_cast<dnnl_partition_impl_t>(
+                part->clone());
+        if (!bucket_part) return status::invalid_arguments;
+        BACKEND_DNNL_CHECK(kernel->compile(
+                bucket_part.get(), g_engine, bucket_inputs, bucket_outputs));
+
+        // The symbolic outputs must be produced in the bound layouts, so they
+        // can be written to the given tensors.
+        for (size_t i = 0; i < outputs.size(); i++) {
+            if (is_symbolic(outputs[i]) && !is_row_major(bucket_outputs[i]))
+                return status::unimplemented;
+        }
+        kernels_.emplace_back(std::move(kernel));
+    }
+
+    // Since the inplace pairs depend on the memory planning of the bucket
+    // kernels, no inplace pair is reported.
+    return status::success;
+}
+
+status_t dynamic_shape_kernel_t::get_kernel(const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs, size_t &bucket_idx,
+        dim_t &value) const {
+    if (inputs.size() != inputs_.size() || outputs.size() != outputs_.size())
+        return status::invalid_arguments;
+
+    // The unknown dimensions can be bound to any value which is the same for
+    // all of them, while the known ones must be kept.
+    value = DNNL_GRAPH_UNKNOWN_DIM;
+    const auto bind = [&](const logical_tensor_t &concrete,
+                              const logical_tensor_t &symbolic) {
+        const ltw c_w(concrete);
+        if (c_w.ndims() != symbolic.ndims || c_w.is_shape_unknown())
+            return false;
+        for (int d = 0; d < symbolic.ndims; d++) {
+            const dim_t dim = symbolic.dims[d];
+            if (dim != DNNL_GRAPH_UNKNOWN_DIM) {
+                if (c_w.dims()[d] != dim) return false;
+            } else if (value == DNNL_GRAPH_UNKNOWN_DIM) {
+                value = c_w.dims()[d];
+            } else if (c_w.dims()[d] != value) {
+                return false;
+            }
+        }
+        return !is_symbolic(symbolic) || is_row_major(concrete);
+    };
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!bind(inputs[i].get_logical_tensor(), inputs_[i]))
+            return status::invalid_arguments;
+    }
+    for (size_t i = 0; i < outputs.size(); i++) {
+        if (!bind(outputs[i].get_logical_tensor(), outputs_[i]))
+            return status::invalid_arguments;
+    }
+    if (value <= 0) return status::invalid_arguments;
+
+    const auto pos = std::lower_bound(buckets_.begin(), buckets_.end(), value);
+    if (pos == buckets_.end()) return status::invalid_arguments;
+    bucket_idx = static_cast<size_t>(pos - buckets_.begin());
+    return status::success;
+}
+
+status_t dynamic_shape_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    size_t idx = 0;
+    dim_t value = 0;
+    BACKEND_DNNL_CHECK(get_kernel(inputs, outputs, idx, value));
+    const dim_t bucket = buckets_[idx];
+    if (value == bucket)
+        return kernels_[idx]->execute_impl(g_stream, inputs, outputs);
+    if (p_engine_.get_kind() != dnnl::engine::kind::cpu)
+        return status::invalid_arguments;
+
+    // Execute the kernel of the bucket on the zero padded copies of symbolic
+    // inputs and outputs.
+    std::vector<std::unique_ptr<temporary_scratchpad_t>> buffers;
+    const auto pad = [&](const tensor_t &ts, const logical_tensor_t &symbolic,
+                             std::vector<tensor_t> &padded) {
+        if (!is_symbolic(symbolic)) {
+            padded.emplace_back(ts);
+            return true;
+        }
+        const logical_tensor_t padded_lt = bind_symbol(symbolic, bucket);
+        buffers.emplace_back(new temporary_scratchpad_t(
+                ltw(padded_lt).size(), p_engine_, *g_alloc_));
+        char *buf = buffers.back()->get_buffer();
+        if (!buf) return false;
+        padded.emplace_back(padded_lt, ts.get_engine(), buf);
+        return true;
+    };
+
+    std::vector<tensor_t> padded_inputs, padded_outputs;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!pad(inputs[i], inputs_[i], padded_inputs))
+            return status::out_of_memory;
+        if (!is_symbolic(inputs_[i])) continue;
+        const tensor_t &padded = padded_inputs.back();
+        std::memset(padded.get_data_handle(), 0,
+                ltw(padded.get_logical_tensor()).size());
+        copy_region(padded.get_logical_tensor(), padded.get_data_handle(),
+                inputs[i].get_logical_tensor(), inputs[i].get_data_handle());
+    }
+    for (size_t i = 0; i < outputs.size(); i++) {
+        if (!pad(outputs[i], outputs_[i], padded_outputs))
+            return status::out_of_memory;
+    }
+
+    BACKEND_DNNL_CHECK(kernels_[idx]->execute_impl(
+            g_stream, padded_inputs, padded_outputs));
+
+    // copy the valid part of the symbolic outputs back
+    for (size_t i = 0; i < outputs.size(); i++) {
+        if (!is_symbolic(outputs_[i])) continue;
+        copy_region(outputs[i].get_logical_tensor(),
+                outputs[i].get_data_handle(),
+                padded_outputs[i].get_logical_tensor(),
+                padded_outputs[i].get_data_handle());
+    }
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_DYNAMIC_SHAPE_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_DYNAMIC_SHAPE_HPP
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "graph/interface/backend.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// The dynamic_shape_kernel_t is used for the partitions compiled with symbolic
+// input shapes, ie. some input dimensions are DNNL_GRAPH_UNKNOWN_DIM. All the
+// unknown dimensions of the inputs and outputs are treated as one symbol (eg.
+// the batch size or the sequence length of transformer models), which is bound
+// to a concrete value at execution according to the logical tensors of the
+// given tensors.
+//
+// Since the backend can't compile a kernel for runtime dimensions, the kernel
+// compiles the partition ahead of time for a list of bucket values of the
+// symbol given by the user env var ONEDNN_GRAPH_DYNAMIC_SHAPE_BUCKETS, eg.
+// "1,8,32,128". Nothing is compiled at execution:
+// - If the bound value equals a bucket, the kernel of the bucket is executed
+//   on the given tensors.
+// - Otherwise on CPU, the value is rounded up to the next bucket. The symbolic
+//   inputs are copied into zero padded buffers, the kernel of the bucket is
+//   executed on them and the valid part of the padded outputs is copied back.
+//   It's only correct for partitions which are independent along the symbolic
+//   dimensions.
+// - A value above the largest bucket, or a value which has to be padded on
+//   GPU, is rejected with invalid_arguments.
+// The partition can't be compiled with symbolic shapes if the env var is not
+// set.
+//
+// Note: The symbolic inputs and outputs given at execution must be in dense
+// row-major layouts.
+class dynamic_shape_kernel_t : public kernel_base_t {
+private:
+    FCreateKernel kernel_creator_;
+    // the symbolic inputs and outputs given at compilation
+    std::vector<logical_tensor_t> inputs_;
+    std::vector<logical_tensor_t> outputs_;
+
+    allocator_t *g_alloc_ = nullptr;
+    // the bucket values of the symbol in ascending order, and the kernels
+    // compiled for them
+    std::vector<dim_t> buckets_;
+    std::vector<kernel_ptr> kernels_;
+
+    // get the kernel of the bucket for the shapes of given tensors, and the
+    // value bound to the symbol
+    status_t get_kernel(const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, size_t &bucket_idx,
+            dim_t &value) const;
+
+public:
+    dynamic_shape_kernel_t(FCreateKernel kernel_creator)
+        : kernel_creator_(std::move(kernel_creator)) {}
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        size_t idx = 0;
+        dim_t value = 0;
+        BACKEND_DNNL_CHECK(get_kernel(inputs, outputs, idx, value));
+        // the tensors on GPU are never padded
+        if (value != buckets_[idx]) return status::invalid_arguments;
+        return kernels_[idx]->sycl_execute_impl(
+                g_stream, inputs, outputs, sycl_deps, sycl_event);
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &deps, cl_event *event) override {
+        size_t idx = 0;
+        dim_t value = 0;
+        BACKEND_DNNL_CHECK(get_kernel(inputs, outputs, idx, value));
+        // the tensors on GPU are never padded
+        if (value != buckets_[idx]) return status::invalid_arguments;
+        return kernels_[idx]->ocl_execute_impl(
+                g_stream, inputs, outputs, deps, event);
+    }
+#endif
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -22,7 +22,9 @@
 #include "graph/backend/dnnl/kernels/concat.hpp"
 #include "graph/backend/dnnl/kernels/conv.hpp"
 #include "graph/backend/dnnl/kernels/convtranspose.hpp"
+#include "graph/backend/dnnl/kernels/depth_first.hpp"
 #include "graph/backend/dnnl/kernels/dummy.hpp"
+#include "graph/backend/dnnl/kernels/dynamic_shape.hpp"
 #include "graph/backend/dnnl/kernels/eltwise.hpp"
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/kernels/layernorm.hpp"
@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
+#include "common/dnnl_thread.hpp"
+
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 
 namespace dnnl {
@@ -64,12 +68,53 @@ status_t larger_partition_kernel_t::compile_impl(
         return this->memory_planner_.get_exec_args_set().clone();
     };
 
+    scratchpad_ctor_ = [this]() {
+        return std::make_shared<reusable_scratchpad_t>(
+                this->p_engine_, *this->g_alloc_);
+    };
+
     constant_key_ = generate_constant_cache_key(part->id(),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
     return status::success;
 }
 
+status_t larger_partition_kernel_t::execute_stages(
+        const dnnl::stream &p_stream, const execution_args_set_t *res) {
+    const auto &exec_args = res->get_exec_args();
+    std::vector<size_t> stage_execs;
+    for (const auto &stage : memory_planner_.get_exec_stages()) {
+        stage_execs.clear();
+        for (size_t i : stage) {
+            if (!subgraph_->is_constant_[i]) stage_execs.emplace_back(i);
+        }
+
+        const int nthr = static_cast<int>(std::min<size_t>(
+                stage_execs.size(), dnnl_get_current_num_threads()));
+        if (nthr <= 1) {
+            for (size_t i : stage_execs)
+                subgraph_->execs_[i]->execute(p_stream, exec_args[i]);
+            continue;
+        }
+
+        // exceptions can't be propagated out of the parallel region
+        std::atomic<bool> failed(false);
+        parallel(nthr, [&](int ithr, int nthr) {
+            size_t start = 0, end = 0;
+            balance211(stage_execs.size(), static_cast<size_t>(nthr),
+                    static_cast<size_t>(ithr), start, end);
+            for (size_t k = start; k < end; k++) {
+                const size_t i = stage_execs[k];
+                try {
+                    subgraph_->execs_[i]->execute(p_stream, exec_args[i]);
+                } catch (...) { failed = true; }
+            }
+        });
+        if (failed) return status::runtime_error;
+    }
+    return status::success;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
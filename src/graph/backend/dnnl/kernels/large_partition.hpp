@@ -26,6 +26,8 @@
 #include <utility>
 #include <vector>
 
+#include "common/utils.hpp"
+
 #include "graph/interface/backend.hpp"
 #include "graph/interface/graph.hpp"
 
@@ -59,6 +61,7 @@ protected:
     memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
+    std::function<std::shared_ptr<reusable_scratchpad_t>()> scratchpad_ctor_;
 
     constant_cache_t::key_t constant_key_ = 0;
 
@@ -70,12 +73,17 @@ public:
     larger_partition_kernel_t() {
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.retain();
+        thread_local_cache_t<reusable_scratchpad_t> scratchpad_cache;
+        scratchpad_cache.retain();
     }
 
     ~larger_partition_kernel_t() override {
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
         res_cache.release();
+        thread_local_cache_t<reusable_scratchpad_t> scratchpad_cache;
+        scratchpad_cache.remove_if_exist(reinterpret_cast<size_t>(this));
+        scratchpad_cache.release();
     }
 
     static void setup_pipeline_stage1(pass_pipeline_t &pipeline) {
@@ -212,6 +220,10 @@ public:
             const std::vector<logical_tensor_t> &inputs,
             const std::vector<logical_tensor_t> &outputs) override;
 
+    size_t get_internal_temporary_size() const {
+        return memory_planner_.total_internal_temporary_size();
+    }
+
     status_t prepare_inplace_pairs_impl() override {
         inplace_pairs_ = memory_planner_.get_subgraph_inplace_pairs();
         return status::success;
@@ -240,9 +252,47 @@ public:
         }
     }
 
+    // Execute the non-constant ops stage by stage. The independent ops of a
+    // stage are distributed among the threads of a parallel region. Since
+    // nested parallelism is not supported, each of them is executed by a
+    // single thread, so the memory planner only puts small ops into a stage
+    // together. A stage of a single op is executed by all the threads.
+    status_t execute_stages(
+            const dnnl::stream &p_stream, const execution_args_set_t *res);
+
+    size_t get_scratchpad_size() const override {
+        return memory_planner_.total_internal_temporary_size();
+    }
+
+    const memory_planner_t &get_memory_planner() const {
+        return memory_planner_;
+    }
+
     status_t execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
             const std::vector<tensor_t> &outputs) override {
+        // The temporary buffer is cached per thread and reused by the following
+        // executions of the kernel in the same thread.
+        thread_local_cache_t<reusable_scratchpad_t> scratchpad_cache;
+        reusable_scratchpad_t *scratchpad = scratchpad_cache.get_or_add(
+                reinterpret_cast<size_t>(this), scratchpad_ctor_);
+        scratchpad->reserve(memory_planner_.total_internal_temporary_size());
+        return execute_with_scratchpad(g_stream, inputs, outputs, *scratchpad);
+    }
+
+    status_t execute_with_scratchpad_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, void *scratchpad) override {
+        user_scratchpad_t user_scratchpad(
+                scratchpad, memory_planner_.total_internal_temporary_size());
+        return execute_with_scratchpad(
+                g_stream, inputs, outputs, user_scratchpad);
+    }
+
+    status_t execute_with_scratchpad(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const scratchpad_t &scratchpad) {
         dnnl::stream p_stream = make_dnnl_stream(p_engine_, *g_stream);
 
         // each thread's own local resource
@@ -250,9 +300,6 @@ public:
         execution_args_set_t *res = res_cache.get_or_add(
                 reinterpret_cast<size_t>(this), resource_ctor_);
 
-        temporary_scratchpad_t scratchpad(
-                memory_planner_.total_internal_temporary_size(), p_engine_,
-                *g_alloc_);
         assertm(scratchpad.size()
                         >= memory_planner_.total_internal_temporary_size(),
                 "no enough scratchpad memory");
@@ -299,6 +346,9 @@ public:
             }
         }
 
+        if (!memory_planner_.get_exec_stages().empty())
+            return execute_stages(p_stream, res);
+
         for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
             if (subgraph_->is_constant_[i]) continue;
             subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
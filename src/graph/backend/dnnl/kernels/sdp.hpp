@@ -840,6 +840,9 @@ public:
 
         thread_local_cache_t<execution_args_set_t> select_res_cache;
         select_res_cache.retain();
+
+        thread_local_cache_t<reusable_scratchpad_t> scratchpad_cache;
+        scratchpad_cache.retain();
     }
 
     ~sdp_decomp_kernel_t() override {
@@ -850,6 +853,10 @@ public:
         thread_local_cache_t<execution_args_set_t> select_res_cache;
         select_res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
         select_res_cache.release();
+
+        thread_local_cache_t<reusable_scratchpad_t> scratchpad_cache;
+        scratchpad_cache.remove_if_exist(reinterpret_cast<size_t>(this));
+        scratchpad_cache.release();
     }
 
     status_t compile_impl(const dnnl_partition_impl_t *part,
@@ -1022,9 +1029,30 @@ public:
         }
     }
 
+    // The scratchpad holds the internal memory of the select subgraph followed
+    // by the sdp blocks of all threads.
+    size_t get_scratchpad_size() const override {
+        return memory_planner_.total_internal_temporary_size()
+                + sdp_registry_.size() * sdp_cfg_.nthr;
+    }
+
     status_t execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
             const std::vector<tensor_t> &outputs) override {
+        return execute_internal(g_stream, inputs, outputs, nullptr, 0);
+    }
+
+    status_t execute_with_scratchpad_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, void *scratchpad) override {
+        return execute_internal(g_stream, inputs, outputs, scratchpad,
+                get_scratchpad_size());
+    }
+
+    status_t execute_internal(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, void *user_buffer,
+            size_t user_buffer_size) {
         dnnl::stream strm = make_dnnl_stream(p_engine_, *g_stream);
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -1058,25 +1086,40 @@ public:
         char *dst2_user_pointer
                 = static_cast<char *>(outputs[0].get_data_handle());
 
-        // allocate the select internal memory
-        temporary_scratchpad_t select_scratchpad(
-                memory_planner_.total_internal_temporary_size(), p_engine_,
-                *g_alloc_);
-        assertm(select_scratchpad.size()
-                        >= memory_planner_.total_internal_temporary_size(),
+        // Use the user scratchpad if it's large enough. The number of threads
+        // may change for threadpool runtime. Otherwise, the temporary buffer
+        // is cached per thread and reused by the following executions.
+        const size_t select_size
+                = memory_planner_.total_internal_temporary_size();
+        size_t block_size = sdp_registry_.size();
+        const size_t total_size = select_size + block_size * sdp_cfg_.nthr;
+        user_scratchpad_t user_scratchpad(user_buffer, user_buffer_size);
+        const scratchpad_t *scratchpad = &user_scratchpad;
+        if (user_scratchpad.size() < total_size) {
+            thread_local_cache_t<reusable_scratchpad_t> scratchpad_cache;
+            reusable_scratchpad_t *cached_scratchpad
+                    = scratchpad_cache.get_or_add(
+                            reinterpret_cast<size_t>(this), [this]() {
+                                return std::make_shared<reusable_scratchpad_t>(
+                                        p_engine_, *g_alloc_);
+                            });
+            cached_scratchpad->reserve(total_size);
+            scratchpad = cached_scratchpad;
+        }
+        assertm(scratchpad->size() >= total_size,
                 "no enough scratchpad memory");
+
+        // the select internal memory
+        user_scratchpad_t select_scratchpad(
+                scratchpad->get_buffer(), select_size);
         if (sdp_cfg_.has_select) {
             const std::vector<tensor_t> select_inputs
                     = {inputs[sdp_cfg_.graph_inport[5]],
                             inputs[sdp_cfg_.graph_inport[6]]};
             prepare_args_set(select_res, select_inputs, select_scratchpad);
         }
-        size_t block_size = sdp_registry_.size();
-        temporary_scratchpad_t scratchpad(
-                block_size * sdp_cfg_.nthr, p_engine_, *g_alloc_);
-        assertm(scratchpad.size() >= sdp_registry_.size(),
-                "no enough scratchpad memory");
-        grantor_t var_grantor = sdp_registry_.grantor(scratchpad.get_buffer());
+        grantor_t var_grantor = sdp_registry_.grantor(
+                scratchpad->get_buffer() + select_size);
 
         const auto get_mem_dt_size = [](const memory &m) -> size_t {
             return memory::data_type_size(m.get_desc().get_data_type());
@@ -98,6 +98,17 @@ public:
         return kernel->execute_impl(g_stream, inputs, outputs);
     }
 
+    size_t get_scratchpad_size() const override {
+        return kernel->get_scratchpad_size();
+    }
+
+    status_t execute_with_scratchpad_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, void *scratchpad) override {
+        return kernel->execute_with_scratchpad_impl(
+                g_stream, inputs, outputs, scratchpad);
+    }
+
 #ifdef DNNL_WITH_SYCL
     status_t sycl_execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
@@ -60,6 +60,8 @@ DECLARE_LAYOUT_PROPAGATOR(eltwise_bwd);
 DECLARE_LAYOUT_PROPAGATOR(binary);
 DECLARE_LAYOUT_PROPAGATOR(concat);
 DECLARE_LAYOUT_PROPAGATOR(shuffle);
+DECLARE_LAYOUT_PROPAGATOR(rope);
+DECLARE_LAYOUT_PROPAGATOR(top_k);
 DECLARE_LAYOUT_PROPAGATOR(matmul);
 DECLARE_LAYOUT_PROPAGATOR(pool);
 DECLARE_LAYOUT_PROPAGATOR(pool_bwd);
@@ -68,6 +70,7 @@ DECLARE_LAYOUT_PROPAGATOR(batchnorm_bwd);
 DECLARE_LAYOUT_PROPAGATOR(prelu);
 DECLARE_LAYOUT_PROPAGATOR(prelu_bwd);
 DECLARE_LAYOUT_PROPAGATOR(layernorm);
+DECLARE_LAYOUT_PROPAGATOR(groupnorm);
 DECLARE_LAYOUT_PROPAGATOR(layernorm_bwd);
 DECLARE_LAYOUT_PROPAGATOR(permute);
 DECLARE_LAYOUT_PROPAGATOR(to_group);
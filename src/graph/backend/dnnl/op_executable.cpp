@@ -740,11 +740,18 @@ layernorm_executable_t::desc_t layernorm_executable_t::create_desc(
     bool use_affine = true;
     if (op->has_attr(op_attr::use_affine))
         use_affine = op->get_attr<bool>(op_attr::use_affine);
+    const bool rms_norm = op->has_attr(op_attr::rms_norm)
+            && op->get_attr<bool>(op_attr::rms_norm);
 
     auto flags = dnnl::normalization_flags::none;
-    if (use_affine)
+    // RMS normalization only has the scale parameter
+    if (rms_norm) {
+        flags |= dnnl::normalization_flags::rms_norm;
+        if (use_affine) flags |= dnnl::normalization_flags::use_scale;
+    } else if (use_affine) {
         flags |= (dnnl::normalization_flags::use_scale
                 | dnnl::normalization_flags::use_shift);
+    }
 
     prop_kind pkind = keep_stats ? prop_kind::forward_training
                                  : prop_kind::forward_inference;
@@ -761,6 +768,58 @@ layernorm_executable_t::desc_t layernorm_executable_t::create_desc(
     return {pd, false};
 }
 
+groupnorm_executable_t::desc_t groupnorm_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+    // first look up the cache
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        auto pd = graph::utils::any_cast<
+                dnnl::group_normalization_forward::primitive_desc>(
+                pd_cache.at(op.get()));
+        return {pd, true};
+    }
+
+    dnnl::primitive_attr prm_attr;
+    if (op->has_attr(op_attr::fusion_info_key)
+            && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1) {
+        int64_t key = op->get_attr<int64_t>(op_attr::fusion_info_key);
+        prm_attr = make_dnnl_primitive_attr(op, mgr.get_info(key));
+    }
+
+    prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    const int64_t groups = op->get_attr<int64_t>(op_attr::groups);
+    float epsilon = 1e-5f;
+    if (op->has_attr(op_attr::epsilon))
+        epsilon = op->get_attr<float>(op_attr::epsilon);
+    bool keep_stats = true;
+    if (op->has_attr(op_attr::keep_stats))
+        keep_stats = op->get_attr<bool>(op_attr::keep_stats);
+    bool use_affine = true;
+    if (op->has_attr(op_attr::use_affine))
+        use_affine = op->get_attr<bool>(op_attr::use_affine);
+
+    auto flags = dnnl::normalization_flags::none;
+    if (use_affine)
+        flags |= (dnnl::normalization_flags::use_scale
+                | dnnl::normalization_flags::use_shift);
+
+    prop_kind pkind = keep_stats ? prop_kind::forward_training
+                                 : prop_kind::forward_inference;
+
+    // the channels of src are at the 2nd dim after the NXC format is
+    // permuted to NCX
+    auto src = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    auto dst = make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor());
+
+    dnnl::group_normalization_forward::primitive_desc pd(
+            p_engine, pkind, src, dst, groups, epsilon, flags, prm_attr);
+
+    pd_cache.insert({op.get(), pd});
+    return {pd, false};
+}
+
 layernorm_bwd_executable_t::desc_t layernorm_bwd_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
@@ -1447,6 +1506,89 @@ shuffle_executable_t::desc_t shuffle_executable_t::create_desc(
     return {pd, false};
 }
 
+rope_executable_t::desc_t rope_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        auto pd = graph::utils::any_cast<dnnl::rope::primitive_desc>(
+                pd_cache.at(op.get()));
+        return {pd, true};
+    }
+
+    const auto mode = op->has_attr(op_attr::mode)
+            ? op->get_attr<std::string>(op_attr::mode)
+            : std::string("half_split");
+    const algorithm algo = mode == "interleaved" ? algorithm::rope_interleaved
+                                                 : algorithm::rope_half_split;
+
+    dnnl::primitive_attr prm_attr;
+    if (op->has_attr(op_attr::fusion_info_key)
+            && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1) {
+        int64_t key = op->get_attr<int64_t>(op_attr::fusion_info_key);
+        prm_attr = make_dnnl_primitive_attr(op, mgr.get_info(key));
+    }
+    prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+
+    auto src = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    auto cos = make_dnnl_memory_desc(
+            op->get_input_value(1)->get_logical_tensor());
+    auto sin = make_dnnl_memory_desc(
+            op->get_input_value(2)->get_logical_tensor());
+    auto dst = make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor());
+    dst = to_format_any(dst);
+
+    dnnl::rope::primitive_desc pd(p_engine, algo, src, cos, sin, dst, prm_attr);
+
+    pd_cache.insert({op.get(), pd});
+
+    return {pd, false};
+}
+
+top_k_executable_t::desc_t top_k_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        auto pd = graph::utils::any_cast<dnnl::top_k::primitive_desc>(
+                pd_cache.at(op.get()));
+        return {pd, true};
+    }
+
+    const auto mode = op->has_attr(op_attr::mode)
+            ? op->get_attr<std::string>(op_attr::mode)
+            : std::string("max");
+    const algorithm algo = mode == "min" ? algorithm::reduction_min
+                                         : algorithm::reduction_max;
+
+    dnnl::primitive_attr prm_attr;
+    if (op->has_attr(op_attr::fusion_info_key)
+            && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1) {
+        int64_t key = op->get_attr<int64_t>(op_attr::fusion_info_key);
+        prm_attr = make_dnnl_primitive_attr(op, mgr.get_info(key));
+    }
+    prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+
+    auto src = make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor());
+    auto dst = make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor());
+    dst = to_format_any(dst);
+    auto indices = make_dnnl_memory_desc(
+            op->get_output_value(1)->get_logical_tensor());
+    indices = to_format_any(indices);
+
+    int64_t axis = op->get_attr<int64_t>(op_attr::axis);
+    if (axis < 0) axis += src.get_ndims();
+
+    dnnl::top_k::primitive_desc pd(p_engine, algo, src, dst, indices,
+            static_cast<int>(axis), prm_attr);
+
+    pd_cache.insert({op.get(), pd});
+
+    return {pd, false};
+}
+
 reduction_executable_t::desc_t reduction_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
@@ -1876,6 +2018,41 @@ arg_indices_t shuffle_executable_t::get_arg_indices(
     return get_arg_indices_for_siso_op(op, mgr);
 }
 
+arg_indices_t rope_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+    arg_indices_t arg_indices;
+
+    // add input args
+    arg_indices.insert({DNNL_ARG_SRC_0, indices_t {input, 0}});
+    arg_indices.insert({DNNL_ARG_SRC_1, indices_t {input, 1}});
+    arg_indices.insert({DNNL_ARG_SRC_2, indices_t {input, 2}});
+
+    // add output args
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 1}});
+
+    return arg_indices;
+}
+
+arg_indices_t top_k_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    UNUSED(op);
+    UNUSED(mgr);
+    arg_indices_t arg_indices;
+
+    // add input args
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, 0}});
+
+    // add output args
+    arg_indices.insert({DNNL_ARG_DST_0, indices_t {output, 0}});
+    arg_indices.insert({DNNL_ARG_DST_1, indices_t {output, 1}});
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 2}});
+
+    return arg_indices;
+}
+
 arg_indices_t reduction_executable_t::get_arg_indices(
         const op_t *op, fusion_info_mgr_t &mgr) {
     return get_arg_indices_for_siso_op(op, mgr);
@@ -2082,6 +2259,51 @@ arg_indices_t layernorm_executable_t::get_arg_indices(
     UNUSED(mgr);
     arg_indices_t arg_indices;
 
+    size_t in_index = 0;
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, in_index++}});
+    if (!op->has_attr(op_attr::use_affine)
+            || op->get_attr<bool>(op_attr::use_affine)) {
+        arg_indices.insert({DNNL_ARG_SCALE, indices_t {input, in_index++}});
+        if (!op->has_attr(op_attr::rms_norm)
+                || !op->get_attr<bool>(op_attr::rms_norm))
+            arg_indices.insert(
+                    {DNNL_ARG_SHIFT, indices_t {input, in_index++}});
+    }
+
+    const fusion_info_t &fusion_info
+            = (op->has_attr(op_attr::fusion_info_key)
+                      && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            ? mgr.get_info(op->get_attr<int64_t>(op_attr::fusion_info_key))
+            : fusion_info_t();
+
+    get_arg_indices_for_post_ops(op, mgr, arg_indices, in_index);
+
+    if (fusion_info.with_runtime_scales(false, 0)) {
+        arg_indices.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST,
+                indices_t {input, in_index++}});
+    }
+
+    size_t out_index = 0;
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, out_index++}});
+    if (!op->has_attr(op_attr::keep_stats)
+            || op->get_attr<bool>(op_attr::keep_stats)) {
+        arg_indices.insert({DNNL_ARG_MEAN, indices_t {output, out_index++}});
+        arg_indices.insert(
+                {DNNL_ARG_VARIANCE, indices_t {output, out_index++}});
+    }
+
+    if (op->num_outputs() > out_index) {
+        arg_indices.insert(
+                {DNNL_ARG_SCRATCHPAD, indices_t {output, out_index++}});
+    }
+
+    return arg_indices;
+}
+
+arg_indices_t groupnorm_executable_t::get_arg_indices(
+        const op_t *op, fusion_info_mgr_t &mgr) {
+    arg_indices_t arg_indices;
+
     size_t in_index = 0;
     arg_indices.insert({DNNL_ARG_SRC, indices_t {input, in_index++}});
     if (!op->has_attr(op_attr::use_affine)
@@ -1034,10 +1034,27 @@ struct concat_executable_t : public op_executable_t {
             fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
         auto desc = create_desc(op, p_engine, mgr, pd_cache);
         prim_ = dnnl::concat(desc);
+
+        // The memory planner places the sources right in the destination
+        // when each of them is a contiguous part of it, and then there is
+        // nothing to copy. Concat with scales always needs to be executed.
+        const bool with_attr = op->has_attr(op_attr::fusion_info_key)
+                && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1;
+        if (!with_attr) {
+            const auto rank = desc.dst_desc().get_ndims();
+            const auto res = utils::try_reverse_axis(
+                    op->get_attr<int64_t>(op_attr::axis), rank);
+            std::vector<memory::desc> src_mds;
+            for (size_t i = 0; i < op->num_inputs(); i++)
+                src_mds.emplace_back(desc.src_desc(static_cast<int>(i)));
+            get_concat_src_offsets(desc.dst_desc(), src_mds,
+                    static_cast<int>(res.second), src_offsets_);
+        }
     }
 
     void execute(const stream &stream,
             const std::unordered_map<int, memory> &args) const override {
+        if (srcs_in_dst(args)) return;
         prim_.execute(stream, args);
     }
 
@@ -1061,7 +1078,22 @@ struct concat_executable_t : public op_executable_t {
 #endif
 
 private:
+    bool srcs_in_dst(const std::unordered_map<int, memory> &args) const {
+        if (src_offsets_.empty()) return false;
+        const auto *dst = static_cast<const char *>(
+                args.at(DNNL_ARG_DST).get_data_handle());
+        for (size_t i = 0; i < src_offsets_.size(); i++) {
+            const int arg = DNNL_ARG_MULTIPLE_SRC + static_cast<int>(i);
+            if (args.at(arg).get_data_handle() != dst + src_offsets_[i])
+                return false;
+        }
+        return true;
+    }
+
     dnnl::concat prim_;
+    // the byte offsets of the sources in the destination, empty if the
+    // sources can't be placed in the destination
+    std::vector<size_t> src_offsets_;
 };
 
 struct shuffle_executable_t : public op_executable_t {
@@ -1103,6 +1135,82 @@ private:
     dnnl::shuffle_forward prim_;
 };
 
+struct rope_executable_t : public op_executable_t {
+    DECLARE_DESC_CLASS_AND_CREATOR(dnnl::rope::primitive_desc);
+    DECLARE_ARG_INDICES_GETTER;
+
+    rope_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+        auto desc = create_desc(op, p_engine, mgr, pd_cache);
+        prim_ = dnnl::rope(desc);
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        prim_.execute(stream, args);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps = {}) const override {
+        auto e = dnnl::sycl_interop::execute(prim_, stream, args, deps);
+        if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
+        return e;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps = {}) const override {
+        auto e = dnnl::ocl_interop::execute(prim_, stream, args, deps);
+        return e;
+    }
+#endif
+
+private:
+    dnnl::rope prim_;
+};
+
+struct top_k_executable_t : public op_executable_t {
+    DECLARE_DESC_CLASS_AND_CREATOR(dnnl::top_k::primitive_desc);
+    DECLARE_ARG_INDICES_GETTER;
+
+    top_k_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            fusion_info_mgr_t &mgr, pd_cache_t &pd_cache) {
+        auto desc = create_desc(op, p_engine, mgr, pd_cache);
+        prim_ = dnnl::top_k(desc);
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        prim_.execute(stream, args);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps = {}) const override {
+        auto e = dnnl::sycl_interop::execute(prim_, stream, args, deps);
+        if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
+        return e;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps = {}) const override {
+        auto e = dnnl::ocl_interop::execute(prim_, stream, args, deps);
+        return e;
+    }
+#endif
+
+private:
+    dnnl::top_k prim_;
+};
+
 struct pool_executable_t : public op_executable_t {
     DECLARE_DESC_CLASS_AND_CREATOR(dnnl::pooling_forward::primitive_desc);
     DECLARE_ARG_INDICES_GETTER;
@@ -2153,6 +2261,46 @@ private:
     dnnl::layer_normalization_forward prim_;
 };
 
+struct groupnorm_executable_t : public op_executable_t {
+    DECLARE_DESC_CLASS_AND_CREATOR(
+            dnnl::group_normalization_forward::primitive_desc);
+    DECLARE_ARG_INDICES_GETTER;
+
+    groupnorm_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, fusion_info_mgr_t &mgr,
+            pd_cache_t &pd_cache) {
+        auto desc = create_desc(op, p_engine, mgr, pd_cache);
+        prim_ = dnnl::group_normalization_forward(desc);
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        prim_.execute(stream, args);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps = {}) const override {
+        auto e = dnnl::sycl_interop::execute(prim_, stream, args, deps);
+        if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
+        return e;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps = {}) const override {
+        auto e = dnnl::ocl_interop::execute(prim_, stream, args, deps);
+        return e;
+    }
+#endif
+
+private:
+    dnnl::group_normalization_forward prim_;
+};
+
 struct layernorm_bwd_executable_t : public op_executable_t {
     DECLARE_DESC_CLASS_AND_CREATOR(
             dnnl::layer_normalization_backward::primitive_desc);
@@ -171,6 +171,20 @@ static status_t batchnorm_fwd_handler(
     return status::success;
 }
 
+static status_t rms_norm_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    // RMSNorm is mapped to layer normalization with the mean considered to be
+    // zero, which doesn't output the statistics.
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_layernorm);
+    new_op->set_attr<bool>(op_attr::rms_norm, true);
+    new_op->set_attr<bool>(op_attr::keep_stats, false);
+    new_op->merge_attributes(op->get_attributes());
+
+    rewriter.replace_op(op, new_op);
+    insert_empty_scratchpad(new_op);
+    return status::success;
+}
+
 static status_t reduction_handler(
         const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
     auto new_op = std::make_shared<op_t>(op_kind::dnnl_reduction);
@@ -786,6 +800,9 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         // layernorm
         ITEM(LayerNorm, common_handler<op_kind::kDnnl_layernorm>),
         ITEM(LayerNormBackward, common_handler<op_kind::kDnnl_layernorm_bwd>),
+        // groupnorm
+        ITEM(GroupNorm, common_handler<op_kind::kDnnl_groupnorm>),
+        ITEM(RMSNorm, rms_norm_handler),
         // quantization
         ITEM(Quantize, static_quant_handler),
         ITEM(Dequantize, static_dequant_handler),
@@ -802,6 +819,8 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         ITEM(Concat, common_handler<op_kind::kDnnl_concat>),
         ITEM(SquaredDifference, squared_difference_handler),
         ITEM(Select, select_handler),
+        ITEM(RoPE, common_handler<op_kind::kDnnl_rope>),
+        ITEM(TopK, common_handler<op_kind::kDnnl_top_k>),
         // utility
         ITEM(Wildcard, dummy_handler),
         ITEM(End, dummy_handler),
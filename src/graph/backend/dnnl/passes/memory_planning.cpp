@@ -15,12 +15,17 @@
  *******************************************************************************/
 
 #include <algorithm>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "common/verbose.hpp"
+
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/value.hpp"
 
@@ -318,6 +323,162 @@ std::vector<const value_t *> alias_analyzer_t::get_all_aliases(
     return ret;
 }
 
+size_t buffer_packer_t::lower_bound(const std::vector<buffer_t> &buffers) {
+    // sweep over the time steps, the ends are processed after the starts of
+    // the same step since the end step is inclusive
+    std::vector<std::pair<size_t, ptrdiff_t>> events;
+    for (const auto &b : buffers) {
+        events.emplace_back(2 * b.start_, static_cast<ptrdiff_t>(b.size_));
+        events.emplace_back(2 * b.end_ + 1, -static_cast<ptrdiff_t>(b.size_));
+    }
+    std::sort(events.begin(), events.end());
+
+    size_t live = 0, peak = 0;
+    for (const auto &e : events) {
+        live += e.second;
+        peak = std::max(peak, live);
+    }
+    return peak;
+}
+
+// Returns the offset of the smallest gap the buffer fits into between the
+// placed buffers it's live together with, or the top of them.
+static size_t best_fit_offset(
+        const std::vector<buffer_packer_t::buffer_t> &buffers,
+        const std::vector<size_t> &placed, const std::vector<size_t> &offsets,
+        size_t idx) {
+    const auto &b = buffers[idx];
+    std::vector<std::pair<size_t, size_t>> taken;
+    for (size_t p : placed) {
+        const auto &other = buffers[p];
+        if (other.end_ < b.start_ || b.end_ < other.start_) continue;
+        taken.emplace_back(offsets[p], offsets[p] + other.size_);
+    }
+    std::sort(taken.begin(), taken.end());
+
+    size_t top = 0, best = 0, best_gap = std::numeric_limits<size_t>::max();
+    for (const auto &t : taken) {
+        if (t.first > top) {
+            const size_t gap = t.first - top;
+            if (gap >= b.size_ && gap < best_gap) {
+                best = top;
+                best_gap = gap;
+            }
+        }
+        top = std::max(top, t.second);
+    }
+    return best_gap == std::numeric_limits<size_t>::max() ? top : best;
+}
+
+size_t buffer_packer_t::pack_greedy_by_size(
+        const std::vector<buffer_t> &buffers, std::vector<size_t> &offsets) {
+    std::vector<size_t> order(buffers.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return buffers[a].size_ > buffers[b].size_;
+    });
+
+    offsets.assign(buffers.size(), 0);
+    std::vector<size_t> placed;
+    size_t total = 0;
+    for (size_t idx : order) {
+        offsets[idx] = best_fit_offset(buffers, placed, offsets, idx);
+        placed.emplace_back(idx);
+        total = std::max(total, offsets[idx] + buffers[idx].size_);
+    }
+    return total;
+}
+
+size_t buffer_packer_t::pack_exhaustive(
+        const std::vector<buffer_t> &buffers, std::vector<size_t> &offsets) {
+    size_t best_total = pack_greedy_by_size(buffers, offsets);
+    const size_t bound = lower_bound(buffers);
+
+    std::vector<size_t> cur_offsets(buffers.size(), 0);
+    std::vector<size_t> placed;
+    std::vector<bool> is_placed(buffers.size(), false);
+    std::function<void(size_t)> search = [&](size_t total) {
+        // no better packing down this branch, or no better packing at all
+        if (total >= best_total || best_total == bound) return;
+        if (placed.size() == buffers.size()) {
+            best_total = total;
+            offsets = cur_offsets;
+            return;
+        }
+        for (size_t idx = 0; idx < buffers.size(); idx++) {
+            if (is_placed[idx]) continue;
+            cur_offsets[idx]
+                    = best_fit_offset(buffers, placed, cur_offsets, idx);
+            placed.emplace_back(idx);
+            is_placed[idx] = true;
+            search(std::max(total, cur_offsets[idx] + buffers[idx].size_));
+            is_placed[idx] = false;
+            placed.pop_back();
+        }
+    };
+    search(0);
+    return best_total;
+}
+
+// Get the execution stage of each op in the subgraph. The result is indexed by
+// the topological order of ops. The stage of an op is one larger than the max
+// stage of the ops producing its inputs, so the ops in the same stage don't
+// depend on each other.
+//
+// The ops of a stage are executed concurrently by a single thread each, which
+// only pays off for small ops. So an op whose inputs and outputs exceed
+// `max_concurrent_op_size` bytes is moved to a stage of its own, where it is
+// executed by all the threads.
+static std::vector<size_t> get_op_stages(std::shared_ptr<subgraph_t> &sg) {
+    const size_t max_concurrent_op_size = 256 * 1024;
+    auto is_large = [&](const op_t *op) {
+        size_t size = 0;
+        for (const auto &in : op->get_input_values())
+            size += make_dnnl_memory_desc(in->get_logical_tensor()).get_size();
+        for (const auto &out : op->get_output_values())
+            size += make_dnnl_memory_desc(out->get_logical_tensor()).get_size();
+        return size > max_concurrent_op_size;
+    };
+
+    std::unordered_map<const op_t *, size_t> op_stage_map;
+    std::vector<size_t> op_stages;
+    std::vector<bool> op_is_large;
+    size_t nstages = 0;
+    topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        size_t stage = 0;
+        for (auto &in : op->get_input_values()) {
+            if (!in->has_producer()) continue;
+            auto pos = op_stage_map.find(&in->get_producer());
+            if (pos == op_stage_map.end()) continue;
+            stage = std::max(stage, pos->second + 1);
+        }
+        op_stage_map[op] = stage;
+        op_stages.emplace_back(stage);
+        op_is_large.push_back(is_large(op));
+        nstages = std::max(nstages, stage + 1);
+        return status::success;
+    });
+
+    // Renumber the stages: the small ops of a stage stay together and are
+    // followed by one stage per large op.
+    std::vector<size_t> small_stage(nstages, 0), first_large_stage(nstages, 0);
+    std::vector<size_t> nsmall(nstages, 0), nlarge(nstages, 0);
+    for (size_t i = 0; i < op_stages.size(); i++)
+        (op_is_large[i] ? nlarge : nsmall)[op_stages[i]]++;
+    size_t next = 0;
+    for (size_t s = 0; s < nstages; s++) {
+        small_stage[s] = next;
+        if (nsmall[s] > 0) next++;
+        first_large_stage[s] = next;
+        next += nlarge[s];
+    }
+    for (size_t i = 0; i < op_stages.size(); i++) {
+        const size_t s = op_stages[i];
+        op_stages[i] = op_is_large[i] ? first_large_stage[s]++ : small_stage[s];
+    }
+    return op_stages;
+}
+
 // Assign partition's input edges to user given external inputs buffer. Those
 // external inputs buffers may be used by other partition (which is under the
 // control of user), so we can't reuse them.
@@ -480,12 +641,39 @@ status_t memory_planner_t::assign_internal_persistent_buffer(
 // TODO(qun) Consider more situations (for example, a tensor can also be reused
 // even if its consumer is not computed, as long as it consumer only need the
 // tensor's metadata instead of content)
+//
+// If op_stages is not empty, the ops in the same stage may be executed
+// concurrently. In that case, the ops are visited stage by stage and the
+// buffers freed by a stage are only released after the whole stage is visited,
+// so that they won't be reused by the other ops of the same stage.
 status_t memory_planner_t::assign_internal_temporary_buffer(
         std::shared_ptr<subgraph_t> &sg,
         const std::unordered_map<value_t *, size_t> &edge_ref_count,
-        fusion_info_mgr_t &mgr, bool enable_standard_sharing) {
+        fusion_info_mgr_t &mgr, bool enable_standard_sharing,
+        const std::vector<size_t> &op_stages) {
     std::unordered_map<size_t, size_t> temporary_buffer_ref_count;
 
+    // The live range of the value a buffer currently holds is extended by
+    // every use of the buffer.
+    temporary_lives_.clear();
+    temporary_views_.clear();
+    std::unordered_map<size_t, size_t> buffer_life;
+    size_t time_step = 0;
+    auto use = [&](size_t idx) {
+        auto &life = temporary_lives_[buffer_life.at(idx)].second;
+        life.end_ = std::max(life.end_, time_step);
+    };
+
+    std::vector<size_t> pending_release;
+    auto release = [&](size_t idx) {
+        // the buffer of a concat input is a part of the concat output
+        if (temporary_views_.count(idx)) return;
+        if (op_stages.empty())
+            temporary_buffer_assigner_.release(idx);
+        else
+            pending_release.emplace_back(idx);
+    };
+
     auto func = [&](op_t *op) {
         // Handle alias first
         auto inputs = op->get_input_values();
@@ -500,6 +688,35 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             }
         }
 
+        // Place the concat inputs in the concat output, which is allocated
+        // when the first of them is produced
+        for (auto &out : op->get_output_values()) {
+            auto pos = concat_views_.find(out.get());
+            if (pos == concat_views_.end()) continue;
+
+            const value_t *concat_out = pos->second.first;
+            if (!buffer_assignments_.count(concat_out)) {
+                auto lt = concat_out->get_logical_tensor();
+                const size_t size = make_dnnl_memory_desc(lt).get_size();
+                size_t idx = temporary_buffer_assigner_.request(size);
+                buffer_assignments_.insert(std::make_pair(
+                        concat_out, assign_info_t(internal_temporary, idx)));
+                temporary_buffer_ref_count[idx] = edge_ref_count.at(
+                        const_cast<value_t *>(concat_out));
+                buffer_life[idx] = temporary_lives_.size();
+                temporary_lives_.push_back({idx, {size, time_step, time_step}});
+            }
+
+            auto lt = out->get_logical_tensor();
+            const size_t size = make_dnnl_memory_desc(lt).get_size();
+            size_t idx = temporary_buffer_assigner_.alloc(size);
+            temporary_views_[idx] = {buffer_assignments_.at(concat_out).index_,
+                    pos->second.second};
+            buffer_assignments_.insert(std::make_pair(
+                    out.get(), assign_info_t(internal_temporary, idx)));
+            temporary_buffer_ref_count[idx] = edge_ref_count.at(out.get());
+        }
+
         // Handle inplace
         auto op_inplace_pairs = get_op_inplace_pairs(*op, mgr);
         if (!op_inplace_pairs.empty()) {
@@ -528,11 +745,14 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
 
             // this output need a new buffer, record it
             auto lt = out->get_logical_tensor();
-            size_t idx = temporary_buffer_assigner_.request(
-                    make_dnnl_memory_desc(lt).get_size());
+            const size_t size = make_dnnl_memory_desc(lt).get_size();
+            size_t idx = temporary_buffer_assigner_.request(size);
             buffer_assignments_.insert(std::make_pair(
                     out.get(), assign_info_t(internal_temporary, idx)));
             temporary_buffer_ref_count[idx] = edge_ref_count.at(out.get());
+            if (size == 0) continue;
+            buffer_life[idx] = temporary_lives_.size();
+            temporary_lives_.push_back({idx, {size, time_step, time_step}});
         }
 
         // Free inputs
@@ -540,11 +760,12 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             assign_info_t info = buffer_assignments_.at(in.get());
             if (info.kind_ != internal_temporary) continue;
 
+            if (buffer_life.count(info.index_)) use(info.index_);
             --temporary_buffer_ref_count[info.index_];
             // if we decrease it to zero, we are ready to release
             if (enable_standard_sharing
                     && temporary_buffer_ref_count[info.index_] == 0) {
-                temporary_buffer_assigner_.release(info.index_);
+                release(info.index_);
             }
         }
 
@@ -553,19 +774,108 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             assign_info_t info = buffer_assignments_.at(out.get());
             if (info.kind_ != internal_temporary) continue;
 
+            if (buffer_life.count(info.index_)) use(info.index_);
             auto consumers = out->get_consumers();
             if (consumers.empty()) {
                 --temporary_buffer_ref_count[info.index_];
-                if (enable_standard_sharing) {
-                    temporary_buffer_assigner_.release(info.index_);
-                }
+                if (enable_standard_sharing) { release(info.index_); }
             }
         }
 
         return status::success;
     };
 
-    return topo_order_visit(sg->get_output_ops(), func);
+    std::vector<op_t *> topo_ordered_ops;
+    status_t ret = topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        topo_ordered_ops.emplace_back(op);
+        return status::success;
+    });
+    if (ret != status::success) return ret;
+
+    std::vector<size_t> visit_order(topo_ordered_ops.size());
+    std::iota(visit_order.begin(), visit_order.end(), 0);
+    if (!op_stages.empty()) {
+        std::stable_sort(visit_order.begin(), visit_order.end(),
+                [&](size_t a, size_t b) {
+                    return op_stages[a] < op_stages[b];
+                });
+    }
+
+    for (size_t i = 0; i < visit_order.size(); i++) {
+        const size_t idx = visit_order[i];
+        if (!op_stages.empty() && i > 0
+                && op_stages[idx] != op_stages[visit_order[i - 1]]) {
+            for (size_t buf : pending_release)
+                temporary_buffer_assigner_.release(buf);
+            pending_release.clear();
+        }
+        time_step = op_stages.empty() ? i : op_stages[idx];
+        ret = func(topo_ordered_ops[idx]);
+        if (ret != status::success) return ret;
+    }
+    return status::success;
+}
+
+// A concat copies nothing if each of its inputs is produced right in its
+// output. This is possible if every input is a contiguous part of the output
+// and is an internal temporary value used by the concat only.
+void memory_planner_t::find_concat_views(std::shared_ptr<subgraph_t> &sg,
+        const std::unordered_map<value_t *, size_t> &edge_ref_count) {
+    concat_views_.clear();
+    auto is_temporary = [&](const value_t *val) {
+        return !buffer_assignments_.count(val)
+                && !alias_analyzer_.get_alias_input(val)
+                && alias_analyzer_.get_alias_outputs(val).empty();
+    };
+
+    for (const auto &op : sg->get_ops()) {
+        if (op->get_kind() != op_kind::dnnl_concat) continue;
+        // concat with scales is not a copy
+        if (op->has_attr(op_attr::fusion_info_key)
+                && op->get_attr<int64_t>(op_attr::fusion_info_key) != -1)
+            continue;
+
+        const value_t *out = op->get_output_value(0).get();
+        if (!is_temporary(out)) continue;
+
+        bool ok = true;
+        std::vector<memory::desc> src_mds;
+        for (const auto &in : op->get_input_values()) {
+            ok = is_temporary(in.get()) && in->has_producer()
+                    && edge_ref_count.at(in.get()) == 1;
+            if (!ok) break;
+            src_mds.emplace_back(
+                    make_dnnl_memory_desc(in->get_logical_tensor()));
+        }
+        if (!ok) continue;
+
+        const auto dst_md = make_dnnl_memory_desc(out->get_logical_tensor());
+        const auto res = utils::try_reverse_axis(
+                op->get_attr<int64_t>(op_attr::axis), dst_md.get_ndims());
+        std::vector<size_t> offsets;
+        if (!res.first
+                || !get_concat_src_offsets(dst_md, src_mds,
+                        static_cast<int>(res.second), offsets))
+            continue;
+
+        for (size_t i = 0; i < op->num_inputs(); i++) {
+            concat_views_[op->get_input_value(i).get()] = {out, offsets[i]};
+        }
+    }
+
+    // The inputs of a concat whose output is placed in another concat output
+    // are copied, so no value is placed in a value which is placed itself.
+    std::unordered_set<const value_t *> placed_outs;
+    for (const auto &view : concat_views_) {
+        if (concat_views_.count(view.second.first))
+            placed_outs.insert(view.second.first);
+    }
+    for (auto it = concat_views_.begin(); it != concat_views_.end();) {
+        if (placed_outs.count(it->second.first))
+            it = concat_views_.erase(it);
+        else
+            it++;
+    }
 }
 
 status_t memory_planner_t::prepare_subgraph_inplace_pairs(
@@ -659,6 +969,29 @@ status_t memory_planner_t::prepare_subgraph_inplace_pairs(
     return ret;
 }
 
+// Every internal temporary value has its own buffer here, so the buffers are
+// placed by the live ranges of their values.
+void memory_planner_t::pack_internal_temporary_buffers(bool exhaustive) {
+    // the offsets are kept aligned by aligning the sizes, the alignment is
+    // the one the buffers are booked with
+    const size_t alignment = 64;
+    // the buffers without a live range, such as the concat views, are empty
+    // and get the offset 0
+    const size_t nbuffers = temporary_buffer_assigner_.num_buffers();
+    std::vector<buffer_packer_t::buffer_t> buffers(nbuffers, {0, 0, 0});
+    for (const auto &life : temporary_lives_) {
+        auto &b = buffers[life.first];
+        b = life.second;
+        b.size_ = (b.size_ + alignment - 1) / alignment * alignment;
+    }
+
+    const size_t max_exhaustive_buffers = 8;
+    if (exhaustive && nbuffers <= max_exhaustive_buffers)
+        buffer_packer_t::pack_exhaustive(buffers, temporary_offsets_);
+    else
+        buffer_packer_t::pack_greedy_by_size(buffers, temporary_offsets_);
+}
+
 status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
     // collect all values. Note: here we use vector to ensure that the collected
     // values are in certain order. then we can book buffer from registrar in
@@ -701,10 +1034,19 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
             case external_input:
             case external_output: break;
             // book buffers for internal temporary and persistent
-            case internal_temporary:
-                temporary_registrar.book(info.index_,
-                        temporary_buffer_assigner_.query_size(info.index_));
+            case internal_temporary: {
+                // the concat inputs are booked in the concat outputs below
+                if (temporary_views_.count(info.index_)) break;
+                const size_t size
+                        = temporary_buffer_assigner_.query_size(info.index_);
+                // the empty values have no buffer, so they have no offset
+                if (temporary_offsets_.empty() || size == 0)
+                    temporary_registrar.book(info.index_, size);
+                else
+                    temporary_registrar.book_at(info.index_,
+                            temporary_offsets_[info.index_], size);
                 break;
+            }
             case internal_persistent:
                 persistent_registrar.book(info.index_,
                         persistent_buffer_assigner_.query_size(info.index_));
@@ -712,6 +1054,17 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
             default: return status::unimplemented;
         }
     }
+
+    for (const value_t *val : to_be_booked) {
+        const assign_info_t &info = buffer_assignments_.at(val);
+        if (info.kind_ != internal_temporary
+                || !temporary_views_.count(info.index_))
+            continue;
+        const auto &view = temporary_views_.at(info.index_);
+        temporary_registrar.book_at(info.index_,
+                temporary_registry_.get(view.first) + view.second,
+                temporary_buffer_assigner_.query_size(info.index_), 1);
+    }
     return status::success;
 }
 
@@ -858,12 +1211,30 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
         }
     }
 
+    // By default, ops are executed one by one. We can use this internal env var
+    // to let the independent ops be executed concurrently, which requires the
+    // temporary buffers to be planned stage by stage.
+    bool enable_inter_op_parallel
+            = graph::utils::getenv_int_internal("ENABLE_INTER_OP_PARALLEL", 0)
+            > 0;
+    std::vector<size_t> op_stages;
+    if (enable_inter_op_parallel
+            && p_engine.get_kind() == dnnl::engine::kind::cpu) {
+        op_stages = get_op_stages(sg);
+        for (size_t i = 0; i < op_stages.size(); i++) {
+            if (op_stages[i] >= exec_stages_.size())
+                exec_stages_.resize(op_stages[i] + 1);
+            exec_stages_[op_stages[i]].emplace_back(i);
+        }
+    }
+
     // Assign external_input buffers to subgraph's inputs and their alias
     ret = assign_external_inputs_buffer(sg, inputs);
     if (ret != status::success) return ret;
 
     // Assign internal temporary buffer for all other edges
-    ret = assign_internal_temporary_buffer(sg, edge_ref_count, mgr, false);
+    ret = assign_internal_temporary_buffer(
+            sg, edge_ref_count, mgr, false, op_stages);
     if (ret != status::success) return ret;
 
     // Replace some internal temporary buffers to user given external output
@@ -886,11 +1257,32 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
         }
     }
 
+    // By default, the temporary buffers are shared by the greedy first-fit of
+    // the buffer assigner. We can use this internal env var to compute the
+    // offsets of the buffers by packing their live ranges instead. The env
+    // var is for experimental purpose only and may be removed without any
+    // prior notice.
+    const int mem_planner
+            = graph::utils::getenv_int_internal("GRAPH_MEM_PLANNER", 0);
+    const bool pack_buffers = enable_memory_sharing && mem_planner > 0;
+
+    // Let the concat inputs be produced in the concat outputs, so the concats
+    // don't copy them.
+    if (enable_memory_sharing) find_concat_views(sg, edge_ref_count);
+
     // Re-assign internal temporary buffer for reset ones (will re-do memory
-    // sharing between temporary buffers)
-    ret = assign_internal_temporary_buffer(sg, edge_ref_count, mgr, true);
+    // sharing between temporary buffers). The packing shares the memory by
+    // the offsets, so every value gets its own buffer for it.
+    ret = assign_internal_temporary_buffer(
+            sg, edge_ref_count, mgr, !pack_buffers, op_stages);
     if (ret != status::success) return ret;
 
+    std::vector<buffer_packer_t::buffer_t> lives;
+    for (const auto &life : temporary_lives_)
+        lives.emplace_back(life.second);
+    temporary_size_lower_bound_ = buffer_packer_t::lower_bound(lives);
+    if (pack_buffers) pack_internal_temporary_buffers(mem_planner > 1);
+
     // Check which input/output pair of the subgraph can be inplaced
     ret = prepare_subgraph_inplace_pairs(sg, false);
     if (ret != status::success) return ret;
@@ -898,6 +1290,10 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
     ret = book_buffers(sg);
     if (ret != status::success) return ret;
 
+    VDEBUGINFO(1, graph, memory_planning,
+            "internal temporary memory: %zu bytes, lower bound: %zu bytes",
+            total_internal_temporary_size(), temporary_size_lower_bound_);
+
     // Bind memory object to each value
     ret = prepare_execution_args_set(sg, p_engine, mgr);
     if (ret != status::success) return ret;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright 2021-2023 Intel Corporation
+ * Copyright 2021-2024 Intel Corporation
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -244,12 +244,15 @@ public:
         return data_[id]->max_bytes_;
     }
 
+    // return the number of buffers
+    size_t num_buffers() const { return data_.size(); }
+
     void clear() {
         free_.clear();
         data_.clear();
     }
 
-private:
+    // allocate a new buffer without looking up the free list
     size_t alloc(size_t size) {
         size_t id = static_cast<size_t>(data_.size());
         std::unique_ptr<buffer_info_t> ptr(new buffer_info_t(id, size));
@@ -257,6 +260,7 @@ private:
         return id;
     }
 
+private:
     struct buffer_info_t {
         buffer_info_t(size_t id, size_t size) : id_(id), max_bytes_(size) {};
         // the id of the buffer.
@@ -273,6 +277,38 @@ private:
     std::vector<std::unique_ptr<buffer_info_t>> data_;
 };
 
+// The buffer_packer_t class computes the offsets of buffers with known live
+// ranges in a single memory region, so that the buffers which are never live
+// at the same time may overlap. Unlike the buffer_assigner_t, which can only
+// reuse a whole freed buffer in the order of the requests, it places the
+// complete set of buffers at once, which brings the total size close to the
+// maximum total size of the buffers live at the same time.
+class buffer_packer_t {
+public:
+    struct buffer_t {
+        size_t size_;
+        // the first and the last time steps the buffer is live at
+        size_t start_;
+        size_t end_;
+    };
+
+    // the maximum total size of the buffers live at the same time step, which
+    // no packing can go below
+    static size_t lower_bound(const std::vector<buffer_t> &buffers);
+
+    // Places the buffers from the largest to the smallest one, each into the
+    // smallest gap it fits into between the placed buffers it's live together
+    // with, or on top of them. Returns the total size.
+    static size_t pack_greedy_by_size(const std::vector<buffer_t> &buffers,
+            std::vector<size_t> &offsets);
+
+    // Places the buffers as pack_greedy_by_size() does, but tries every order
+    // of the buffers and keeps the smallest total size. The search stops once
+    // the lower bound is reached, but it's only affordable for a few buffers.
+    static size_t pack_exhaustive(const std::vector<buffer_t> &buffers,
+            std::vector<size_t> &offsets);
+};
+
 // This memory_planner_t class is used to plan which buffer can be used by each
 // value in the subgraph. All the planning works are completed in compilation
 // stage for static shape cases.
@@ -297,6 +333,22 @@ private:
 // - _ONEDNN_GRAPH_ENABLE_MEM_REUSE
 //     - 0: Disable memory sharing
 //     - 1 (default): Enable memory sharing
+// - _ONEDNN_ENABLE_INTER_OP_PARALLEL
+//     - 0 (default): Ops are executed one by one in topological order
+//     - 1: Ops are grouped into execution stages, and the ops in the same stage
+//       may be executed concurrently. Only small ops share a stage, each large
+//       op gets a stage of its own. Buffers are only shared between values
+//       whose live ranges are disjoint in terms of stages.
+// - _ONEDNN_GRAPH_MEM_PLANNER
+//     - 0 (default): Internal temporary buffers reuse the freed ones by the
+//       greedy first-fit of the buffer_assigner_t
+//     - 1: Every internal temporary value gets its own buffer, and the
+//       offsets of the buffers are computed by the greedy-by-size packing of
+//       their live ranges
+//     - 2: Same as 1, but the packing tries every order of the buffers if
+//       there are at most 8 of them
+//   The planned and the lower bound sizes of the internal temporary buffers
+//   are reported with ONEDNN_VERBOSE=debuginfo=1.
 class memory_planner_t {
 public:
     memory_planner_t()
@@ -323,8 +375,21 @@ public:
         return temporary_registry_.size();
     }
 
+    // the maximum total size of the internal temporary values live at the
+    // same time, which no plan can go below
+    size_t internal_temporary_size_lower_bound() const {
+        return temporary_size_lower_bound_;
+    }
+
     execution_args_set_t &get_exec_args_set() { return exec_args_set_; }
 
+    // Get the execution stages of the planned subgraph. Each stage contains
+    // the indices (in topological order) of mutually independent ops. Empty if
+    // inter-op parallel execution is not enabled.
+    const std::vector<std::vector<size_t>> &get_exec_stages() const {
+        return exec_stages_;
+    }
+
     status_t run(std::shared_ptr<subgraph_t> &sg);
 
     const std::vector<inplace_pair_t> &get_subgraph_inplace_pairs() const {
@@ -396,6 +461,12 @@ private:
         temporary_registry_.clear();
         external_inputs_live_range_.clear();
         inplace_pairs_.clear();
+        exec_stages_.clear();
+        temporary_lives_.clear();
+        temporary_offsets_.clear();
+        temporary_size_lower_bound_ = 0;
+        concat_views_.clear();
+        temporary_views_.clear();
     }
 
     status_t assign_external_inputs_buffer(std::shared_ptr<subgraph_t> &sg,
@@ -410,11 +481,17 @@ private:
 
     status_t assign_internal_temporary_buffer(std::shared_ptr<subgraph_t> &sg,
             const std::unordered_map<value_t *, size_t> &edge_ref_count,
-            fusion_info_mgr_t &mgr, bool enable_standard_sharing);
+            fusion_info_mgr_t &mgr, bool enable_standard_sharing,
+            const std::vector<size_t> &op_stages);
+
+    void find_concat_views(std::shared_ptr<subgraph_t> &sg,
+            const std::unordered_map<value_t *, size_t> &edge_ref_count);
 
     status_t prepare_subgraph_inplace_pairs(
             std::shared_ptr<subgraph_t> &sg, bool enable_standard_sharing);
 
+    void pack_internal_temporary_buffers(bool exhaustive);
+
     status_t book_buffers(std::shared_ptr<subgraph_t> &sg);
 
     status_t prepare_execution_args_set(std::shared_ptr<subgraph_t> &sg,
@@ -433,6 +510,23 @@ private:
     std::unordered_map<const assign_info_t *, time_bound_t>
             external_inputs_live_range_;
     std::vector<inplace_pair_t> inplace_pairs_;
+    std::vector<std::vector<size_t>> exec_stages_;
+
+    // the live ranges of the internal temporary values in terms of the op
+    // visiting steps, with the indices of the buffers they are assigned to
+    std::vector<std::pair<size_t, buffer_packer_t::buffer_t>> temporary_lives_;
+    // the offsets of the internal temporary buffers, indexed by the buffer
+    // index, if they are packed
+    std::vector<size_t> temporary_offsets_;
+    size_t temporary_size_lower_bound_ = 0;
+
+    // the concat inputs which are placed in the concat output, with the
+    // output and the byte offset in it, so the concat doesn't copy them
+    std::unordered_map<const value_t *, std::pair<const value_t *, size_t>>
+            concat_views_;
+    // the internal temporary buffers of the concat inputs, with the buffer
+    // they are placed in and the byte offset in it
+    std::unordered_map<size_t, std::pair<size_t, size_t>> temporary_views_;
 };
 
 } // namespace dnnl_impl
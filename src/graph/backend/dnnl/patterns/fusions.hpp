@@ -44,6 +44,7 @@ DNNL_BACKEND_REGISTER_PATTERN_DECLARE(shuffle_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(single_op_pass)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(softmax_post_ops)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(layernorm_fusion)
+DNNL_BACKEND_REGISTER_PATTERN_DECLARE(groupnorm_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(sum_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(concat_fusion)
 
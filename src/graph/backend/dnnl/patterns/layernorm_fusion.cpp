@@ -88,6 +88,61 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, layernorm_post_ops_fusion_cpu)
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
             return std::make_shared<layernorm_fwd_t>();
         });
+
+//              RMSNorm
+//                 |
+//            [TypeCast]*
+//                 |
+// [unary/binary]*[0,MAX_REPETITION)
+//                 |
+//            [Quantize]*
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, rms_norm_post_ops_fusion_cpu)
+        .set_priority(8.2f)
+        .set_kind(graph::partition_kind_t::misc_post_ops)
+        .set_engine_kind(engine_kind::cpu)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *rms_norm_base
+                            = pgraph->append_op(graph::op_kind::RMSNorm);
+                    rms_norm_base->append_decision_function(
+                            check_input_dtype_from_offset<impl::data_type::f32,
+                                    1>);
+                    rms_norm_base->append_decision_function(
+                            check_begin_norm_axis_attr);
+
+                    // optional typecast
+                    auto tc_graph = std::make_shared<pb_graph_t>();
+                    pm::pb_op_t *ptypecast
+                            = tc_graph->append_op(graph::op_kind::TypeCast);
+                    tc_graph->create_input_port(0, ptypecast, 0);
+                    tc_graph->create_output_port(0, ptypecast, 0);
+                    auto pre_tc = pgraph->append_optional(tc_graph,
+                            in_edges_t {in_edge(0, rms_norm_base, 0)});
+
+                    // repetition(alternation(unary | binary))
+                    auto alt_unary_binary = std::make_shared<pb_graph_t>();
+                    auto palt = alt_unary_binary->append_alternation(
+                            get_unary_binary_ops());
+                    palt->allow_internal_inputs();
+                    alt_unary_binary->create_input_port(0, palt, 0);
+                    alt_unary_binary->create_output_port(0, palt, 0);
+                    auto prep = pgraph->append_repetition(alt_unary_binary,
+                            {0, 0}, 0, MAX_REPETITION,
+                            in_edges_t {in_edge(0, pre_tc, 0)});
+
+                    // optional quantize
+                    auto q_graph = std::make_shared<pb_graph_t>();
+                    pm::pb_op_t *pquantize
+                            = q_graph->append_op(graph::op_kind::Quantize);
+                    pquantize->append_decision_function(check_zps_values<0>);
+                    q_graph->create_input_port(0, pquantize, 0);
+                    q_graph->create_output_port(0, pquantize, 0);
+                    pgraph->append_optional(
+                            q_graph, in_edges_t {in_edge(0, prep, 0)});
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<layernorm_fwd_t>();
+        });
 #endif
 DNNL_BACKEND_REGISTER_PATTERN_DEF_END
 
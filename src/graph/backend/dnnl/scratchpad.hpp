@@ -16,6 +16,7 @@
 #ifndef GRAPH_BACKEND_DNNL_SCRATCHPAD_HPP
 #define GRAPH_BACKEND_DNNL_SCRATCHPAD_HPP
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <unordered_map>
@@ -119,6 +120,60 @@ private:
 #endif
 };
 
+// The buffer is kept across executions and only reallocated when a larger size
+// is requested. It's designed to be cached in thread_local_cache_t so that the
+// temporary buffer is not allocated for each execution. Because the buffer is
+// reused as soon as the previous execution returns, it can only be used on the
+// native CPU runtime where the execution is synchronous.
+class reusable_scratchpad_t : public scratchpad_t {
+public:
+    reusable_scratchpad_t(const dnnl::engine &eng, const allocator_t &alloc)
+        : buffer_(nullptr), size_(0), eng_(eng), alloc_(&alloc) {}
+
+    ~reusable_scratchpad_t() override {
+        if (buffer_) dnnl_allocator_t::free(buffer_, eng_, alloc_);
+    }
+
+    reusable_scratchpad_t(const reusable_scratchpad_t &) = delete;
+    reusable_scratchpad_t &operator=(const reusable_scratchpad_t &) = delete;
+
+    // make sure the buffer has at least size bytes. The content of the buffer
+    // is not preserved if it's reallocated.
+    void reserve(size_t size) {
+        if (size <= size_) return;
+        if (buffer_) dnnl_allocator_t::free(buffer_, eng_, alloc_);
+        buffer_ = reinterpret_cast<char *>(dnnl_allocator_t::malloc(
+                size, eng_, alloc_, allocator_t::mem_type_t::temp));
+        size_ = buffer_ ? size : 0;
+    }
+
+    char *get_buffer() const override { return buffer_; }
+
+    size_t size() const override { return size_; }
+
+private:
+    char *buffer_;
+    size_t size_;
+    dnnl::engine eng_;
+    const allocator_t *alloc_;
+};
+
+// The buffer is provided and owned by users. The scratchpad doesn't allocate
+// or deallocate it.
+class user_scratchpad_t : public scratchpad_t {
+public:
+    user_scratchpad_t(void *buffer, size_t size)
+        : buffer_(static_cast<char *>(buffer)), size_(buffer ? size : 0) {}
+
+    char *get_buffer() const override { return buffer_; }
+
+    size_t size() const override { return size_; }
+
+private:
+    char *buffer_;
+    size_t size_;
+};
+
 class registrar_t;
 class grantor_t;
 
@@ -160,6 +215,19 @@ public:
         lcm_alignment_ = graph::utils::lcm(lcm_alignment_, alignment);
     }
 
+    // book a piece of memory at the given offset, which must be a multiple of
+    // the alignment. Unlike book(), the pieces booked this way may overlap,
+    // which is used for the pieces that are never live at the same time.
+    void book_at(const key_t &key, offset_t offset, size_t size,
+            size_t alignment) {
+        if (offset_map_.count(key)) return;
+        assertm(offset % alignment == 0, "misaligned offset");
+
+        offset_map_.insert({key, offset});
+        size_ = std::max(size_, offset + size);
+        lcm_alignment_ = graph::utils::lcm(lcm_alignment_, alignment);
+    }
+
     // get the offset of a booked piece of memory
     offset_t get(const key_t &key) const {
         if (size_ == 0 || offset_map_.count(key) != 1) return 0;
@@ -201,6 +269,11 @@ public:
         registry_.book(key, size, alignment);
     }
 
+    void book_at(const registry_t::key_t &key, registry_t::offset_t offset,
+            size_t size, size_t alignment = 64) {
+        registry_.book_at(key, offset, size, alignment);
+    }
+
 private:
     registry_t &registry_;
 };
@@ -154,6 +154,7 @@ const op_kind_t End = dnnl_graph_op_end;
 const op_kind_t Exp = dnnl_graph_op_exp;
 const op_kind_t GELU = dnnl_graph_op_gelu;
 const op_kind_t GELUBackward = dnnl_graph_op_gelu_backward;
+const op_kind_t GroupNorm = dnnl_graph_op_group_norm;
 const op_kind_t HardSigmoid = dnnl_graph_op_hard_sigmoid;
 const op_kind_t HardSigmoidBackward = dnnl_graph_op_hard_sigmoid_backward;
 const op_kind_t HardSwish = dnnl_graph_op_hard_swish;
@@ -189,6 +190,8 @@ const op_kind_t ReduceSum = dnnl_graph_op_reduce_sum;
 const op_kind_t ReLU = dnnl_graph_op_relu;
 const op_kind_t ReLUBackward = dnnl_graph_op_relu_backward;
 const op_kind_t Reorder = dnnl_graph_op_reorder;
+const op_kind_t RMSNorm = dnnl_graph_op_rms_norm;
+const op_kind_t RoPE = dnnl_graph_op_rope;
 const op_kind_t Round = dnnl_graph_op_round;
 const op_kind_t Select = dnnl_graph_op_select;
 const op_kind_t Sigmoid = dnnl_graph_op_sigmoid;
@@ -206,6 +209,7 @@ const op_kind_t StaticTranspose = dnnl_graph_op_static_transpose;
 const op_kind_t Subtract = dnnl_graph_op_subtract;
 const op_kind_t Tanh = dnnl_graph_op_tanh;
 const op_kind_t TanhBackward = dnnl_graph_op_tanh_backward;
+const op_kind_t TopK = dnnl_graph_op_top_k;
 const op_kind_t TypeCast = dnnl_graph_op_type_cast;
 const op_kind_t Wildcard = dnnl_graph_op_wildcard;
 const op_kind_t LastSymbol = dnnl_graph_op_last_symbol;
@@ -227,6 +231,7 @@ const op_attr_t scales = dnnl_graph_op_attr_scales;
 const op_attr_t axis = dnnl_graph_op_attr_axis;
 const op_attr_t begin_norm_axis = dnnl_graph_op_attr_begin_norm_axis;
 const op_attr_t groups = dnnl_graph_op_attr_groups;
+const op_attr_t k = dnnl_graph_op_attr_k;
 
 const op_attr_t axes = dnnl_graph_op_attr_axes;
 const op_attr_t dilations = dnnl_graph_op_attr_dilations;
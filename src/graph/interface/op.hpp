@@ -318,6 +318,7 @@ public:
             CASE(axis);
             CASE(begin_norm_axis);
             CASE(groups);
+            CASE(k);
             CASE(axes);
             CASE(dilations);
             CASE(weights_shape);
@@ -393,6 +394,7 @@ public:
             CASE(Exp);
             CASE(GELU);
             CASE(GELUBackward);
+            CASE(GroupNorm);
             CASE(HardSigmoid);
             CASE(HardSigmoidBackward);
             CASE(HardSwish);
@@ -428,6 +430,8 @@ public:
             CASE(ReLU);
             CASE(ReLUBackward);
             CASE(Reorder);
+            CASE(RMSNorm);
+            CASE(RoPE);
             CASE(Round);
             CASE(Select);
             CASE(Sigmoid);
@@ -445,6 +449,7 @@ public:
             CASE(Subtract);
             CASE(Tanh);
             CASE(TanhBackward);
+            CASE(TopK);
             CASE(TypeCast);
             CASE(Wildcard);
             CASE(LastSymbol);
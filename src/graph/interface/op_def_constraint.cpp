@@ -113,6 +113,22 @@ bool check_ln_data_type(const op_t *n) {
     return true;
 }
 
+// check function for data_type of RMSNorm.
+// only when data is bf16, gamma can be bf16.
+bool check_rms_norm_data_type(const op_t *n) {
+    auto input_values = n->get_input_values();
+    if (input_values.size() < 2) return true;
+
+    const logical_tensor_t &src_lt = input_values[0]->get_logical_tensor();
+    const logical_tensor_t &gamma_lt = input_values[1]->get_logical_tensor();
+    VCHECK_SHAPE_INFER(!(src_lt.data_type != data_type::bf16
+                               && gamma_lt.data_type == data_type::bf16),
+            "%s, given data type %s v.s. expected data type bf16.",
+            op_t::kind2str(n->get_kind()).c_str(),
+            dnnl_dt2str(src_lt.data_type));
+    return true;
+}
+
 // check function for data_type of Typecast.
 // for TypeCast, input & output should not have the same dtype
 bool check_typecast_data_type(const op_t *n) {
@@ -197,7 +213,7 @@ bool check_interpolate_sizes_scales(const op_t *n) {
     return true;
 }
 
-// check function for output number of LayerNorm forward.
+// check function for output number of LayerNorm and GroupNorm forward.
 // if keep_stats == true, outputs should include mean and variance.
 bool check_ln_fwd_outputs_num(const op_t *n) {
     const size_t actual_num = n->num_outputs();
@@ -30,6 +30,8 @@ bool check_bn_data_type(const op_t *n);
 
 bool check_ln_data_type(const op_t *n);
 
+bool check_rms_norm_data_type(const op_t *n);
+
 bool check_typecast_data_type(const op_t *n);
 
 bool check_avgpool_bwd_input_shape(const op_t *n);
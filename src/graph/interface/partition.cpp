@@ -347,6 +347,40 @@ status_t DNNL_API dnnl_graph_compiled_partition_execute(
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_compiled_partition_query_scratchpad_size(
+        const compiled_partition_t *compiled_partition, size_t *size) {
+    if (utils::any_null(compiled_partition, size))
+        return status::invalid_arguments;
+
+    *size = compiled_partition->get_scratchpad_size();
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_execute_with_scratchpad(
+        const compiled_partition_t *compiled_partition, stream_t *stream,
+        size_t num_inputs, const tensor_t **inputs, size_t num_outputs,
+        const tensor_t **outputs, void *scratchpad) {
+    if (utils::any_null(stream, compiled_partition, inputs, outputs)) {
+        return status::invalid_arguments;
+    }
+    if (!scratchpad && compiled_partition->get_scratchpad_size() != 0)
+        return status::invalid_arguments;
+
+    std::vector<tensor_t> ins, outs;
+    ins.reserve(num_inputs);
+    outs.reserve(num_outputs);
+
+    for (size_t i = 0; i < num_inputs; ++i) {
+        ins.emplace_back(**(inputs + i));
+    }
+    for (size_t i = 0; i < num_outputs; ++i) {
+        outs.emplace_back(**(outputs + i));
+    }
+
+    return compiled_partition->execute_with_scratchpad(
+            stream, ins, outs, scratchpad);
+}
+
 status_t DNNL_API dnnl_graph_sycl_interop_compiled_partition_execute(
         const compiled_partition_t *compiled_partition, stream_t *stream,
         size_t num_inputs, const tensor_t **inputs, size_t num_outputs,
@@ -784,6 +818,36 @@ status_t dnnl_graph_compiled_partition::execute(const stream_t *astream,
     }
 }
 
+status_t dnnl_graph_compiled_partition::execute_with_scratchpad(
+        const stream_t *astream, const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs, void *scratchpad) const {
+    // User scratchpad is only supported on the native CPU runtime, where the
+    // execution is synchronous and the buffer can be safely reused by users
+    // after the execution returns.
+    if (!astream || (astream->engine()->kind() != pimpl_->get_engine()->kind()))
+        return status::invalid_arguments;
+    if (astream->engine()->kind() != engine_kind::cpu)
+        return status::unimplemented;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
+    UNUSED(inputs);
+    UNUSED(outputs);
+    UNUSED(scratchpad);
+    return status::unimplemented;
+#else
+    const backend_t *backend = src_partition_.get_assigned_backend();
+    if (!backend) return status::invalid_arguments;
+
+    // Pre-process the given tensor. The pre-process includes
+    // 1. decode backend id from the layout id and remove it
+    std::vector<tensor_t> processed_inputs, processed_outputs;
+    pre_process(processed_inputs, inputs, backend);
+    pre_process(processed_outputs, outputs, backend);
+
+    return pimpl_->execute_with_scratchpad(
+            astream, processed_inputs, processed_outputs, scratchpad);
+#endif
+}
+
 #ifdef DNNL_WITH_SYCL
 status_t dnnl_graph_compiled_partition::execute_sycl(const stream_t *astream,
         const std::vector<tensor_t> &inputs,
@@ -178,6 +178,16 @@ public:
             const std::vector<graph::tensor_t> &inputs,
             const std::vector<graph::tensor_t> &outputs) const;
 
+    size_t get_scratchpad_size() const {
+        if (!pimpl_) return 0;
+        return pimpl_->get_scratchpad_size();
+    }
+
+    graph::status_t execute_with_scratchpad(const graph::stream_t *astream,
+            const std::vector<graph::tensor_t> &inputs,
+            const std::vector<graph::tensor_t> &outputs,
+            void *scratchpad) const;
+
 #ifdef DNNL_WITH_SYCL
     graph::status_t execute_sycl(const graph::stream_t *astream,
             const std::vector<graph::tensor_t> &inputs,
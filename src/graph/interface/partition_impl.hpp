@@ -347,6 +347,27 @@ public:
             const std::vector<tensor_t> &outputs)
             = 0;
 
+    /// Query the size of the scratchpad buffer which can be given by users
+    /// to execute_with_scratchpad()
+    /// @return The size in bytes. 0 means the compiled partition doesn't
+    ///     need a scratchpad or doesn't support user provided scratchpad
+    virtual size_t get_scratchpad_size() const { return 0; }
+
+    /// Execute a compiled_partition with a scratchpad buffer provided by
+    /// users. The buffer is used for the internal temporary memory of the
+    /// compiled partition, so the backend doesn't need to allocate it during
+    /// execution.
+    /// @param scratchpad The scratchpad buffer which has at least
+    ///     get_scratchpad_size() bytes. It's owned by users and should not be
+    ///     used by other executions at the same time
+    /// @return The status code
+    virtual status_t execute_with_scratchpad(const stream_t *astream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, void *scratchpad) {
+        UNUSED(scratchpad);
+        return execute(astream, inputs, outputs);
+    }
+
 #ifdef DNNL_WITH_SYCL
     virtual status_t execute_sycl(const stream_t *astream,
             const std::vector<tensor_t> &inputs,
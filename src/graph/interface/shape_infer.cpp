@@ -1161,6 +1161,42 @@ status_t infer_norm_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_groupnorm_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto status = infer_identity_output_shape(n, inputs, outputs);
+    if (status != status::success) return status;
+
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    if (in0.is_shape_unknown()) return status::success;
+
+    const std::string fmt = n->has_attr(op_attr::data_format)
+            ? n->get_attr<std::string>(op_attr::data_format)
+            : "NXC";
+    const dim_t groups = n->get_attr<int64_t>(op_attr::groups);
+    const dim_t channels = in0.get_src_c(fmt);
+    VCHECK_INVALID_SHAPE(groups > 0 && channels % groups == 0,
+            "%s, the channels should be divisible by the groups, given "
+            "channels: %d, groups: %d",
+            op_t::kind2str(n->get_kind()).c_str(), static_cast<int>(channels),
+            static_cast<int>(groups));
+
+    const bool keep_stats = n->has_attr(op_attr::keep_stats)
+            ? n->get_attr<bool>(op_attr::keep_stats)
+            // Keep default value as which in op_schema
+            : true;
+    if (!keep_stats) return status::success;
+
+    // mean and variance are computed per group of each batch
+    const dims stats_dims {in0.vdims()[0], groups};
+    for (size_t i = 1; i < 3; i++) {
+        // check if output shape is already known
+        if (logical_tensor_wrapper_t(outputs[i]).is_shape_unknown())
+            set_shape_and_strides(*outputs[i], stats_dims);
+    }
+    return status::success;
+}
+
 status_t infer_norm_bprop_output_shape(op_t *n,
         std::vector<logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
@@ -1692,6 +1728,42 @@ status_t infer_prelu_bwd_output_shape(op_t *n,
             n, inputs, outputs, identity_shapes_pos);
 }
 
+status_t infer_top_k_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    dims shape = in0.vdims();
+    const auto ndims = static_cast<int64_t>(shape.size());
+
+    int64_t axis = n->get_attr<int64_t>(op_attr::axis);
+    VCHECK_INVALID_SHAPE(axis >= -ndims && axis < ndims,
+            "%s, axis %d is out of range [%d, %d)",
+            op_t::kind2str(n->get_kind()).c_str(), (int)axis, (int)-ndims,
+            (int)ndims);
+    if (axis < 0) axis += ndims;
+
+    const int64_t k = n->get_attr<int64_t>(op_attr::k);
+    const dim_t axis_size = shape[static_cast<size_t>(axis)];
+    VCHECK_INVALID_SHAPE(k >= 1
+                    && (axis_size == DNNL_GRAPH_UNKNOWN_DIM || k <= axis_size),
+            "%s, k %d is out of range [1, %d]",
+            op_t::kind2str(n->get_kind()).c_str(), (int)k, (int)axis_size);
+    shape[static_cast<size_t>(axis)] = k;
+
+    // The values and the indices have the same shape.
+    for (size_t i = 0; i < 2; i++) {
+        auto out = logical_tensor_wrapper_t(outputs[i]);
+        if (!out.is_shape_unknown()) {
+            VCHECK_INVALID_SHAPE(validate(shape, out.vdims()),
+                    "%s, inferred out shape and output shape are not "
+                    "compatible",
+                    op_t::kind2str(n->get_kind()).c_str());
+        }
+        set_shape_and_strides(*outputs[i], shape);
+    }
+    return status::success;
+}
+
 } // namespace graph
 } // namespace impl
 } // namespace dnnl
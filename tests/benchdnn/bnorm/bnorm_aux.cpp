@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2023 Intel Corporation
+* Copyright 2017-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -70,6 +70,7 @@ std::string flags2str(flags_t flags) {
     if (flags & USE_SHIFT) str += "H";
     if (flags & FUSE_NORM_RELU) str += "R";
     if (flags & FUSE_NORM_ADD_RELU) str += "A";
+    if (flags & RMS_NORM) str += "M";
     return str;
 }
 
@@ -232,6 +232,8 @@ void flex_rewrite::infer_output_shape(
             case dnnl::graph::op::kind::ReLU:
             case dnnl::graph::op::kind::ReLUBackward:
             case dnnl::graph::op::kind::Reorder:
+            case dnnl::graph::op::kind::RMSNorm:
+            case dnnl::graph::op::kind::RoPE:
             case dnnl::graph::op::kind::Round:
             case dnnl::graph::op::kind::Sigmoid:
             case dnnl::graph::op::kind::SigmoidBackward:
@@ -510,6 +512,17 @@ void flex_rewrite::infer_output_shape(
                     }
                 }
                 break;
+            // infer_groupnorm_output_shape
+            case dnnl::graph::op::kind::GroupNorm:
+                in0 = aop.in_lts_[0].id_;
+                out0 = aop.out_lts_[0].id_;
+                gi[out0] = gi[in0];
+                if (aop.out_lts_.size() == 3) {
+                    const int64_t groups = aop.attrs_["groups"].s64_value_;
+                    gi[aop.out_lts_[1].id_] = {gi[in0][0], groups};
+                    gi[aop.out_lts_[2].id_] = {gi[in0][0], groups};
+                }
+                break;
             // infer_norm_bwd_out_shape
             case dnnl::graph::op::kind::LayerNormBackward:
                 in0 = aop.in_lts_[0].id_;
@@ -654,6 +667,19 @@ void flex_rewrite::infer_output_shape(
                     }
                 }
                 break;
+            // infer_top_k_output_shape
+            case dnnl::graph::op::kind::TopK:
+                in0 = aop.in_lts_[0].id_;
+                out0 = aop.out_lts_[0].id_;
+                axis = -1;
+                if (aop.attrs_.find("axis") != aop.attrs_.end()) {
+                    axis = aop.attrs_["axis"].s64_value_;
+                }
+                if (axis < 0) { axis += gi[in0].size(); }
+                gi[out0] = gi[in0];
+                gi[out0][axis] = aop.attrs_["k"].s64_value_;
+                gi[aop.out_lts_[1].id_] = gi[out0];
+                break;
             // infer_unsupported_output_shape
             case dnnl::graph::op::kind::Wildcard:
             // no output, do nothing
@@ -1040,6 +1066,7 @@ void flex_rewrite::update_output_info(
         case dnnl::graph::op::kind::Exp:
         case dnnl::graph::op::kind::GELU:
         case dnnl::graph::op::kind::GELUBackward:
+        case dnnl::graph::op::kind::GroupNorm:
         case dnnl::graph::op::kind::HardSigmoid:
         case dnnl::graph::op::kind::HardSigmoidBackward:
         case dnnl::graph::op::kind::HardSwish:
@@ -1073,6 +1100,8 @@ void flex_rewrite::update_output_info(
         case dnnl::graph::op::kind::ReduceSum:
         case dnnl::graph::op::kind::ReLU:
         case dnnl::graph::op::kind::ReLUBackward:
+        case dnnl::graph::op::kind::RMSNorm:
+        case dnnl::graph::op::kind::RoPE:
         case dnnl::graph::op::kind::Round:
         case dnnl::graph::op::kind::Select:
         case dnnl::graph::op::kind::Sigmoid:
@@ -1087,6 +1116,7 @@ void flex_rewrite::update_output_info(
         case dnnl::graph::op::kind::Subtract:
         case dnnl::graph::op::kind::Tanh:
         case dnnl::graph::op::kind::TanhBackward:
+        case dnnl::graph::op::kind::TopK:
         case dnnl::graph::op::kind::TypeCast: {
             for (auto &lt : aop.out_lts_) {
                 // shape has been determined in 'gi' by infer_out_shape()
@@ -391,6 +391,7 @@ dnnl::graph::op::kind opstr2kind(const std::string &kind) {
             {"Exp", dnnl::graph::op::kind::Exp},
             {"GELU", dnnl::graph::op::kind::GELU},
             {"GELUBackward", dnnl::graph::op::kind::GELUBackward},
+            {"GroupNorm", dnnl::graph::op::kind::GroupNorm},
             {"HardSigmoid", dnnl::graph::op::kind::HardSigmoid},
             {"HardSigmoidBackward", dnnl::graph::op::kind::HardSigmoidBackward},
             {"HardSwish", dnnl::graph::op::kind::HardSwish},
@@ -426,6 +427,8 @@ dnnl::graph::op::kind opstr2kind(const std::string &kind) {
             {"ReLU", dnnl::graph::op::kind::ReLU},
             {"ReLUBackward", dnnl::graph::op::kind::ReLUBackward},
             {"Reorder", dnnl::graph::op::kind::Reorder},
+            {"RMSNorm", dnnl::graph::op::kind::RMSNorm},
+            {"RoPE", dnnl::graph::op::kind::RoPE},
             {"Round", dnnl::graph::op::kind::Round},
             {"Select", dnnl::graph::op::kind::Select},
             {"Sigmoid", dnnl::graph::op::kind::Sigmoid},
@@ -443,6 +446,7 @@ dnnl::graph::op::kind opstr2kind(const std::string &kind) {
             {"Subtract", dnnl::graph::op::kind::Subtract},
             {"Tanh", dnnl::graph::op::kind::Tanh},
             {"TanhBackward", dnnl::graph::op::kind::TanhBackward},
+            {"TopK", dnnl::graph::op::kind::TopK},
             {"TypeCast", dnnl::graph::op::kind::TypeCast},
             {"Wildcard", dnnl::graph::op::kind::Wildcard}};
     const auto it = op_map.find(kind);
@@ -474,6 +478,7 @@ dnnl::graph::op::attr attrstr2kind(const std::string &attr_name) {
             {"axis", dnnl::graph::op::attr::axis},
             {"begin_norm_axis", dnnl::graph::op::attr::begin_norm_axis},
             {"groups", dnnl::graph::op::attr::groups},
+            {"k", dnnl::graph::op::attr::k},
             // int64_t vector attributes. The value of these attributes can be a
             // vector of int64 numbers.
             {"axes", dnnl::graph::op::attr::axes},
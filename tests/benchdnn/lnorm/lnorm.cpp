@@ -151,7 +151,8 @@ int fill_variance_fwd(const prb_t *prb, const cfg_t &cfg, dnn_mem_t &mem_fp,
         if (prb->flags & GLOB_STATS) {
             val = ((n % 7) << 1);
         } else if (prb->c > 0) {
-            const float m = ref_mean.get_elem(n);
+            // RMS normalization computes the mean square of the source
+            const float m = prb->skip_mean() ? 0.f : ref_mean.get_elem(n);
             for (int64_t c = 0; c < prb->c; ++c) {
                 const int64_t off = n * prb->c + c;
                 const float s = ref_src.get_elem(off);
@@ -429,6 +430,13 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
         res->reason = skip_reason::case_not_supported;
         return;
     }
+
+    if (is_gpu() && prb->skip_mean()) {
+        // GPU does not support RMS normalization
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+    }
 }
 
 void skip_invalid_prb(const prb_t *prb, res_t *res) {
@@ -604,7 +612,8 @@ std::vector<data_kind_t> get_kinds_to_check(const prb_t *prb) {
     std::vector<data_kind_t> check_kinds;
     if (prb->dir & FLAG_FWD) {
         if (!(prb->flags & GLOB_STATS) && !(prb->dir & FLAG_INF)) {
-            check_kinds.push_back(MEAN);
+            // the mean is not computed with RMS normalization
+            if (!prb->skip_mean()) check_kinds.push_back(MEAN);
             check_kinds.push_back(VAR);
         }
         check_kinds.push_back(DST);
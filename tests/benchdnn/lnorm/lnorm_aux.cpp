@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2023 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -31,6 +31,8 @@ flags_t str2flags(const char *str) {
             flags |= USE_SCALE;
         } else if (*str == 'H') {
             flags |= USE_SHIFT;
+        } else if (*str == 'M') {
+            flags |= RMS_NORM;
         } else {
             BENCHDNN_PRINT(0, "%s \'%c\'\n",
                     "Error: --flags option doesn't support value", *str);
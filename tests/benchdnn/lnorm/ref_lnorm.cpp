@@ -34,6 +34,7 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
 
     const bool use_sc = prb->use_sc();
     const bool use_sh = prb->use_sh();
+    const bool skip_mean = prb->skip_mean();
 
     const bool has_src_scale = !prb->attr.scales.get(DNNL_ARG_SRC).is_def();
     const bool has_dst_scale = !prb->attr.scales.get(DNNL_ARG_DST).is_def();
@@ -48,7 +49,7 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
             prb->ndims, dnnl_layer_normalization);
 
     benchdnn_parallel_nd(prb->n, [&](int64_t n) {
-        float smean = mean.get_elem(n);
+        float smean = skip_mean ? 0.f : mean.get_elem(n);
         float svar = var.get_elem(n);
         float sqrt_var = sqrtf(svar + prb->eps);
 
@@ -79,6 +80,7 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
 
     const bool use_sc = prb->use_sc();
     const bool use_sh = prb->use_sh();
+    const bool skip_mean = prb->skip_mean();
 
     if ((use_sc || use_sh) && (prb->dir & FLAG_WEI)) {
         benchdnn_parallel_nd(prb->c, [&](int64_t c) {
@@ -86,7 +88,7 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
             float d_beta = 0;
 
             for (int64_t n = 0; n < prb->n; ++n) {
-                float smean = mean.get_elem(n);
+                float smean = skip_mean ? 0.f : mean.get_elem(n);
                 float svar = var.get_elem(n);
                 float rcp_denom = 1.f / sqrtf(svar + prb->eps);
                 auto off = n * prb->c + c;
@@ -101,7 +103,7 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
     }
 
     benchdnn_parallel_nd(prb->n, [&](int64_t n) {
-        float smean = mean.get_elem(n);
+        float smean = skip_mean ? 0.f : mean.get_elem(n);
         float svar = var.get_elem(n);
         float rcp_denom = 1.f / sqrtf(svar + prb->eps);
         float dd_gamma = 0, dd_gamma_x = 0;
@@ -122,7 +124,9 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
             float ds = d_dst.get_elem(off) * gamma;
             if (!(prb->flags & GLOB_STATS)) {
                 const float x = src.get_elem(off) - smean;
-                ds -= (dd_gamma + x * dd_gamma_x * rcp_denom) / prb->c;
+                // the mean doesn't depend on src with RMS normalization
+                if (!skip_mean) ds -= dd_gamma / prb->c;
+                ds -= x * dd_gamma_x * rcp_denom / prb->c;
             }
 
             d_src.set_elem(off, rcp_denom * ds);
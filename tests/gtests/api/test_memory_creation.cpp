@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2023 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,9 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdio>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
@@ -262,6 +265,78 @@ TEST(memory_test_cpp, TestSetDataHandleCPU) {
 
     free(p);
 }
+
+#if !defined(_WIN32)
+TEST(memory_test_cpp, TestCreateFromFileCPU) {
+    engine eng = engine(engine::kind::cpu, 0);
+    auto strm = stream(eng);
+
+    const memory::dims dims {37, 45};
+    memory::desc md(dims, memory::data_type::f32, memory::format_tag::ab);
+    const memory::dim nelems = dims[0] * dims[1];
+
+    // The data follows a header, so the offset is not page aligned.
+    const std::string path = ::testing::TempDir() + "dnnl_mapped_weights.bin";
+    const size_t header_size = 64;
+    std::vector<float> data(nelems);
+    for (memory::dim i = 0; i < nelems; i++)
+        data[i] = (float)((i * 7) % 31) - 15.f;
+    {
+        FILE *f = fopen(path.c_str(), "wb");
+        ASSERT_TRUE(f != nullptr);
+        const std::vector<char> header(header_size, 'h');
+        ASSERT_EQ(fwrite(header.data(), 1, header_size, f), header_size);
+        ASSERT_EQ(fwrite(data.data(), sizeof(float), nelems, f),
+                (size_t)nelems);
+        fclose(f);
+    }
+
+    // The file is smaller than the memory object.
+    EXPECT_ANY_THROW(
+            memory::create_from_file(md, eng, path, 2 * header_size));
+    // The offset is not a multiple of 64 bytes.
+    EXPECT_ANY_THROW(memory::create_from_file(md, eng, path, 4));
+    // The end of the memory object overflows.
+    EXPECT_ANY_THROW(memory::create_from_file(
+            md, eng, path, std::numeric_limits<size_t>::max() - 63));
+    EXPECT_ANY_THROW(memory::create_from_file(md, eng, path + ".none"));
+
+    {
+        auto mem = memory::create_from_file(md, eng, path, header_size);
+        ASSERT_EQ(mem.get_desc(), md);
+
+        // The mapped memory is a regular source of the weights reorder.
+        memory::desc blocked_md(
+                dims, memory::data_type::f32, memory::format_tag::AB16b16a);
+        auto mem_blocked = memory(blocked_md, eng);
+        auto mem_plain = memory(md, eng);
+        reorder(mem, mem_blocked).execute(strm, mem, mem_blocked);
+        reorder(mem_blocked, mem_plain).execute(strm, mem_blocked, mem_plain);
+        strm.wait();
+
+        float *mapped = static_cast<float *>(mem.get_data_handle());
+        const float *plain = static_cast<float *>(mem_plain.get_data_handle());
+        for (memory::dim i = 0; i < nelems; i++) {
+            ASSERT_EQ(mapped[i], data[i]) << "i " << i;
+            ASSERT_EQ(plain[i], data[i]) << "i " << i;
+        }
+
+        // The changes of the memory object are not written to the file.
+        mapped[0] = 100.f;
+    }
+
+    {
+        FILE *f = fopen(path.c_str(), "rb");
+        ASSERT_TRUE(f != nullptr);
+        float first = 0.f;
+        ASSERT_EQ(fseek(f, (long)header_size, SEEK_SET), 0);
+        ASSERT_EQ(fread(&first, sizeof(float), 1, f), 1u);
+        fclose(f);
+        ASSERT_EQ(first, data[0]);
+    }
+    std::remove(path.c_str());
+}
+#endif
 #endif
 
 } // namespace dnnl
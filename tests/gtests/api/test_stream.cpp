@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2021 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -137,6 +137,46 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+#if defined(DNNL_EXPERIMENTAL_PROFILING) \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+TEST(stream_test_cpp_t, TestProfilingAPICPU) {
+    engine eng(engine::kind::cpu, 0);
+
+    memory::dims dims = {2, 3, 4, 5};
+    memory::desc md(dims, memory::data_type::f32, memory::format_tag::nchw);
+
+    auto eltwise_pd = eltwise_forward::primitive_desc(
+            eng, prop_kind::forward, algorithm::eltwise_relu, md, md, 0.0f);
+    auto eltwise = eltwise_forward(eltwise_pd);
+    auto mem = memory(md, eng);
+
+    auto strm = stream(eng, stream::flags::profiling);
+
+    // Reset profiler's state.
+    ASSERT_NO_THROW(reset_profiling(strm));
+
+    eltwise.execute(strm, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    eltwise.execute(strm, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    strm.wait();
+
+    // Query profiling data, there is an entry per execution.
+    std::vector<uint64_t> nsec;
+    ASSERT_NO_THROW(nsec = get_profiling_data(strm, profiling_data_kind::time));
+    ASSERT_EQ(nsec.size(), 2U);
+
+    // Reset profiler's state.
+    ASSERT_NO_THROW(reset_profiling(strm));
+    // Test that the profiler's state was reset.
+    ASSERT_NO_THROW(nsec = get_profiling_data(strm, profiling_data_kind::time));
+    ASSERT_TRUE(nsec.empty());
+
+    // A stream without profiling enabled does not provide the data.
+    auto default_strm = stream(eng);
+    ASSERT_ANY_THROW(reset_profiling(default_strm));
+}
+#endif
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
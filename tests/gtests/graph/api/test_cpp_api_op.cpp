@@ -113,6 +113,10 @@ TEST(APIOp, CreateAllOps) {
             op::kind::HardSigmoidBackward,
             op::kind::Select,
             op::kind::Pow,
+            op::kind::RMSNorm,
+            op::kind::RoPE,
+            op::kind::TopK,
+            op::kind::GroupNorm,
     };
     // clang-format on
 
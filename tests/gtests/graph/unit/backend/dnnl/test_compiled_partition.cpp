@@ -29,6 +29,15 @@
 namespace graph = dnnl::impl::graph;
 namespace utils = dnnl::graph::tests::unit::utils;
 
+static inline void custom_setenv(
+        const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    SetEnvironmentVariable(name, value);
+#else
+    ::setenv(name, value, overwrite);
+#endif
+}
+
 TEST(test_compiled_partition_compiled_partition, Relu) {
     graph::engine_t *eng = get_engine();
 
@@ -360,3 +369,248 @@ TEST(test_compiled_partition_compiled_partition, GetInputsAndOutputs) {
                 ltw(cp->get_outputs()[i]).is_identical(ltw(outputs[i])), true);
     }
 }
+
+TEST(test_compiled_partition_compiled_partition, SymbolicShapeRelu) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    graph::op_t relu_op(graph::op_kind::ReLU, "relu");
+
+    // the batch size is bound at execution
+    const graph::logical_tensor_t lt_in
+            = utils::logical_tensor_init(/* tid= */ 1,
+                    {DNNL_GRAPH_UNKNOWN_DIM, 1, 3, 3}, graph::data_type::f32,
+                    graph::layout_type::any);
+    const graph::logical_tensor_t lt_out
+            = utils::logical_tensor_init(/* tid= */ 2,
+                    {DNNL_GRAPH_UNKNOWN_DIM, 1, 3, 3}, graph::data_type::f32,
+                    graph::layout_type::any);
+
+    relu_op.add_input(lt_in);
+    relu_op.add_output(lt_out);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&relu_op);
+    g.finalize();
+    run_all_passes(g);
+
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    std::vector<const graph::logical_tensor_t *> lt_inputs {&lt_in};
+    std::vector<const graph::logical_tensor_t *> lt_outputs {&lt_out};
+
+    // the partition can't be compiled without the buckets of the batch size
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_BUCKETS", "", 1);
+    graph::compiled_partition_t cp0(p);
+    ASSERT_EQ(p.compile(&cp0, lt_inputs, lt_outputs, eng),
+            graph::status::unimplemented);
+
+    // the kernels of the batch sizes 2 and 5 are compiled ahead of time
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_BUCKETS", "5,2", 1);
+    graph::compiled_partition_t cp(p);
+    graph::status_t ret = p.compile(&cp, lt_inputs, lt_outputs, eng);
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_BUCKETS", "", 1);
+    ASSERT_EQ(ret, graph::status::success);
+
+    // execute the same compiled partition with different batch sizes
+    for (graph::dim_t batch : {2, 5, 2}) {
+        const graph::logical_tensor_t in = utils::logical_tensor_init(
+                /* tid= */ 1, {batch, 1, 3, 3}, graph::data_type::f32);
+        const graph::logical_tensor_t out = utils::logical_tensor_init(
+                /* tid= */ 2, {batch, 1, 3, 3}, graph::data_type::f32);
+
+        const size_t nelems = static_cast<size_t>(batch) * 9;
+        std::vector<float> data_in(nelems), data_out(nelems);
+        for (size_t i = 0; i < nelems; i++) {
+            data_in[i] = static_cast<float>(i) - static_cast<float>(nelems / 2);
+        }
+        test_tensor t_in(in, eng, data_in), t_out(out, eng, data_out);
+
+        ASSERT_EQ(cp.execute(strm, {t_in.get()}, {t_out.get()}),
+                graph::status::success);
+        strm->wait();
+
+        data_out = t_out.as_vec_type<float>();
+        for (size_t i = 0; i < nelems; i++) {
+            ASSERT_FLOAT_EQ(data_out[i], std::max(data_in[i], 0.f));
+        }
+    }
+
+    // the known dimensions can't be changed
+    const graph::logical_tensor_t bad_in = utils::logical_tensor_init(
+            /* tid= */ 1, {2, 2, 3, 3}, graph::data_type::f32);
+    const graph::logical_tensor_t bad_out = utils::logical_tensor_init(
+            /* tid= */ 2, {2, 2, 3, 3}, graph::data_type::f32);
+    std::vector<float> bad_data_in(36), bad_data_out(36);
+    test_tensor t_bad_in(bad_in, eng, bad_data_in),
+            t_bad_out(bad_out, eng, bad_data_out);
+    ASSERT_EQ(cp.execute(strm, {t_bad_in.get()}, {t_bad_out.get()}),
+            graph::status::invalid_arguments);
+
+    // the batch size can't exceed the largest bucket
+    const graph::logical_tensor_t large_in = utils::logical_tensor_init(
+            /* tid= */ 1, {8, 1, 3, 3}, graph::data_type::f32);
+    const graph::logical_tensor_t large_out = utils::logical_tensor_init(
+            /* tid= */ 2, {8, 1, 3, 3}, graph::data_type::f32);
+    std::vector<float> large_data_in(72), large_data_out(72);
+    test_tensor t_large_in(large_in, eng, large_data_in),
+            t_large_out(large_out, eng, large_data_out);
+    ASSERT_EQ(cp.execute(strm, {t_large_in.get()}, {t_large_out.get()}),
+            graph::status::invalid_arguments);
+}
+
+TEST(test_compiled_partition_compiled_partition, SymbolicShapeBucketedRelu) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - shape bucketing is CPU only.");
+
+    graph::op_t relu_op(graph::op_kind::ReLU, "relu");
+
+    const graph::logical_tensor_t lt_in
+            = utils::logical_tensor_init(/* tid= */ 1,
+                    {DNNL_GRAPH_UNKNOWN_DIM, 1, 3, 3}, graph::data_type::f32,
+                    graph::layout_type::any);
+    const graph::logical_tensor_t lt_out
+            = utils::logical_tensor_init(/* tid= */ 2,
+                    {DNNL_GRAPH_UNKNOWN_DIM, 1, 3, 3}, graph::data_type::f32,
+                    graph::layout_type::any);
+
+    relu_op.add_input(lt_in);
+    relu_op.add_output(lt_out);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&relu_op);
+    g.finalize();
+    run_all_passes(g);
+
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    // the batch is rounded up to the buckets 4 and 8
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_BUCKETS", "4,8", 1);
+    graph::compiled_partition_t cp(p);
+    std::vector<const graph::logical_tensor_t *> lt_inputs {&lt_in};
+    std::vector<const graph::logical_tensor_t *> lt_outputs {&lt_out};
+    graph::status_t ret = p.compile(&cp, lt_inputs, lt_outputs, eng);
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_BUCKETS", "", 1);
+    ASSERT_EQ(ret, graph::status::success);
+
+    for (graph::dim_t batch : {3, 4, 5, 7}) {
+        const graph::logical_tensor_t in = utils::logical_tensor_init(
+                /* tid= */ 1, {batch, 1, 3, 3}, graph::data_type::f32);
+        const graph::logical_tensor_t out = utils::logical_tensor_init(
+                /* tid= */ 2, {batch, 1, 3, 3}, graph::data_type::f32);
+
+        const size_t nelems = static_cast<size_t>(batch) * 9;
+        std::vector<float> data_in(nelems), data_out(nelems);
+        for (size_t i = 0; i < nelems; i++) {
+            data_in[i] = static_cast<float>(i) - static_cast<float>(nelems / 2);
+        }
+        test_tensor t_in(in, eng, data_in), t_out(out, eng, data_out);
+
+        ASSERT_EQ(cp.execute(strm, {t_in.get()}, {t_out.get()}),
+                graph::status::success);
+        strm->wait();
+
+        data_out = t_out.as_vec_type<float>();
+        for (size_t i = 0; i < nelems; i++) {
+            ASSERT_FLOAT_EQ(data_out[i], std::max(data_in[i], 0.f));
+        }
+    }
+}
+
+TEST(test_compiled_partition_compiled_partition, SymbolicShapeBucketedAdd) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - shape bucketing is CPU only.");
+
+    graph::op_t add_op(graph::op_kind::Add, "add");
+
+    // the sequence length in the middle dimension is bound at execution
+    const graph::dim_t seq_len = DNNL_GRAPH_UNKNOWN_DIM;
+    const graph::logical_tensor_t lt_in0 = utils::logical_tensor_init(
+            /* tid= */ 1, {2, seq_len, 3}, graph::data_type::f32,
+            graph::layout_type::any);
+    const graph::logical_tensor_t lt_in1 = utils::logical_tensor_init(
+            /* tid= */ 2, {2, seq_len, 3}, graph::data_type::f32,
+            graph::layout_type::any);
+    const graph::logical_tensor_t lt_out = utils::logical_tensor_init(
+            /* tid= */ 3, {2, seq_len, 3}, graph::data_type::f32,
+            graph::layout_type::any);
+
+    add_op.add_input(lt_in0);
+    add_op.add_input(lt_in1);
+    add_op.add_output(lt_out);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&add_op);
+    g.finalize();
+    run_all_passes(g);
+
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    // the sequence length is rounded up to the buckets 4 and 8
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_BUCKETS", "4,8", 1);
+    graph::compiled_partition_t cp(p);
+    std::vector<const graph::logical_tensor_t *> lt_inputs {&lt_in0, &lt_in1};
+    std::vector<const graph::logical_tensor_t *> lt_outputs {&lt_out};
+    graph::status_t ret = p.compile(&cp, lt_inputs, lt_outputs, eng);
+    custom_setenv("ONEDNN_GRAPH_DYNAMIC_SHAPE_BUCKETS", "", 1);
+    ASSERT_EQ(ret, graph::status::success);
+
+    for (graph::dim_t len : {3, 4, 6}) {
+        const graph::logical_tensor_t in0 = utils::logical_tensor_init(
+                /* tid= */ 1, {2, len, 3}, graph::data_type::f32);
+        const graph::logical_tensor_t in1 = utils::logical_tensor_init(
+                /* tid= */ 2, {2, len, 3}, graph::data_type::f32);
+        const graph::logical_tensor_t out = utils::logical_tensor_init(
+                /* tid= */ 3, {2, len, 3}, graph::data_type::f32);
+
+        const size_t nelems = static_cast<size_t>(len) * 6;
+        std::vector<float> data_in0(nelems), data_in1(nelems),
+                data_out(nelems);
+        for (size_t i = 0; i < nelems; i++) {
+            data_in0[i] = static_cast<float>(i);
+            data_in1[i] = static_cast<float>(2 * i + 1);
+        }
+        test_tensor t_in0(in0, eng, data_in0), t_in1(in1, eng, data_in1),
+                t_out(out, eng, data_out);
+
+        ASSERT_EQ(cp.execute(strm, {t_in0.get(), t_in1.get()}, {t_out.get()}),
+                graph::status::success);
+        strm->wait();
+
+        data_out = t_out.as_vec_type<float>();
+        for (size_t i = 0; i < nelems; i++) {
+            ASSERT_FLOAT_EQ(data_out[i], data_in0[i] + data_in1[i]);
+        }
+    }
+
+    // all the unknown dimensions must be bound to the same value
+    const graph::logical_tensor_t in0 = utils::logical_tensor_init(
+            /* tid= */ 1, {2, 3, 3}, graph::data_type::f32);
+    const graph::logical_tensor_t in1 = utils::logical_tensor_init(
+            /* tid= */ 2, {2, 4, 3}, graph::data_type::f32);
+    const graph::logical_tensor_t out = utils::logical_tensor_init(
+            /* tid= */ 3, {2, 4, 3}, graph::data_type::f32);
+    std::vector<float> data_in0(18), data_in1(24), data_out(24);
+    test_tensor t_in0(in0, eng, data_in0), t_in1(in1, eng, data_in1),
+            t_out(out, eng, data_out);
+    ASSERT_EQ(cp.execute(strm, {t_in0.get(), t_in1.get()}, {t_out.get()}),
+            graph::status::invalid_arguments);
+}
@@ -0,0 +1,326 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+namespace {
+
+// Normalizes src of N batches with C channels and X spatial points. The
+// channels are the innermost dimension when `nxc` is true.
+void ref_group_norm(const std::vector<float> &src,
+        const std::vector<float> &gamma, const std::vector<float> &beta,
+        size_t N, size_t C, size_t X, size_t G, bool nxc, float epsilon,
+        std::vector<float> &dst, std::vector<float> &mean,
+        std::vector<float> &var) {
+    const size_t CG = C / G;
+    const auto off = [&](size_t n, size_t c, size_t x) {
+        return nxc ? (n * X + x) * C + c : (n * C + c) * X + x;
+    };
+    dst.resize(src.size());
+    mean.resize(N * G);
+    var.resize(N * G);
+    for (size_t n = 0; n < N; n++)
+        for (size_t g = 0; g < G; g++) {
+            float m = 0.f, v = 0.f;
+            for (size_t c = g * CG; c < (g + 1) * CG; c++)
+                for (size_t x = 0; x < X; x++)
+                    m += src[off(n, c, x)];
+            m /= CG * X;
+            for (size_t c = g * CG; c < (g + 1) * CG; c++)
+                for (size_t x = 0; x < X; x++)
+                    v += (src[off(n, c, x)] - m) * (src[off(n, c, x)] - m);
+            v /= CG * X;
+            mean[n * G + g] = m;
+            var[n * G + g] = v;
+            for (size_t c = g * CG; c < (g + 1) * CG; c++)
+                for (size_t x = 0; x < X; x++)
+                    dst[off(n, c, x)] = gamma[c] * (src[off(n, c, x)] - m)
+                                    / std::sqrt(v + epsilon)
+                            + beta[c];
+        }
+}
+
+} // namespace
+
+TEST(test_group_norm_execute, GroupNormInference) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const size_t N = 2, C = 4, X = 3, G = 2;
+    std::vector<float> src(N * C * X);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = 0.5f * ((i * 5) % 7) - 1.f;
+    std::vector<float> gamma {1.0, 2.0, 0.5, 1.5};
+    std::vector<float> beta {0.0, 1.0, -1.0, 0.5};
+    std::vector<float> ref_dst, ref_mean, ref_var;
+    ref_group_norm(src, gamma, beta, N, C, X, G, false, 1e-5f, ref_dst,
+            ref_mean, ref_var);
+    std::vector<float> dst(src.size(), 0.f);
+
+    graph::op_t gn_op(graph::op_kind::GroupNorm);
+    gn_op.set_attr<int64_t>(graph::op_attr::groups, G);
+    gn_op.set_attr<bool>(graph::op_attr::keep_stats, false);
+    gn_op.set_attr<std::string>(graph::op_attr::data_format, "NCX");
+
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {2, 4, 3}, graph::data_type::f32);
+    graph::logical_tensor_t gamma_lt
+            = utils::logical_tensor_init(1, {4}, graph::data_type::f32);
+    graph::logical_tensor_t beta_lt
+            = utils::logical_tensor_init(2, {4}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(3, {2, 4, 3}, graph::data_type::f32);
+
+    gn_op.add_input(src_lt);
+    gn_op.add_input(gamma_lt);
+    gn_op.add_input(beta_lt);
+    gn_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&gn_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("gn_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &gamma_lt, &beta_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    test_tensor src_ts(src_lt, engine, src);
+    test_tensor gamma_ts(gamma_lt, engine, gamma);
+    test_tensor beta_ts(beta_lt, engine, beta);
+    test_tensor dst_ts(dst_lt, engine, dst);
+
+    cp.execute(strm, {src_ts.get(), gamma_ts.get(), beta_ts.get()},
+            {dst_ts.get()});
+    strm->wait();
+    dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-5f);
+    }
+}
+
+TEST(test_group_norm_execute, GroupNormTrainingNxc) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const size_t N = 2, C = 6, X = 4, G = 3;
+    std::vector<float> src(N * C * X);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = 0.25f * ((i * 7) % 11) - 1.f;
+    std::vector<float> gamma {1.0, 2.0, 0.5, 1.5, 1.0, 0.25};
+    std::vector<float> beta {0.0, 1.0, -1.0, 0.5, 0.0, 2.0};
+    std::vector<float> ref_dst, ref_mean, ref_var;
+    ref_group_norm(src, gamma, beta, N, C, X, G, true, 1e-5f, ref_dst,
+            ref_mean, ref_var);
+    std::vector<float> dst(src.size(), 0.f);
+    std::vector<float> mean(ref_mean.size(), 0.f);
+    std::vector<float> var(ref_var.size(), 0.f);
+
+    graph::op_t gn_op(graph::op_kind::GroupNorm);
+    gn_op.set_attr<int64_t>(graph::op_attr::groups, G);
+
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            0, {2, 2, 2, 6}, graph::data_type::f32);
+    graph::logical_tensor_t gamma_lt
+            = utils::logical_tensor_init(1, {6}, graph::data_type::f32);
+    graph::logical_tensor_t beta_lt
+            = utils::logical_tensor_init(2, {6}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+            3, {2, 2, 2, 6}, graph::data_type::f32);
+    graph::logical_tensor_t mean_lt
+            = utils::logical_tensor_init(4, {2, 3}, graph::data_type::f32);
+    graph::logical_tensor_t var_lt
+            = utils::logical_tensor_init(5, {2, 3}, graph::data_type::f32);
+
+    gn_op.add_input(src_lt);
+    gn_op.add_input(gamma_lt);
+    gn_op.add_input(beta_lt);
+    gn_op.add_output(dst_lt);
+    gn_op.add_output(mean_lt);
+    gn_op.add_output(var_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&gn_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("gn_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &gamma_lt, &beta_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {
+            &dst_lt, &mean_lt, &var_lt};
+
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    test_tensor src_ts(src_lt, engine, src);
+    test_tensor gamma_ts(gamma_lt, engine, gamma);
+    test_tensor beta_ts(beta_lt, engine, beta);
+    test_tensor dst_ts(dst_lt, engine, dst);
+    test_tensor mean_ts(mean_lt, engine, mean);
+    test_tensor var_ts(var_lt, engine, var);
+
+    cp.execute(strm, {src_ts.get(), gamma_ts.get(), beta_ts.get()},
+            {dst_ts.get(), mean_ts.get(), var_ts.get()});
+    strm->wait();
+    dst = dst_ts.as_vec_type<float>();
+    mean = mean_ts.as_vec_type<float>();
+    var = var_ts.as_vec_type<float>();
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-5f);
+    }
+    for (size_t i = 0; i < ref_mean.size(); ++i) {
+        ASSERT_NEAR(mean[i], ref_mean[i], 1e-5f);
+        ASSERT_NEAR(var[i], ref_var[i], 1e-5f);
+    }
+}
+
+TEST(test_group_norm_execute_subgraph_fp32, GroupNormSwishAdd_CPU) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "Skip fusion for GPU device.");
+
+    /*
+          GroupNorm
+           /     \
+       Sigmoid    |
+           \     /
+          Multiply   [other]
+               \     /
+                 Add
+    */
+    const size_t N = 2, C = 4, X = 6, G = 2;
+    std::vector<float> src(N * C * X);
+    std::vector<float> other(src.size());
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = 0.5f * ((i * 5) % 9) - 2.f;
+        other[i] = 0.25f * (i % 5);
+    }
+    std::vector<float> gamma {1.0, 2.0, 0.5, 1.5};
+    std::vector<float> beta {0.0, 1.0, -1.0, 0.5};
+    std::vector<float> ref_dst, ref_mean, ref_var;
+    ref_group_norm(src, gamma, beta, N, C, X, G, true, 1e-5f, ref_dst,
+            ref_mean, ref_var);
+    for (size_t i = 0; i < ref_dst.size(); i++)
+        ref_dst[i] = ref_dst[i] / (1.f + std::exp(-ref_dst[i])) + other[i];
+    std::vector<float> dst(src.size(), 0.f);
+
+    graph::op_t gn_op(0, graph::op_kind::GroupNorm, "groupnorm");
+    gn_op.set_attr<int64_t>(graph::op_attr::groups, G);
+    gn_op.set_attr<bool>(graph::op_attr::keep_stats, false);
+    graph::op_t sigmoid_op(1, graph::op_kind::Sigmoid, "sigmoid");
+    graph::op_t mul_op(2, graph::op_kind::Multiply, "mul");
+    graph::op_t add_op(3, graph::op_kind::Add, "add");
+
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            0, {2, 3, 2, 4}, graph::data_type::f32);
+    graph::logical_tensor_t gamma_lt
+            = utils::logical_tensor_init(1, {4}, graph::data_type::f32);
+    graph::logical_tensor_t beta_lt
+            = utils::logical_tensor_init(2, {4}, graph::data_type::f32);
+    graph::logical_tensor_t gn_dst_lt = utils::logical_tensor_init(
+            3, {2, 3, 2, 4}, graph::data_type::f32);
+    graph::logical_tensor_t sigmoid_dst_lt = utils::logical_tensor_init(
+            4, {2, 3, 2, 4}, graph::data_type::f32);
+    graph::logical_tensor_t mul_dst_lt = utils::logical_tensor_init(
+            5, {2, 3, 2, 4}, graph::data_type::f32);
+    graph::logical_tensor_t other_lt = utils::logical_tensor_init(
+            6, {2, 3, 2, 4}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+            7, {2, 3, 2, 4}, graph::data_type::f32);
+
+    gn_op.add_input(src_lt);
+    gn_op.add_input(gamma_lt);
+    gn_op.add_input(beta_lt);
+    gn_op.add_output(gn_dst_lt);
+    sigmoid_op.add_input(gn_dst_lt);
+    sigmoid_op.add_output(sigmoid_dst_lt);
+    mul_op.add_input(sigmoid_dst_lt);
+    mul_op.add_input(gn_dst_lt);
+    mul_op.add_output(mul_dst_lt);
+    add_op.add_input(mul_dst_lt);
+    add_op.add_input(other_lt);
+    add_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&gn_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&sigmoid_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&mul_op), graph::status::success);
+    ASSERT_EQ(g.add_op(&add_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass
+            = get_pass("groupnorm_post_ops_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+    ASSERT_EQ(part->get_ops().size(), 4U);
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {
+            &src_lt, &gamma_lt, &beta_lt, &other_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    test_tensor src_ts(src_lt, engine, src);
+    test_tensor gamma_ts(gamma_lt, engine, gamma);
+    test_tensor beta_ts(beta_lt, engine, beta);
+    test_tensor other_ts(other_lt, engine, other);
+    test_tensor dst_ts(dst_lt, engine, dst);
+
+    cp.execute(strm,
+            {src_ts.get(), gamma_ts.get(), beta_ts.get(), other_ts.get()},
+            {dst_ts.get()});
+    strm->wait();
+    dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-5f);
+    }
+}
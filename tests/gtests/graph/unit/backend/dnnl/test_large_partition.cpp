@@ -15,11 +15,17 @@
 *******************************************************************************/
 
 #include <functional>
+#include <memory>
 #include <random>
+#include <string>
 
 #include "oneapi/dnnl/dnnl_graph.hpp"
 #include "gtest/gtest.h"
 
+#include "backend/dnnl/dnnl_partition_impl.hpp"
+#include "backend/dnnl/kernels/depth_first.hpp"
+#include "backend/dnnl/kernels/large_partition.hpp"
+
 #include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
 #include "graph/unit/unit_test_common.hpp"
 #include "graph/unit/utils.hpp"
@@ -338,6 +344,341 @@ TEST(test_large_partition_execute, F32Resnet50Stage2Block) {
                     /*atol*/ 1e-5f));
 }
 
+TEST(test_large_partition_execute, F32Resnet50Stage2BlockInterOpParallel) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - inter-op parallel execution is CPU only.");
+
+    utils::id_generator id_gen;
+    graph::graph_t g(eng->kind());
+    utils::construct_f32_resnet50_stage2_block(
+            &g, id_gen, 3, /* use biasadd */ true);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("f32_resnet50_stage_2_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = std::dynamic_pointer_cast<
+            graph::dnnl_impl::dnnl_partition_impl_t>(g.get_partitions()[0]);
+    ASSERT_TRUE(part);
+
+    std::vector<graph::logical_tensor_t> inputs = part->get_inputs();
+    std::vector<graph::logical_tensor_t> outputs = part->get_outputs();
+    for (auto &lt : outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+    }
+
+    // The kernel is used directly to check the execution stages it is
+    // executed by.
+    graph::dnnl_impl::larger_partition_kernel_t kernel;
+    custom_setenv("_ONEDNN_ENABLE_INTER_OP_PARALLEL", "1", 1);
+    graph::status_t ret = kernel.compile(part.get(), eng, inputs, outputs);
+    custom_setenv("_ONEDNN_ENABLE_INTER_OP_PARALLEL", "0", 1);
+    ASSERT_EQ(ret, graph::status::success);
+
+    // the residual branch of the block is independent of the main branch and
+    // the convolutions are small, so they are put into the same stages
+    const auto &stages = kernel.get_memory_planner().get_exec_stages();
+    ASSERT_FALSE(stages.empty());
+    ASSERT_TRUE(std::any_of(stages.begin(), stages.end(),
+            [](const std::vector<size_t> &stage) { return stage.size() > 1; }));
+
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    std::vector<std::vector<float>> inputs_data;
+    std::vector<std::vector<float>> outputs_data, ref_outputs_data;
+    std::vector<test_tensor> inputs_ts, outputs_ts, ref_outputs_ts;
+
+    for (auto &lt : inputs) {
+        inputs_data.emplace_back(
+                std::vector<float>(utils::product(ltw(lt).vdims())));
+        fill_data(inputs_data.back(), ltw(lt).data_type());
+        inputs_ts.emplace_back(lt, eng, inputs_data.back());
+    }
+
+    for (auto &lt : outputs) {
+        const std::vector<int64_t> dims = ltw(lt).vdims();
+        auto size = utils::product(dims);
+        outputs_data.emplace_back(std::vector<float>(size));
+        outputs_ts.emplace_back(lt, eng, outputs_data.back());
+        ref_outputs_data.emplace_back(std::vector<float>(size));
+        ref_outputs_ts.emplace_back(lt, eng, ref_outputs_data.back());
+    }
+
+    ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *eng, *strm),
+            graph::status::success);
+
+    ASSERT_EQ(kernel.execute(strm, test_tensor::to_graph_tensor(inputs_ts),
+                      test_tensor::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    strm->wait();
+
+    ASSERT_TRUE(
+            allclose<float>(outputs_ts[0], ref_outputs_ts[0], /*rtol*/ 1e-5f,
+                    /*atol*/ 1e-5f));
+}
+
+TEST(test_large_partition_execute, F32Resnet50Stage2BlockMemPlanner) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    utils::id_generator id_gen;
+    graph::graph_t g(eng->kind());
+    utils::construct_f32_resnet50_stage2_block(
+            &g, id_gen, 3, /* use biasadd */ true);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("f32_resnet50_stage_2_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = std::dynamic_pointer_cast<
+            graph::dnnl_impl::dnnl_partition_impl_t>(g.get_partitions()[0]);
+    ASSERT_TRUE(part);
+
+    std::vector<graph::logical_tensor_t> inputs = part->get_inputs();
+    std::vector<graph::logical_tensor_t> outputs = part->get_outputs();
+    for (auto &lt : outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+    }
+
+    // The temporary buffers are placed by the greedy and by the exhaustive
+    // packing of their live ranges. Each kernel is compiled on a copy of the
+    // partition, since the compilation transforms the partition.
+    const std::vector<std::string> mem_planners {"1", "2"};
+    using kernel_t = graph::dnnl_impl::larger_partition_kernel_t;
+    std::vector<std::shared_ptr<kernel_t>> kernels;
+    for (size_t i = 0; i < mem_planners.size(); i++) {
+        kernels.emplace_back(std::make_shared<kernel_t>());
+        auto part_copy = std::dynamic_pointer_cast<
+                graph::dnnl_impl::dnnl_partition_impl_t>(part->clone());
+        custom_setenv("_ONEDNN_GRAPH_MEM_PLANNER", mem_planners[i].c_str(), 1);
+        graph::status_t ret
+                = kernels[i]->compile(part_copy.get(), eng, inputs, outputs);
+        custom_setenv("_ONEDNN_GRAPH_MEM_PLANNER", "0", 1);
+        ASSERT_EQ(ret, graph::status::success);
+    }
+
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    std::vector<std::vector<float>> inputs_data;
+    std::vector<std::vector<float>> outputs_data, ref_outputs_data;
+    std::vector<test_tensor> inputs_ts, outputs_ts, ref_outputs_ts;
+
+    for (auto &lt : inputs) {
+        inputs_data.emplace_back(
+                std::vector<float>(utils::product(ltw(lt).vdims())));
+        fill_data(inputs_data.back(), ltw(lt).data_type());
+        inputs_ts.emplace_back(lt, eng, inputs_data.back());
+    }
+
+    for (auto &lt : outputs) {
+        const std::vector<int64_t> dims = ltw(lt).vdims();
+        auto size = utils::product(dims);
+        outputs_data.emplace_back(std::vector<float>(size));
+        outputs_ts.emplace_back(lt, eng, outputs_data.back());
+        ref_outputs_data.emplace_back(std::vector<float>(size));
+        ref_outputs_ts.emplace_back(lt, eng, ref_outputs_data.back());
+    }
+
+    ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *eng, *strm),
+            graph::status::success);
+
+    for (size_t i = 0; i < mem_planners.size(); i++) {
+        ASSERT_EQ(kernels[i]->execute(strm,
+                          test_tensor::to_graph_tensor(inputs_ts),
+                          test_tensor::to_graph_tensor(outputs_ts)),
+                graph::status::success);
+        strm->wait();
+
+        ASSERT_TRUE(allclose<float>(outputs_ts[0], ref_outputs_ts[0],
+                /*rtol*/ 1e-5f, /*atol*/ 1e-5f))
+                << "mem planner " << mem_planners[i];
+    }
+}
+
+TEST(test_large_partition_execute, F32Resnet50Stage2BlockUserScratchpad) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - user scratchpad is CPU only.");
+
+    utils::id_generator id_gen;
+    graph::graph_t g(eng->kind());
+    utils::construct_f32_resnet50_stage2_block(
+            &g, id_gen, 3, /* use biasadd */ true);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("f32_resnet50_stage_2_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    // the intermediates of the block are held by the scratchpad
+    const size_t scratchpad_size = cp.get_scratchpad_size();
+    ASSERT_GT(scratchpad_size, 0U);
+    std::vector<char> scratchpad(scratchpad_size);
+
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    std::vector<std::vector<float>> inputs_data;
+    std::vector<std::vector<float>> outputs_data, ref_outputs_data;
+    std::vector<test_tensor> inputs_ts, outputs_ts, ref_outputs_ts;
+
+    for (auto &lt : inputs) {
+        inputs_data.emplace_back(
+                std::vector<float>(utils::product(ltw(lt).vdims())));
+        fill_data(inputs_data.back(), ltw(lt).data_type());
+        inputs_ts.emplace_back(*lt, eng, inputs_data.back());
+    }
+
+    for (auto &lt : outputs) {
+        graph::logical_tensor_t compiled_output;
+        cp.query_logical_tensor(lt->id, &compiled_output);
+        const std::vector<int64_t> dims = ltw(compiled_output).vdims();
+        auto size = utils::product(dims);
+        outputs_data.emplace_back(std::vector<float>(size));
+        outputs_ts.emplace_back(compiled_output, eng, outputs_data.back());
+        ref_outputs_data.emplace_back(std::vector<float>(size));
+        ref_outputs_ts.emplace_back(
+                compiled_output, eng, ref_outputs_data.back());
+    }
+
+    ASSERT_EQ(cp.execute(strm, test_tensor::to_graph_tensor(inputs_ts),
+                      test_tensor::to_graph_tensor(ref_outputs_ts)),
+            graph::status::success);
+    strm->wait();
+
+    // execute twice to make sure the scratchpad can be reused
+    for (int i = 0; i < 2; i++) {
+        ASSERT_EQ(cp.execute_with_scratchpad(strm,
+                          test_tensor::to_graph_tensor(inputs_ts),
+                          test_tensor::to_graph_tensor(outputs_ts),
+                          scratchpad.data()),
+                graph::status::success);
+        strm->wait();
+
+        ASSERT_TRUE(allclose<float>(outputs_ts[0], ref_outputs_ts[0],
+                /*rtol*/ 1e-5f, /*atol*/ 1e-5f));
+    }
+}
+
+TEST(test_large_partition_execute, F32Resnet50Stage2BlockDepthFirst) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - depth-first execution is CPU only.");
+
+    utils::id_generator id_gen;
+    graph::graph_t g(eng->kind());
+    utils::construct_f32_resnet50_stage2_block(
+            &g, id_gen, 3, /* use biasadd */ true);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("f32_resnet50_stage_2_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = std::dynamic_pointer_cast<
+            graph::dnnl_impl::dnnl_partition_impl_t>(g.get_partitions()[0]);
+    ASSERT_TRUE(part);
+
+    // compile the partition with batch size 3, so it will be executed as a tile
+    // of 2 samples and a tail tile of 1 sample
+    const int64_t batch = 3;
+    std::vector<graph::logical_tensor_t> inputs = part->get_inputs();
+    std::vector<graph::logical_tensor_t> outputs = part->get_outputs();
+    for (auto &lt : inputs) {
+        if (lt.ndims == 4 && lt.dims[0] == 1) lt.dims[0] = batch;
+    }
+    for (auto &lt : outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+    }
+    std::vector<graph::logical_tensor_t> ref_inputs = inputs;
+    std::vector<graph::logical_tensor_t> ref_outputs = outputs;
+
+    // The kernels are used directly to check whether they are tiled. Each of
+    // them is compiled on a copy of the partition, since the compilation
+    // transforms the partition.
+    auto ref_part = std::dynamic_pointer_cast<
+            graph::dnnl_impl::dnnl_partition_impl_t>(part->clone());
+    graph::dnnl_impl::depth_first_kernel_t kernel, ref_kernel;
+    graph::status_t ref_ret
+            = ref_kernel.compile(ref_part.get(), eng, ref_inputs, ref_outputs);
+    custom_setenv("_ONEDNN_ENABLE_DEPTH_FIRST", "2", 1);
+    graph::status_t ret = kernel.compile(part.get(), eng, inputs, outputs);
+    custom_setenv("_ONEDNN_ENABLE_DEPTH_FIRST", "0", 1);
+    ASSERT_EQ(ref_ret, graph::status::success);
+    ASSERT_EQ(ret, graph::status::success);
+
+    // the tiling is disabled by default
+    ASSERT_FALSE(ref_kernel.is_tiled());
+    ASSERT_TRUE(kernel.is_tiled());
+    ASSERT_EQ(kernel.get_tile_size(), 2);
+
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<std::vector<float>> inputs_data;
+    std::vector<std::vector<float>> outputs_data, ref_outputs_data;
+    std::vector<test_tensor> inputs_ts, outputs_ts, ref_outputs_ts;
+
+    for (auto &lt : inputs) {
+        inputs_data.emplace_back(
+                std::vector<float>(utils::product(ltw(lt).vdims())));
+        std::generate(inputs_data.back().begin(), inputs_data.back().end(),
+                [&]() { return distribution(generator); });
+        inputs_ts.emplace_back(lt, eng, inputs_data.back());
+    }
+
+    for (auto &lt : outputs) {
+        const std::vector<int64_t> dims = ltw(lt).vdims();
+        ASSERT_EQ(dims[0], batch);
+        auto size = utils::product(dims);
+        outputs_data.emplace_back(std::vector<float>(size));
+        outputs_ts.emplace_back(lt, eng, outputs_data.back());
+        ref_outputs_data.emplace_back(std::vector<float>(size));
+        ref_outputs_ts.emplace_back(lt, eng, ref_outputs_data.back());
+    }
+
+    ASSERT_EQ(ref_kernel.execute(strm, test_tensor::to_graph_tensor(inputs_ts),
+                      test_tensor::to_graph_tensor(ref_outputs_ts)),
+            graph::status::success);
+    ASSERT_EQ(kernel.execute(strm, test_tensor::to_graph_tensor(inputs_ts),
+                      test_tensor::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    strm->wait();
+
+    ASSERT_TRUE(
+            allclose<float>(outputs_ts[0], ref_outputs_ts[0], /*rtol*/ 1e-5f,
+                    /*atol*/ 1e-5f));
+}
+
 TEST(test_large_partition_execute, ItexInt8Resnet50Stage2Block) {
     graph::engine_t *eng = get_engine();
     graph::stream_t *strm = get_stream();
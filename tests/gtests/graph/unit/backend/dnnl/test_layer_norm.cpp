@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
 #include <random>
 #include "gtest/gtest.h"
 
@@ -230,6 +231,73 @@ TEST(test_layer_norm_execute, LayernormInferenceWithoutScaleShift) {
     }
 }
 
+TEST(test_layer_norm_execute, RMSNormInference) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet");
+
+    std::vector<float> src {2.0, 4.0, 3.0, 5.5, 5.0, 4.0, 1.0, 2.5};
+    std::vector<float> gamma {2.0, 0.5};
+    std::vector<float> dst(src.size(), 0.0);
+    const float epsilon = 1e-5f;
+
+    std::vector<float> ref_dst(src.size(), 0.0);
+    for (size_t i = 0; i < src.size(); i += gamma.size()) {
+        float ms = 0.f;
+        for (size_t c = 0; c < gamma.size(); ++c)
+            ms += src[i + c] * src[i + c];
+        ms /= gamma.size();
+        for (size_t c = 0; c < gamma.size(); ++c)
+            ref_dst[i + c] = gamma[c] * src[i + c] / std::sqrt(ms + epsilon);
+    }
+
+    graph::op_t rms_norm_op(graph::op_kind::RMSNorm);
+    rms_norm_op.set_attr<float>(graph::op_attr::epsilon, epsilon);
+
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {2, 2, 2}, graph::data_type::f32);
+    graph::logical_tensor_t gamma_lt
+            = utils::logical_tensor_init(1, {2}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt
+            = utils::logical_tensor_init(2, {2, 2, 2}, graph::data_type::f32);
+
+    rms_norm_op.add_input(src_lt);
+    rms_norm_op.add_input(gamma_lt);
+    rms_norm_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    ASSERT_EQ(g.add_op(&rms_norm_op), graph::status::success);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass
+            = get_pass("rms_norm_post_ops_fusion_cpu");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src_lt, &gamma_lt};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, engine), graph::status::success);
+
+    test_tensor src_ts(src_lt, engine, src);
+    test_tensor gamma_ts(gamma_lt, engine, gamma);
+    test_tensor dst_ts(dst_lt, engine, dst);
+
+    cp.execute(strm, {src_ts.get(), gamma_ts.get()}, {dst_ts.get()});
+    strm->wait();
+    dst = dst_ts.as_vec_type<float>();
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-5f);
+    }
+}
+
 TEST(test_layer_norm_execute, LayerNormBackwardFp32) {
     using dims = graph::dnnl_impl::dims;
 
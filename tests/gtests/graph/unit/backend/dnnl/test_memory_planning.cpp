@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2022-2023 Intel Corporation
+* Copyright 2022-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 #include <memory>
+#include <vector>
 
 #include "interface/c_types_map.hpp"
 
@@ -37,3 +38,55 @@ TEST(test_memory_planning_memory_planning, GetMemoryInfo) {
     graph::value_t val {op, 0, lt};
     ASSERT_NO_THROW(mp.get_memory_info(&val));
 }
+
+namespace {
+// Checks that the buffers live at the same time don't overlap and returns the
+// total size of the packing.
+size_t check_packing(
+        const std::vector<dnnl_impl::buffer_packer_t::buffer_t> &buffers,
+        const std::vector<size_t> &offsets) {
+    size_t total = 0;
+    for (size_t i = 0; i < buffers.size(); i++) {
+        total = std::max(total, offsets[i] + buffers[i].size_);
+        for (size_t j = 0; j < i; j++) {
+            const auto &a = buffers[i], &b = buffers[j];
+            if (a.end_ < b.start_ || b.end_ < a.start_) continue;
+            EXPECT_TRUE(offsets[i] + a.size_ <= offsets[j]
+                    || offsets[j] + b.size_ <= offsets[i])
+                    << "buffers " << i << " and " << j << " overlap";
+        }
+    }
+    return total;
+}
+} // namespace
+
+TEST(test_memory_planning_memory_planning, PackBuffersGreedyBySize) {
+    using packer_t = dnnl_impl::buffer_packer_t;
+    // {size, first live step, last live step}
+    const std::vector<packer_t::buffer_t> buffers {{64, 0, 1}, {128, 1, 2},
+            {64, 2, 3}, {128, 3, 4}, {256, 5, 5}, {64, 5, 6}};
+    ASSERT_EQ(packer_t::lower_bound(buffers), 320U);
+
+    std::vector<size_t> offsets;
+    const size_t total = packer_t::pack_greedy_by_size(buffers, offsets);
+    ASSERT_EQ(offsets.size(), buffers.size());
+    ASSERT_EQ(check_packing(buffers, offsets), total);
+    ASSERT_EQ(total, 320U);
+}
+
+TEST(test_memory_planning_memory_planning, PackBuffersExhaustive) {
+    using packer_t = dnnl_impl::buffer_packer_t;
+    std::vector<packer_t::buffer_t> buffers;
+    for (size_t i = 0; i < 8; i++)
+        buffers.push_back({64 * (1 + (i * 5) % 7), i, i + 1 + i % 3});
+    const size_t bound = packer_t::lower_bound(buffers);
+
+    std::vector<size_t> greedy_offsets, offsets;
+    const size_t greedy_total
+            = packer_t::pack_greedy_by_size(buffers, greedy_offsets);
+    const size_t total = packer_t::pack_exhaustive(buffers, offsets);
+    ASSERT_EQ(check_packing(buffers, greedy_offsets), greedy_total);
+    ASSERT_EQ(check_packing(buffers, offsets), total);
+    ASSERT_GE(total, bound);
+    ASSERT_LE(total, greedy_total);
+}
@@ -0,0 +1,339 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+namespace {
+
+// Applies RoPE to the rows of `D` elements of src, the position of a row is
+// its index modulo `S`.
+std::vector<float> ref_rope(const std::vector<float> &src,
+        const std::vector<float> &cos, const std::vector<float> &sin,
+        size_t S, size_t D, bool interleaved) {
+    std::vector<float> dst(src.size());
+    for (size_t r = 0; r < src.size() / D; r++) {
+        const size_t s = r % S;
+        for (size_t i = 0; i < D / 2; i++) {
+            const size_t i0 = interleaved ? 2 * i : i;
+            const size_t i1 = interleaved ? 2 * i + 1 : i + D / 2;
+            const float c = cos[s * D / 2 + i];
+            const float sn = sin[s * D / 2 + i];
+            const float x0 = src[r * D + i0];
+            const float x1 = src[r * D + i1];
+            dst[r * D + i0] = x0 * c - x1 * sn;
+            dst[r * D + i1] = x1 * c + x0 * sn;
+        }
+    }
+    return dst;
+}
+
+void fill_tables(std::vector<float> &cos, std::vector<float> &sin, size_t S,
+        size_t D) {
+    cos.resize(S * D / 2);
+    sin.resize(S * D / 2);
+    for (size_t s = 0; s < S; s++)
+        for (size_t i = 0; i < D / 2; i++) {
+            const float angle = s * std::pow(10000.f, -2.f * i / D);
+            cos[s * D / 2 + i] = std::cos(angle);
+            sin[s * D / 2 + i] = std::sin(angle);
+        }
+}
+
+} // namespace
+
+TEST(test_rope_execute, RoPE) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet");
+
+    const size_t B = 2, S = 3, D = 8;
+    std::vector<float> src(B * S * D);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = 0.25f * (i % 13) - 1.5f;
+    std::vector<float> cos, sin;
+    fill_tables(cos, sin, S, D);
+
+    for (const std::string mode : {"half_split", "interleaved"}) {
+        const auto ref_dst
+                = ref_rope(src, cos, sin, S, D, mode == "interleaved");
+        std::vector<float> dst(src.size(), 0.f);
+
+        graph::op_t rope_op(graph::op_kind::RoPE);
+        rope_op.set_attr<std::string>(graph::op_attr::mode, mode);
+
+        graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+                0, {2, 3, 8}, graph::data_type::f32);
+        graph::logical_tensor_t cos_lt
+                = utils::logical_tensor_init(1, {3, 4}, graph::data_type::f32);
+        graph::logical_tensor_t sin_lt
+                = utils::logical_tensor_init(2, {3, 4}, graph::data_type::f32);
+        graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+                3, {2, 3, 8}, graph::data_type::f32);
+
+        rope_op.add_input(src_lt);
+        rope_op.add_input(cos_lt);
+        rope_op.add_input(sin_lt);
+        rope_op.add_output(dst_lt);
+
+        graph::graph_t g(engine->kind());
+        ASSERT_EQ(g.add_op(&rope_op), graph::status::success);
+        g.finalize();
+
+        graph::pass::pass_base_ptr apass = get_pass("rope_pass");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+        auto part = g.get_partitions()[0];
+
+        // compile
+        graph::partition_t p;
+        p.init(part);
+        graph::compiled_partition_t cp(p);
+
+        std::vector<const graph::logical_tensor_t *> inputs {
+                &src_lt, &cos_lt, &sin_lt};
+        std::vector<const graph::logical_tensor_t *> outputs {&dst_lt};
+
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, engine),
+                graph::status::success);
+
+        test_tensor src_ts(src_lt, engine, src);
+        test_tensor cos_ts(cos_lt, engine, cos);
+        test_tensor sin_ts(sin_lt, engine, sin);
+        test_tensor dst_ts(dst_lt, engine, dst);
+
+        cp.execute(strm, {src_ts.get(), cos_ts.get(), sin_ts.get()},
+                {dst_ts.get()});
+        strm->wait();
+        dst = dst_ts.as_vec_type<float>();
+        for (size_t i = 0; i < ref_dst.size(); ++i) {
+            ASSERT_NEAR(dst[i], ref_dst[i], 1e-5f);
+        }
+    }
+}
+
+TEST(test_rope_execute, SdpWithRoPE) {
+    /*
+      [query]  [cos/sin]  [key]
+          |     /    \     |
+         RoPE          RoPE
+             \        /
+               MatMul
+                 |
+               Divide
+                 |
+              SoftMax   [value]
+                   \     /
+                    MatMul
+                      |
+               StaticTranspose
+                      |
+                StaticReshape
+    */
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet");
+
+    const size_t H = 2, S = 4, D = 8;
+    const graph::dims qkv_shape {1, 2, 4, 8};
+    const graph::dims score_shape {1, 2, 4, 4};
+
+    std::vector<float> query(H * S * D), key(H * S * D), value(H * S * D);
+    for (size_t i = 0; i < query.size(); i++) {
+        query[i] = 0.125f * (i % 11) - 0.5f;
+        key[i] = 0.25f * (i % 7) - 0.75f;
+        value[i] = 0.5f * (i % 5) - 1.f;
+    }
+    std::vector<float> cos, sin;
+    fill_tables(cos, sin, S, D);
+    std::vector<float> scale {std::sqrt(static_cast<float>(D))};
+
+    // reference
+    const auto rq = ref_rope(query, cos, sin, S, D, false);
+    const auto rk = ref_rope(key, cos, sin, S, D, false);
+    std::vector<float> ref_dst(S * H * D, 0.f);
+    for (size_t h = 0; h < H; h++)
+        for (size_t i = 0; i < S; i++) {
+            std::vector<float> score(S);
+            float max_score = -INFINITY;
+            for (size_t j = 0; j < S; j++) {
+                float acc = 0.f;
+                for (size_t d = 0; d < D; d++)
+                    acc += rq[(h * S + i) * D + d] * rk[(h * S + j) * D + d];
+                score[j] = acc / scale[0];
+                max_score = std::max(max_score, score[j]);
+            }
+            float sum = 0.f;
+            for (size_t j = 0; j < S; j++) {
+                score[j] = std::exp(score[j] - max_score);
+                sum += score[j];
+            }
+            // the output is transposed to (S, H, D)
+            for (size_t d = 0; d < D; d++) {
+                float acc = 0.f;
+                for (size_t j = 0; j < S; j++)
+                    acc += score[j] / sum * value[(h * S + j) * D + d];
+                ref_dst[(i * H + h) * D + d] = acc;
+            }
+        }
+
+    auto q_lt = utils::logical_tensor_init(0, qkv_shape, graph::data_type::f32);
+    auto k_lt = utils::logical_tensor_init(1, qkv_shape, graph::data_type::f32);
+    auto cos_lt = utils::logical_tensor_init(2, {4, 4}, graph::data_type::f32);
+    auto sin_lt = utils::logical_tensor_init(3, {4, 4}, graph::data_type::f32);
+    auto rq_lt
+            = utils::logical_tensor_init(4, qkv_shape, graph::data_type::f32);
+    auto rk_lt
+            = utils::logical_tensor_init(5, qkv_shape, graph::data_type::f32);
+    auto score_lt
+            = utils::logical_tensor_init(6, score_shape, graph::data_type::f32);
+    auto scale_lt = utils::logical_tensor_init(7, {1}, graph::data_type::f32);
+    auto scaled_lt
+            = utils::logical_tensor_init(8, score_shape, graph::data_type::f32);
+    auto prob_lt
+            = utils::logical_tensor_init(9, score_shape, graph::data_type::f32);
+    auto v_lt
+            = utils::logical_tensor_init(10, qkv_shape, graph::data_type::f32);
+    auto ctx_lt
+            = utils::logical_tensor_init(11, qkv_shape, graph::data_type::f32);
+    auto trans_lt = utils::logical_tensor_init(
+            12, {1, 4, 2, 8}, graph::data_type::f32);
+    auto dst_lt
+            = utils::logical_tensor_init(13, {1, 4, 16}, graph::data_type::f32);
+
+    graph::op_t rope_q(0, graph::op_kind::RoPE, "rope_q");
+    rope_q.add_input(q_lt);
+    rope_q.add_input(cos_lt);
+    rope_q.add_input(sin_lt);
+    rope_q.add_output(rq_lt);
+
+    graph::op_t rope_k(1, graph::op_kind::RoPE, "rope_k");
+    rope_k.add_input(k_lt);
+    rope_k.add_input(cos_lt);
+    rope_k.add_input(sin_lt);
+    rope_k.add_output(rk_lt);
+
+    graph::op_t matmul_qk(2, graph::op_kind::MatMul, "matmul_qk");
+    matmul_qk.set_attr<bool>(graph::op_attr::transpose_b, true);
+    matmul_qk.add_input(rq_lt);
+    matmul_qk.add_input(rk_lt);
+    matmul_qk.add_output(score_lt);
+
+    graph::op_t div(3, graph::op_kind::Divide, "div");
+    div.add_input(score_lt);
+    div.add_input(scale_lt);
+    div.add_output(scaled_lt);
+
+    graph::op_t softmax(4, graph::op_kind::SoftMax, "softmax");
+    softmax.set_attr<int64_t>(graph::op_attr::axis, -1);
+    softmax.add_input(scaled_lt);
+    softmax.add_output(prob_lt);
+
+    graph::op_t matmul_v(5, graph::op_kind::MatMul, "matmul_v");
+    matmul_v.add_input(prob_lt);
+    matmul_v.add_input(v_lt);
+    matmul_v.add_output(ctx_lt);
+
+    graph::op_t transpose(6, graph::op_kind::StaticTranspose, "transpose");
+    transpose.set_attr<std::vector<int64_t>>(
+            graph::op_attr::order, {0, 2, 1, 3});
+    transpose.add_input(ctx_lt);
+    transpose.add_output(trans_lt);
+
+    graph::op_t reshape(7, graph::op_kind::StaticReshape, "reshape");
+    reshape.set_attr<std::vector<int64_t>>(graph::op_attr::shape, {1, 4, 16});
+    reshape.set_attr<bool>(graph::op_attr::special_zero, false);
+    reshape.add_input(trans_lt);
+    reshape.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    for (auto *op : {&rope_q, &rope_k, &matmul_qk, &div, &softmax, &matmul_v,
+                 &transpose, &reshape})
+        ASSERT_EQ(g.add_op(op), graph::status::success);
+    g.finalize();
+
+    // RoPE is not fused into the SDP partition, so the attention is still
+    // executed by the dedicated SDP kernel.
+    run_all_passes(g);
+    ASSERT_EQ(g.get_num_partitions(), 3U);
+
+    // the RoPE partitions produce the inputs of the SDP partition
+    auto parts = g.get_partitions();
+    std::stable_sort(parts.begin(), parts.end(),
+            [](const std::shared_ptr<graph::partition_impl_t> &a,
+                    const std::shared_ptr<graph::partition_impl_t> &b) {
+                return a->get_kind() != graph::partition_kind_t::sdp
+                        && b->get_kind() == graph::partition_kind_t::sdp;
+            });
+    ASSERT_EQ(parts.back()->get_kind(), graph::partition_kind_t::sdp);
+    ASSERT_EQ(parts.back()->get_ops().size(), 6U);
+
+    // the data of the graph inputs and the intermediate tensors by id
+    std::unordered_map<size_t, std::vector<float>> data {{0, query}, {1, key},
+            {2, cos}, {3, sin}, {7, scale}, {10, value}};
+    for (const auto &part : parts) {
+        graph::partition_t p;
+        p.init(part);
+        graph::compiled_partition_t cp(p);
+
+        std::vector<const graph::logical_tensor_t *> inputs, outputs;
+        for (const auto &lt : part->get_inputs())
+            inputs.push_back(&lt);
+        for (const auto &lt : part->get_outputs())
+            outputs.push_back(&lt);
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, engine),
+                graph::status::success);
+
+        std::vector<test_tensor> input_ts, output_ts;
+        std::vector<graph::tensor_t> input_tensors, output_tensors;
+        for (const auto &lt : part->get_inputs())
+            input_ts.emplace_back(lt, engine, data.at(lt.id));
+        for (const auto &lt : part->get_outputs())
+            output_ts.emplace_back(lt, engine);
+        for (auto &ts : input_ts)
+            input_tensors.push_back(ts.get());
+        for (auto &ts : output_ts)
+            output_tensors.push_back(ts.get());
+
+        ASSERT_EQ(cp.execute(strm, input_tensors, output_tensors),
+                graph::status::success);
+        strm->wait();
+        for (size_t i = 0; i < output_ts.size(); i++)
+            data[part->get_outputs()[i].id]
+                    = output_ts[i].as_vec_type<float>();
+    }
+
+    const auto &dst = data.at(dst_lt.id);
+    ASSERT_EQ(dst.size(), ref_dst.size());
+    for (size_t i = 0; i < ref_dst.size(); ++i) {
+        ASSERT_NEAR(dst[i], ref_dst[i], 1e-4f);
+    }
+}
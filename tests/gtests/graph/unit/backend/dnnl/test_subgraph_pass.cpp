@@ -47,6 +47,14 @@ namespace graph = dnnl::impl::graph;
 using op_ptr = std::shared_ptr<dnnl::impl::graph::op_t>;
 
 namespace {
+inline void custom_setenv(const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    SetEnvironmentVariable(name, value);
+#else
+    ::setenv(name, value, overwrite);
+#endif
+}
+
 dnnl::impl::graph::pass::pass_base_ptr get_pass(const std::string &pass_name) {
     auto &backend_ptr
             = dnnl::impl::graph::dnnl_impl::dnnl_backend::get_singleton();
@@ -1300,6 +1308,178 @@ TEST(test_subgraph_pass_subgraph_pass, MemoryPlanning) {
     ASSERT_TRUE(mem_offkeys.empty());
 }
 
+TEST(test_subgraph_pass_subgraph_pass, MemoryPlanningConcatInputsInOutput) {
+    /*
+    dnnl_reorder   dnnl_reorder
+             \     /
+           dnnl_concat
+                |
+           dnnl_reorder
+    */
+    graph::engine_t *g_eng = get_engine();
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+
+    std::vector<int64_t> in_shape {2, 8};
+    std::vector<int64_t> out_shape {4, 8};
+
+    graph::op_t op1(1, dnnl_impl::op_kind::dnnl_reorder, "op1");
+    graph::op_t op2(2, dnnl_impl::op_kind::dnnl_reorder, "op2");
+    graph::op_t op3(3, dnnl_impl::op_kind::dnnl_concat, "op3");
+    graph::op_t op4(4, dnnl_impl::op_kind::dnnl_reorder, "op4");
+    op3.set_attr<int64_t>(op_attr::axis, 0);
+
+    logical_tensor_t val0
+            = logical_tensor_init(0, in_shape, graph::data_type::f32);
+    logical_tensor_t val1
+            = logical_tensor_init(1, in_shape, graph::data_type::f32);
+    logical_tensor_t val2
+            = logical_tensor_init(2, in_shape, graph::data_type::f32);
+    logical_tensor_t val3
+            = logical_tensor_init(3, in_shape, graph::data_type::f32);
+    logical_tensor_t val4
+            = logical_tensor_init(4, out_shape, graph::data_type::f32);
+    // the last reorder converts the data type, so it can't be inplaced
+    logical_tensor_t val5
+            = logical_tensor_init(5, out_shape, graph::data_type::bf16);
+    logical_tensor_t scratchpad
+            = logical_tensor_init(6, {0}, graph::data_type::u8);
+
+    op1.add_input(val0);
+    op1.add_output(val2);
+    op2.add_input(val1);
+    op2.add_output(val3);
+    op3.add_input(val2);
+    op3.add_input(val3);
+    op3.add_output(val4);
+    op3.add_output(scratchpad);
+    op4.add_input(val4);
+    op4.add_output(val5);
+
+    graph::graph_t g;
+    ASSERT_EQ(g.add_op(&op1), graph::status::success);
+    ASSERT_EQ(g.add_op(&op2), graph::status::success);
+    ASSERT_EQ(g.add_op(&op3), graph::status::success);
+    ASSERT_EQ(g.add_op(&op4), graph::status::success);
+    g.finalize();
+
+    auto subgraph = std::make_shared<dnnl_impl::subgraph_t>(g.get_ops(), p_eng,
+            fpmath_mode::strict, false, /* reset_layout */ false);
+
+    std::vector<logical_tensor_t> inputs = {val0, val1};
+    std::vector<logical_tensor_t> outputs = {val5};
+    dnnl_impl::set_given_inputs_outputs(subgraph, inputs, outputs);
+
+    dnnl_impl::memory_planner_t memory_planner;
+    ASSERT_EQ(memory_planner.run(subgraph), graph::status::success);
+
+    std::vector<char> buffer(memory_planner.total_internal_temporary_size());
+    auto grantor = memory_planner.internal_temporary_grantor(buffer.data());
+    auto &args_set = memory_planner.get_exec_args_set();
+    auto get_handle = [&](const dnnl::memory &mem) -> char * {
+        for (auto &mem_offkey : args_set.get_mems_use_internal_temporary()) {
+            if (mem_offkey.first == mem) return grantor.get(mem_offkey.second);
+        }
+        return nullptr;
+    };
+
+    std::vector<graph::op_t *> topo_ordered_ops;
+    dnnl::impl::graph::topo_order_visit(
+            subgraph->get_output_ops(), [&](graph::op_t *op) {
+                topo_ordered_ops.emplace_back(op);
+                return status::success;
+            });
+    auto topo_ordered_args = args_set.get_exec_args();
+    ASSERT_EQ(topo_ordered_ops.size(), topo_ordered_args.size());
+
+    // the concat inputs are placed in the concat output
+    bool found_concat = false;
+    for (size_t i = 0; i < topo_ordered_ops.size(); i++) {
+        if (topo_ordered_ops[i]->get_kind() != dnnl_impl::op_kind::dnnl_concat)
+            continue;
+        found_concat = true;
+        auto &args = topo_ordered_args[i];
+        char *dst = get_handle(args.at(DNNL_ARG_DST));
+        ASSERT_NE(dst, nullptr);
+        ASSERT_EQ(get_handle(args.at(DNNL_ARG_MULTIPLE_SRC)), dst);
+        ASSERT_EQ(get_handle(args.at(DNNL_ARG_MULTIPLE_SRC + 1)),
+                dst + dnnl_impl::make_dnnl_memory_desc(val2).get_size());
+    }
+    ASSERT_TRUE(found_concat);
+}
+
+TEST(test_subgraph_pass_subgraph_pass, MemoryPlanningInterOpStages) {
+    /*
+    dnnl_reorder   dnnl_reorder   dnnl_reorder (large)
+    */
+    graph::engine_t *g_eng = get_engine();
+    SKIP_IF(g_eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - inter-op parallel execution is CPU only.");
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+
+    std::vector<int64_t> small_shape {8, 8};
+    std::vector<int64_t> large_shape {512, 512};
+
+    graph::op_t op1(1, dnnl_impl::op_kind::dnnl_reorder, "op1");
+    graph::op_t op2(2, dnnl_impl::op_kind::dnnl_reorder, "op2");
+    graph::op_t op3(3, dnnl_impl::op_kind::dnnl_reorder, "op3");
+
+    logical_tensor_t val0
+            = logical_tensor_init(0, small_shape, graph::data_type::f32);
+    logical_tensor_t val1
+            = logical_tensor_init(1, small_shape, graph::data_type::f32);
+    logical_tensor_t val2
+            = logical_tensor_init(2, large_shape, graph::data_type::f32);
+    logical_tensor_t val3
+            = logical_tensor_init(3, small_shape, graph::data_type::bf16);
+    logical_tensor_t val4
+            = logical_tensor_init(4, small_shape, graph::data_type::bf16);
+    logical_tensor_t val5
+            = logical_tensor_init(5, large_shape, graph::data_type::bf16);
+
+    op1.add_input(val0);
+    op1.add_output(val3);
+    op2.add_input(val1);
+    op2.add_output(val4);
+    op3.add_input(val2);
+    op3.add_output(val5);
+
+    graph::graph_t g;
+    ASSERT_EQ(g.add_op(&op1), graph::status::success);
+    ASSERT_EQ(g.add_op(&op2), graph::status::success);
+    ASSERT_EQ(g.add_op(&op3), graph::status::success);
+    g.finalize();
+
+    auto subgraph = std::make_shared<dnnl_impl::subgraph_t>(g.get_ops(), p_eng,
+            fpmath_mode::strict, false, /* reset_layout */ false);
+
+    std::vector<logical_tensor_t> inputs = {val0, val1, val2};
+    std::vector<logical_tensor_t> outputs = {val3, val4, val5};
+    dnnl_impl::set_given_inputs_outputs(subgraph, inputs, outputs);
+
+    dnnl_impl::memory_planner_t memory_planner;
+    custom_setenv("_ONEDNN_ENABLE_INTER_OP_PARALLEL", "1", 1);
+    graph::status_t ret = memory_planner.run(subgraph);
+    custom_setenv("_ONEDNN_ENABLE_INTER_OP_PARALLEL", "0", 1);
+    ASSERT_EQ(ret, graph::status::success);
+
+    // the small ops share a stage, and the large one gets its own stage
+    std::vector<graph::op_t *> topo_ordered_ops;
+    dnnl::impl::graph::topo_order_visit(
+            subgraph->get_output_ops(), [&](graph::op_t *op) {
+                topo_ordered_ops.emplace_back(op);
+                return status::success;
+            });
+    const auto &stages = memory_planner.get_exec_stages();
+    ASSERT_EQ(stages.size(), 2U);
+    for (const auto &stage : stages) {
+        const bool has_large = std::any_of(
+                stage.begin(), stage.end(), [&](size_t i) {
+                    return topo_ordered_ops[i]->get_name() == "op3";
+                });
+        ASSERT_EQ(stage.size(), has_large ? 1U : 2U);
+    }
+}
+
 TEST(test_subgraph_pass_subgraph_pass, FusePostOpsForConvDepthwise_CPU) {
     /*   conv
           |
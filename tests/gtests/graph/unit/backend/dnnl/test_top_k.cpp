@@ -0,0 +1,156 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+
+namespace {
+
+// Selects the `K` best elements along the middle dimension of src of shape
+// {M, N, I}, the equal elements are ordered by their positions.
+void ref_top_k(const std::vector<float> &src, size_t M, size_t N, size_t I,
+        size_t K, bool is_max, std::vector<float> &dst,
+        std::vector<int32_t> &indices) {
+    dst.resize(M * K * I);
+    indices.resize(M * K * I);
+    std::vector<std::pair<float, int32_t>> row(N);
+    for (size_t m = 0; m < M; m++)
+        for (size_t i = 0; i < I; i++) {
+            for (size_t n = 0; n < N; n++)
+                row[n] = {src[(m * N + n) * I + i], static_cast<int32_t>(n)};
+            std::stable_sort(row.begin(), row.end(),
+                    [&](const std::pair<float, int32_t> &a,
+                            const std::pair<float, int32_t> &b) {
+                        return is_max ? a.first > b.first : a.first < b.first;
+                    });
+            for (size_t j = 0; j < K; j++) {
+                dst[(m * K + j) * I + i] = row[j].first;
+                indices[(m * K + j) * I + i] = row[j].second;
+            }
+        }
+}
+
+} // namespace
+
+TEST(test_top_k_execute, TopK) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet");
+
+    const size_t M = 2, N = 9, I = 3, K = 4;
+    std::vector<float> src(M * N * I);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = 0.5f * ((i * 7) % 11) - 2.f;
+
+    for (const std::string mode : {"max", "min"}) {
+        std::vector<float> ref_dst;
+        std::vector<int32_t> ref_indices;
+        ref_top_k(src, M, N, I, K, mode == "max", ref_dst, ref_indices);
+        std::vector<float> dst(ref_dst.size(), 0.f);
+        std::vector<int32_t> indices(ref_indices.size(), 0);
+
+        graph::op_t top_k_op(graph::op_kind::TopK);
+        top_k_op.set_attr<int64_t>(graph::op_attr::k, K);
+        top_k_op.set_attr<int64_t>(graph::op_attr::axis, 1);
+        top_k_op.set_attr<std::string>(graph::op_attr::mode, mode);
+
+        graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+                0, {2, 9, 3}, graph::data_type::f32);
+        graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+                1, {2, 4, 3}, graph::data_type::f32);
+        graph::logical_tensor_t indices_lt = utils::logical_tensor_init(
+                2, {2, 4, 3}, graph::data_type::s32);
+
+        top_k_op.add_input(src_lt);
+        top_k_op.add_output(dst_lt);
+        top_k_op.add_output(indices_lt);
+
+        graph::graph_t g(engine->kind());
+        ASSERT_EQ(g.add_op(&top_k_op), graph::status::success);
+        g.finalize();
+
+        graph::pass::pass_base_ptr apass = get_pass("top_k_pass");
+        apass->run(g);
+        ASSERT_EQ(g.get_num_partitions(), 1U);
+        auto part = g.get_partitions()[0];
+
+        // compile
+        graph::partition_t p;
+        p.init(part);
+        graph::compiled_partition_t cp(p);
+
+        std::vector<const graph::logical_tensor_t *> inputs {&src_lt};
+        std::vector<const graph::logical_tensor_t *> outputs {
+                &dst_lt, &indices_lt};
+
+        ASSERT_EQ(p.compile(&cp, inputs, outputs, engine),
+                graph::status::success);
+
+        test_tensor src_ts(src_lt, engine, src);
+        test_tensor dst_ts(dst_lt, engine, dst);
+        test_tensor indices_ts(indices_lt, engine, indices);
+
+        cp.execute(strm, {src_ts.get()}, {dst_ts.get(), indices_ts.get()});
+        strm->wait();
+        dst = dst_ts.as_vec_type<float>();
+        indices = indices_ts.as_vec_type<int32_t>();
+        for (size_t i = 0; i < ref_dst.size(); ++i) {
+            ASSERT_EQ(dst[i], ref_dst[i]);
+            ASSERT_EQ(indices[i], ref_indices[i]);
+        }
+    }
+}
+
+TEST(test_top_k_compile, InvalidK) {
+    graph::engine_t *engine = get_engine();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet");
+
+    graph::op_t top_k_op(graph::op_kind::TopK);
+    top_k_op.set_attr<int64_t>(graph::op_attr::k, 10);
+
+    graph::logical_tensor_t src_lt
+            = utils::logical_tensor_init(0, {2, 9}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt = utils::logical_tensor_init(
+            1, graph::data_type::f32, graph::layout_type::strided);
+    graph::logical_tensor_t indices_lt = utils::logical_tensor_init(
+            2, graph::data_type::s32, graph::layout_type::strided);
+
+    top_k_op.add_input(src_lt);
+    top_k_op.add_output(dst_lt);
+    top_k_op.add_output(indices_lt);
+
+    // k is larger than the size of the axis.
+    std::vector<graph::logical_tensor_t *> inputs {&src_lt};
+    std::vector<graph::logical_tensor_t *> outputs {&dst_lt, &indices_lt};
+    const auto *opm = graph::op_schema_registry_t::get_op_schema(
+            graph::op_kind::TopK);
+    ASSERT_NE(opm, nullptr);
+    ASSERT_EQ(opm->shape_infer(&top_k_op, inputs, outputs),
+            graph::status::invalid_shape);
+}
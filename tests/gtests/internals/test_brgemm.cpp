@@ -24,6 +24,7 @@
 #include "oneapi/dnnl/dnnl.hpp"
 #include "tests/test_isa_common.hpp"
 
+#include "common/kernel_cache.hpp"
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
 
@@ -270,4 +271,38 @@ TEST_P(brgemm_test_t, TestsBRGEMM) {}
 INSTANTIATE_TEST_SUITE_P(TestBRGEMMSimple, brgemm_test_t,
         ::testing::ValuesIn(params_creator_t().create_simple_brgemm_params()));
 
+// The brgemm kernels are shared through the kernel cache by the primitives
+// which only differ in the attributes the kernels don't depend on.
+TEST(brgemm_kernel_cache_test, TestSharedAcrossAttributes) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Brgemm requires cpu.");
+    engine eng(engine::kind::cpu, 0);
+    const auto get_kernel_cache_size = []() {
+        int size = 0;
+        EXPECT_EQ(impl::get_kernel_cache_size(&size), impl::status::success);
+        return size;
+    };
+
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+    const memory::desc src_md({64, 96}, dt::f32, tag::ab);
+    const memory::desc wei_md({96, 128}, dt::f32, tag::ab);
+    const memory::desc dst_md({64, 128}, dt::f32, tag::ab);
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    const std::string impl_name = pd.impl_info_str();
+    SKIP_IF(impl_name.find("brg") == std::string::npos,
+            "Brgemm matmul is not supported.");
+    auto prim = matmul(pd);
+    const int size = get_kernel_cache_size();
+    SKIP_IF(size == 0, "Kernel cache is disabled.");
+
+    primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+    auto pd_attr = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    ASSERT_EQ(impl_name, pd_attr.impl_info_str());
+    auto prim_attr = matmul(pd_attr);
+    ASSERT_EQ(get_kernel_cache_size(), size);
+}
+
 } // namespace dnnl
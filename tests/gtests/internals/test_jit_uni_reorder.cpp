@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "cpu/x64/jit_uni_reorder.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+class jit_uni_reorder_nt_stores_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        cache_capacity_ = get_primitive_cache_capacity();
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "The reorder requires cpu.");
+        engine eng(engine::kind::cpu, 0);
+        const memory::desc src_md({64, 64}, dt::f32, tag::ab);
+        const memory::desc dst_md({64, 64}, dt::bf16, tag::ab);
+        auto pd = reorder::primitive_desc(eng, src_md, eng, dst_md);
+        SKIP_IF(std::string(pd.impl_info_str()) != "jit:uni",
+                "The jit reorder is not supported.");
+
+        // Any output is stored by the non-temporal stores. The decision is
+        // taken at the primitive descriptor creation, so the primitive cache
+        // is disabled not to get the primitives created before.
+        set_primitive_cache_capacity(0);
+        impl::cpu::x64::set_reorder_nt_stores_threshold(1);
+    }
+
+    void TearDown() override {
+        impl::cpu::x64::set_reorder_nt_stores_threshold(0);
+        set_primitive_cache_capacity(cache_capacity_);
+    }
+
+    // Reorders f32 into bf16 stored at `dst_offset` elements past a 64-byte
+    // aligned address and checks the output.
+    void check_reorder(const memory::dims &dims, size_t dst_offset) {
+        engine eng(engine::kind::cpu, 0);
+        stream strm(eng);
+        const memory::desc src_md(dims, dt::f32, tag::ab);
+        const memory::desc dst_md(dims, dt::bf16, tag::ab);
+        auto pd = reorder::primitive_desc(eng, src_md, eng, dst_md);
+
+        const size_t nelems = static_cast<size_t>(dims[0] * dims[1]);
+        memory src(src_md, eng);
+        auto *src_ptr = static_cast<float *>(src.get_data_handle());
+        // the values are exactly representable in bf16
+        for (size_t i = 0; i < nelems; i++)
+            src_ptr[i] = static_cast<float>(i % 256) - 128.f;
+
+        constexpr size_t align = 64;
+        std::vector<uint16_t> buf(nelems + dst_offset + align);
+        const auto addr = reinterpret_cast<uintptr_t>(buf.data());
+        const size_t align_offset
+                = (align - addr % align) % align / sizeof(uint16_t);
+        uint16_t *dst_ptr = buf.data() + align_offset + dst_offset;
+        memory dst(dst_md, eng, dst_ptr);
+
+        reorder(pd).execute(strm, src, dst);
+        strm.wait();
+
+        for (size_t i = 0; i < nelems; i++) {
+            uint32_t bits;
+            std::memcpy(&bits, &src_ptr[i], sizeof(bits));
+            ASSERT_EQ(dst_ptr[i], static_cast<uint16_t>(bits >> 16))
+                    << "at " << i;
+        }
+    }
+
+    int cache_capacity_ = 0;
+};
+
+TEST_F(jit_uni_reorder_nt_stores_test_t, TestAlignedOutput) {
+    check_reorder({64, 1024}, 0);
+}
+
+// the misaligned output falls back to the regular stores
+TEST_F(jit_uni_reorder_nt_stores_test_t, TestMisalignedOutput) {
+    check_reorder({64, 1024}, 1);
+}
+
+// the kernel with a tail uses the regular stores
+TEST_F(jit_uni_reorder_nt_stores_test_t, TestTail) {
+    check_reorder({7, 37}, 0);
+}
+
+} // namespace dnnl
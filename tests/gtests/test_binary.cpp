@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2023 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -279,6 +279,236 @@ INSTANTIATE_TEST_SUITE_P(BinaryTensorDims, binary_attr_test_t,
                         memory::dims {1, 1024, 1, 1},
                         memory::format_tag::abcd)));
 
+struct binary_select_test_t
+    : public ::testing::TestWithParam<
+              std::tuple<memory::dims, memory::dims, memory::dims>> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(binary_select_test_t, TestBinarySelect) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Engine does not support the select algorithm.");
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const auto &dims = std::get<0>(GetParam());
+    const auto &src1_dims = std::get<1>(GetParam());
+    const auto &cond_dims = std::get<2>(GetParam());
+    const int ndims = (int)dims.size();
+
+    const auto plain_md = [&](const memory::dims &adims, data_type dt) {
+        memory::dims strides(ndims, 1);
+        for (int d = ndims - 2; d >= 0; d--)
+            strides[d] = strides[d + 1] * adims[d + 1];
+        return memory::desc(adims, dt, strides);
+    };
+    const auto src0_md = plain_md(dims, data_type::f32);
+    const auto src1_md = plain_md(src1_dims, data_type::f32);
+    const auto cond_md = plain_md(cond_dims, data_type::u8);
+    const auto dst_md = plain_md(dims, data_type::f32);
+
+    // The condition is required by the select algorithm only.
+    EXPECT_ANY_THROW(binary::primitive_desc(
+            eng, algorithm::binary_select, src0_md, src1_md, dst_md));
+    EXPECT_ANY_THROW(binary::primitive_desc(
+            eng, algorithm::binary_add, src0_md, src1_md, cond_md, dst_md));
+    // The select algorithm is not supported as a post-op.
+    post_ops ops;
+    EXPECT_ANY_THROW(ops.append_binary(algorithm::binary_select, src1_md));
+    EXPECT_EQ(ops.len(), 0);
+
+    auto pd = binary::primitive_desc(
+            eng, algorithm::binary_select, src0_md, src1_md, cond_md, dst_md);
+    ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_2) == cond_md);
+    ASSERT_TRUE(pd.src2_desc() == cond_md);
+    auto prim = binary(pd);
+
+    auto mem_src0 = test::make_memory(src0_md, eng);
+    auto mem_src1 = test::make_memory(src1_md, eng);
+    auto mem_cond = test::make_memory(cond_md, eng);
+    auto mem_dst = test::make_memory(dst_md, eng);
+
+    const auto nelems = [](const memory::dims &adims) {
+        memory::dim n = 1;
+        for (auto d : adims)
+            n *= d;
+        return n;
+    };
+    {
+        auto src0 = map_memory<float>(mem_src0);
+        for (memory::dim i = 0; i < nelems(dims); i++)
+            src0[i] = (float)(i % 97);
+        auto src1 = map_memory<float>(mem_src1);
+        for (memory::dim i = 0; i < nelems(src1_dims); i++)
+            src1[i] = -(float)(i % 89) - 1.f;
+        auto cond = map_memory<uint8_t>(mem_cond);
+        for (memory::dim i = 0; i < nelems(cond_dims); i++)
+            cond[i] = (uint8_t)((i * 7) % 3);
+    }
+
+    prim.execute(strm,
+            {{DNNL_ARG_SRC_0, mem_src0}, {DNNL_ARG_SRC_1, mem_src1},
+                    {DNNL_ARG_SRC_2, mem_cond}, {DNNL_ARG_DST, mem_dst}});
+    strm.wait();
+
+    const auto src0 = map_memory<float>(mem_src0);
+    const auto src1 = map_memory<float>(mem_src1);
+    const auto cond = map_memory<uint8_t>(mem_cond);
+    const auto dst = map_memory<float>(mem_dst);
+
+    // Computes the offset of an element of a source broadcast to the dst.
+    const auto bcast_off = [&](const memory::dims &adims, memory::dim i) {
+        memory::dim off = 0, stride = 1;
+        for (int d = ndims - 1; d >= 0; d--) {
+            const memory::dim idx = i % dims[d];
+            i /= dims[d];
+            if (adims[d] != 1) off += idx * stride;
+            stride *= adims[d];
+        }
+        return off;
+    };
+    for (memory::dim i = 0; i < nelems(dims); i++) {
+        const float expected = cond[bcast_off(cond_dims, i)]
+                ? src0[i]
+                : src1[bcast_off(src1_dims, i)];
+        ASSERT_EQ(dst[i], expected) << "element " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(BinarySelect, binary_select_test_t,
+        ::testing::Values(
+                // {dst and src0 dims, src1 dims, condition dims}
+                std::make_tuple(memory::dims {2, 3, 32, 32},
+                        memory::dims {2, 3, 32, 32},
+                        memory::dims {1, 1, 32, 32}),
+                std::make_tuple(memory::dims {4, 64, 48},
+                        memory::dims {1, 1, 1}, memory::dims {4, 64, 48}),
+                std::make_tuple(memory::dims {2, 8, 100},
+                        memory::dims {2, 8, 1}, memory::dims {1, 1, 100}),
+                std::make_tuple(memory::dims {3, 5}, memory::dims {3, 5},
+                        memory::dims {3, 1})));
+
+struct binary_bcast_test_t
+    : public ::testing::TestWithParam<
+              std::tuple<memory::dims, memory::dims, data_type, data_type>> {
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(binary_bcast_test_t, TestBinaryBcast) {
+    const auto &src0_dims = std::get<0>(GetParam());
+    const auto &src1_dims = std::get<1>(GetParam());
+    const auto src_dt = std::get<2>(GetParam());
+    const auto dst_dt = std::get<3>(GetParam());
+    SKIP_IF(unsupported_data_type(src_dt) || unsupported_data_type(dst_dt),
+            "Engine does not support this data type.");
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const int ndims = (int)src0_dims.size();
+    memory::dims dims(ndims);
+    for (int d = 0; d < ndims; d++)
+        dims[d] = std::max(src0_dims[d], src1_dims[d]);
+
+    const auto plain_md = [&](const memory::dims &adims, data_type dt) {
+        memory::dims strides(ndims, 1);
+        for (int d = ndims - 2; d >= 0; d--)
+            strides[d] = strides[d + 1] * adims[d + 1];
+        return memory::desc(adims, dt, strides);
+    };
+    const auto src0_md = plain_md(src0_dims, src_dt);
+    const auto src1_md = plain_md(src1_dims, data_type::f32);
+    const auto dst_md = plain_md(dims, dst_dt);
+
+    auto pd = binary::primitive_desc(
+            eng, algorithm::binary_add, src0_md, src1_md, dst_md);
+    auto prim = binary(pd);
+
+    auto mem_src0 = test::make_memory(src0_md, eng);
+    auto mem_src1 = test::make_memory(src1_md, eng);
+    auto mem_dst = test::make_memory(dst_md, eng);
+
+    const auto nelems = [](const memory::dims &adims) {
+        memory::dim n = 1;
+        for (auto d : adims)
+            n *= d;
+        return n;
+    };
+    // The values are small integers, so they and their sums are exact in
+    // every data type.
+    std::vector<float> src0_vals(nelems(src0_dims));
+    for (size_t i = 0; i < src0_vals.size(); i++)
+        src0_vals[i] = (float)(i % 61);
+    std::vector<float> src1_vals(nelems(src1_dims));
+    for (size_t i = 0; i < src1_vals.size(); i++)
+        src1_vals[i] = -(float)(i % 53);
+    if (src_dt == data_type::bf16) {
+        auto src0 = map_memory<bfloat16_t>(mem_src0);
+        for (size_t i = 0; i < src0_vals.size(); i++)
+            src0[i] = src0_vals[i];
+    } else {
+        auto src0 = map_memory<float>(mem_src0);
+        for (size_t i = 0; i < src0_vals.size(); i++)
+            src0[i] = src0_vals[i];
+    }
+    {
+        auto src1 = map_memory<float>(mem_src1);
+        for (size_t i = 0; i < src1_vals.size(); i++)
+            src1[i] = src1_vals[i];
+    }
+
+    prim.execute(strm,
+            {{DNNL_ARG_SRC_0, mem_src0}, {DNNL_ARG_SRC_1, mem_src1},
+                    {DNNL_ARG_DST, mem_dst}});
+    strm.wait();
+
+    std::vector<float> dst_vals(nelems(dims));
+    if (dst_dt == data_type::bf16) {
+        const auto dst = map_memory<bfloat16_t>(mem_dst);
+        for (size_t i = 0; i < dst_vals.size(); i++)
+            dst_vals[i] = dst[i];
+    } else {
+        const auto dst = map_memory<float>(mem_dst);
+        for (size_t i = 0; i < dst_vals.size(); i++)
+            dst_vals[i] = dst[i];
+    }
+
+    // Computes the offset of an element of a source broadcast to the dst.
+    const auto bcast_off = [&](const memory::dims &adims, memory::dim i) {
+        memory::dim off = 0, stride = 1;
+        for (int d = ndims - 1; d >= 0; d--) {
+            const memory::dim idx = i % dims[d];
+            i /= dims[d];
+            if (adims[d] != 1) off += idx * stride;
+            stride *= adims[d];
+        }
+        return off;
+    };
+    for (memory::dim i = 0; i < nelems(dims); i++) {
+        const float expected = src0_vals[bcast_off(src0_dims, i)]
+                + src1_vals[bcast_off(src1_dims, i)];
+        ASSERT_EQ(dst_vals[i], expected) << "element " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(BinaryBcast, binary_bcast_test_t,
+        ::testing::Values(
+                // {src0 dims, src1 dims, src0 data type, dst data type}
+                std::make_tuple(memory::dims {2, 1, 16, 16},
+                        memory::dims {2, 4, 16, 16}, data_type::f32,
+                        data_type::f32),
+                std::make_tuple(memory::dims {2, 4, 16, 16},
+                        memory::dims {1, 4, 1, 16}, data_type::f32,
+                        data_type::f32),
+                std::make_tuple(memory::dims {2, 4, 8, 35},
+                        memory::dims {2, 4, 8, 1}, data_type::f32,
+                        data_type::f32),
+                std::make_tuple(memory::dims {3, 17, 40},
+                        memory::dims {1, 1, 1}, data_type::bf16,
+                        data_type::f32),
+                std::make_tuple(memory::dims {2, 1, 16, 16},
+                        memory::dims {2, 4, 16, 16}, data_type::bf16,
+                        data_type::f32),
+                std::make_tuple(memory::dims {2, 4, 16, 16},
+                        memory::dims {2, 4, 16, 16}, data_type::f32,
+                        data_type::bf16)));
+
 static auto expected_failures = []() {
     return ::testing::Values(
             // test tag::any support
@@ -0,0 +1,210 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cfloat>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct embedding_bag_test_params_t {
+    algorithm aalgorithm;
+    memory::dim rows;
+    memory::dim dim;
+    std::vector<int32_t> indices;
+    std::vector<int32_t> offsets;
+    bool per_row_scales;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename src_data_t>
+class embedding_bag_test_t
+    : public ::testing::TestWithParam<embedding_bag_test_params_t> {
+private:
+    embedding_bag_test_params_t p;
+    memory::data_type src_dt;
+
+protected:
+    void SetUp() override {
+        src_dt = data_traits<src_data_t>::data_type;
+
+        p = ::testing::TestWithParam<embedding_bag_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(src_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using pd_t = embedding_bag::primitive_desc;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const memory::dim N = p.indices.size();
+        const memory::dim B = p.offsets.size();
+
+        auto desc_src = memory::desc({p.rows, p.dim}, src_dt, tag::ab);
+        auto desc_idx = memory::desc({N}, memory::data_type::s32, tag::a);
+        auto desc_off = memory::desc({B}, memory::data_type::s32, tag::a);
+        auto desc_dst
+                = memory::desc({B, p.dim}, memory::data_type::f32, tag::any);
+
+        primitive_attr attr;
+        if (p.per_row_scales) attr.set_scales_mask(DNNL_ARG_SRC, 1);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        pd = pd_t(eng, p.aalgorithm, desc_src, desc_idx, desc_off, desc_dst,
+                attr);
+
+        EXPECT_ANY_THROW(embedding_bag(pd, {}));
+        // default primitive ctor
+        auto prim = embedding_bag();
+        // regular primitive ctor
+        prim = embedding_bag(pd);
+
+        const auto dst_desc = pd.dst_desc();
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_0)
+                == pd.src_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_1)
+                == pd.indices_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_2)
+                == pd.offsets_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == dst_desc);
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = memory(desc_src, test_engine);
+        auto mem_idx = memory(desc_idx, test_engine);
+        auto mem_off = memory(desc_off, test_engine);
+        auto mem_dst = memory(dst_desc, test_engine);
+        auto mem_scales = memory(
+                {{p.rows}, memory::data_type::f32, tag::a}, test_engine);
+
+        fill_data<src_data_t>(p.rows * p.dim, mem_src);
+        {
+            auto idx = map_memory<int32_t>(mem_idx);
+            auto off = map_memory<int32_t>(mem_off);
+            std::copy(p.indices.begin(), p.indices.end(), &idx[0]);
+            std::copy(p.offsets.begin(), p.offsets.end(), &off[0]);
+            auto scales = map_memory<float>(mem_scales);
+            for (memory::dim r = 0; r < p.rows; r++)
+                scales[r] = 0.5f + r % 3;
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC_0, mem_src},
+                {DNNL_ARG_SRC_1, mem_idx}, {DNNL_ARG_SRC_2, mem_off},
+                {DNNL_ARG_DST, mem_dst}};
+        if (p.per_row_scales)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, mem_scales});
+
+        prim.execute(strm, args);
+        strm.wait();
+
+        check_result(mem_src, mem_scales, mem_dst);
+    }
+
+    void check_result(const memory &src, const memory &scales,
+            const memory &dst) const {
+        const auto src_data = map_memory<src_data_t>(src);
+        const auto scales_data = map_memory<float>(scales);
+        const auto dst_data = map_memory<float>(dst);
+
+        const memory::dim N = p.indices.size();
+        const memory::dim B = p.offsets.size();
+        const bool is_max = p.aalgorithm == algorithm::reduction_max;
+
+        for (memory::dim b = 0; b < B; b++) {
+            const memory::dim begin = p.offsets[b];
+            const memory::dim end = b + 1 < B ? p.offsets[b + 1] : N;
+            for (memory::dim c = 0; c < p.dim; c++) {
+                float acc = is_max ? -FLT_MAX : 0.f;
+                for (memory::dim i = begin; i < end; i++) {
+                    const memory::dim r = p.indices[i];
+                    const float s = p.per_row_scales ? scales_data[r] : 1.f;
+                    const float v = s * (float)src_data[r * p.dim + c];
+                    acc = is_max ? std::max(acc, v) : acc + v;
+                }
+                if (begin == end)
+                    acc = 0.f;
+                else if (p.aalgorithm == algorithm::reduction_mean)
+                    acc /= (end - begin);
+
+                const float out = dst_data[b * p.dim + c];
+                ASSERT_NEAR(out, acc, 1e-4f * std::max(1.f, std::abs(acc)))
+                        << "bag " << b << ", column " << c;
+            }
+        }
+    }
+
+    using tag = memory::format_tag;
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // not supported alg_kind
+            embedding_bag_test_params_t {algorithm::eltwise_relu, 4, 4, {0},
+                    {0}, false, true, dnnl_invalid_arguments},
+            embedding_bag_test_params_t {algorithm::reduction_min, 4, 4, {0},
+                    {0}, false, true, dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            embedding_bag_test_params_t {algorithm::reduction_sum, 8, 5,
+                    {1, 3, 7, 0, 0, 2}, {0, 2, 2, 5}, false},
+            embedding_bag_test_params_t {algorithm::reduction_mean, 8, 5,
+                    {1, 3, 7, 0, 0, 2}, {0, 2, 2, 5}, false},
+            embedding_bag_test_params_t {algorithm::reduction_max, 8, 5,
+                    {1, 3, 7, 0, 0, 2}, {0, 2, 2, 5}, false},
+            // long rows are processed in chunks, skewed bags
+            embedding_bag_test_params_t {algorithm::reduction_sum, 16, 300,
+                    {15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 0},
+                    {0, 1, 1, 1, 15}, false},
+            // per-row dequantization scales
+            embedding_bag_test_params_t {algorithm::reduction_sum, 8, 5,
+                    {1, 3, 7, 0, 0, 2}, {0, 2, 2, 5}, true},
+            embedding_bag_test_params_t {algorithm::reduction_max, 8, 5,
+                    {1, 3, 7, 0, 0, 2}, {0, 2, 2, 5}, true});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsEmbeddingBag) {} \
+    INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestEmbeddingBagSimple, test, simple_cases());
+
+using embedding_bag_test_f32 = embedding_bag_test_t<float>;
+using embedding_bag_test_s8 = embedding_bag_test_t<int8_t>;
+using embedding_bag_test_u8 = embedding_bag_test_t<uint8_t>;
+
+INST_TEST_CASE(embedding_bag_test_f32)
+INST_TEST_CASE(embedding_bag_test_s8)
+INST_TEST_CASE(embedding_bag_test_u8)
+
+} // namespace dnnl
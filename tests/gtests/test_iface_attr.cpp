@@ -82,6 +82,62 @@ TEST_F(attr_test_t, TestAccMode) {
     }
 }
 
+TEST_F(attr_test_t, TestGating) {
+    dnnl::primitive_attr attr;
+    algorithm alg;
+    float alpha, beta;
+    attr.get_gating(alg, alpha, beta);
+    ASSERT_EQ(alg, algorithm::undef);
+
+    attr.set_gating(algorithm::eltwise_swish, 1.5f);
+    attr.get_gating(alg, alpha, beta);
+    ASSERT_EQ(alg, algorithm::eltwise_swish);
+    ASSERT_EQ(alpha, 1.5f);
+    ASSERT_EQ(beta, 0.f);
+
+    // The gate activation must be an eltwise algorithm.
+    EXPECT_ANY_THROW(attr.set_gating(algorithm::binary_mul));
+
+    attr.set_gating(algorithm::undef);
+    attr.get_gating(alg, alpha, beta);
+    ASSERT_EQ(alg, algorithm::undef);
+    ASSERT_EQ(alpha, 0.f);
+}
+
+TEST_F(attr_test_t, TestSrcDynamicQuantization) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_src_dynamic_quantization(), memory::data_type::undef);
+
+    attr.set_src_dynamic_quantization(memory::data_type::s8);
+    ASSERT_EQ(attr.get_src_dynamic_quantization(), memory::data_type::s8);
+
+    // Only the symmetric s8 quantization is supported.
+    EXPECT_ANY_THROW(
+            attr.set_src_dynamic_quantization(memory::data_type::u8));
+    EXPECT_ANY_THROW(
+            attr.set_src_dynamic_quantization(memory::data_type::f32));
+
+    attr.set_src_dynamic_quantization(memory::data_type::undef);
+    ASSERT_EQ(attr.get_src_dynamic_quantization(), memory::data_type::undef);
+}
+
+TEST_F(attr_test_t, TestDstDynamicQuantization) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(attr.get_dst_dynamic_quantization(), memory::data_type::undef);
+
+    attr.set_dst_dynamic_quantization(memory::data_type::s8);
+    ASSERT_EQ(attr.get_dst_dynamic_quantization(), memory::data_type::s8);
+    // The source and destination attributes are independent.
+    ASSERT_EQ(attr.get_src_dynamic_quantization(), memory::data_type::undef);
+
+    // Only the symmetric s8 quantization is supported.
+    EXPECT_ANY_THROW(
+            attr.set_dst_dynamic_quantization(memory::data_type::u8));
+
+    attr.set_dst_dynamic_quantization(memory::data_type::undef);
+    ASSERT_EQ(attr.get_dst_dynamic_quantization(), memory::data_type::undef);
+}
+
 TEST_F(attr_test_t, TestScratchpadMode) {
     dnnl::primitive_attr attr;
     for (auto m : {scratchpad_mode::library, scratchpad_mode::user}) {
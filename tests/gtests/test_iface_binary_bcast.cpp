@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2021-2022 Intel Corporation
+* Copyright 2021-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -20,7 +20,7 @@
 #include "oneapi/dnnl/dnnl.hpp"
 
 #define BCAST 1
-#define NO_BCAST 8
+#define NO_BCAST 16
 
 #define CASE(ndims, tag) \
     case ndims: return memory::format_tag::tag;
@@ -172,23 +172,23 @@ INSTANTIATE_TEST_SUITE_P(CPUOptimizedDims, binary_bcast_test_t,
                 std::make_tuple(
                         engine::kind::cpu, memory::dims {BCAST}, true)));
 
-INSTANTIATE_TEST_SUITE_P(CPUNotOptimizedDims, binary_bcast_test_t,
+INSTANTIATE_TEST_SUITE_P(CPUGeneralBcastDims, binary_bcast_test_t,
         ::testing::Values(
-                // selected unoptimized cases
+                // selected cases handled by the general broadcast strategy
                 std::make_tuple(engine::kind::cpu,
                         memory::dims {BCAST, BCAST, NO_BCAST, BCAST, NO_BCAST},
-                        false),
+                        true),
                 std::make_tuple(engine::kind::cpu,
-                        memory::dims {BCAST, NO_BCAST, BCAST, NO_BCAST}, false),
+                        memory::dims {BCAST, NO_BCAST, BCAST, NO_BCAST}, true),
                 std::make_tuple(engine::kind::cpu,
                         memory::dims {BCAST, NO_BCAST, BCAST, BCAST, NO_BCAST},
-                        false),
+                        true),
                 std::make_tuple(engine::kind::cpu,
                         memory::dims {NO_BCAST, BCAST, BCAST, BCAST, BCAST},
-                        false),
+                        true),
                 std::make_tuple(engine::kind::cpu,
-                        memory::dims {BCAST, BCAST, NO_BCAST, BCAST}, false),
+                        memory::dims {BCAST, BCAST, NO_BCAST, BCAST}, true),
                 std::make_tuple(engine::kind::cpu,
-                        memory::dims {NO_BCAST, BCAST, BCAST}, false)));
+                        memory::dims {NO_BCAST, BCAST, BCAST}, true)));
 
 } // namespace dnnl
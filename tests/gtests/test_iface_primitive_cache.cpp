@@ -116,6 +116,40 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestWarmUp) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+
+    engine eng(get_test_engine_kind(), 0);
+    std::vector<primitive_desc> pds;
+    for (int i = 1; i <= 12; i++) {
+        auto md = memory::desc({i, 1, 1, 1}, dt::f32, tag::nchw);
+        pds.push_back(eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f, 0.f));
+    }
+    warm_up_primitive_cache(pds);
+    ASSERT_EQ(get_primitive_cache_size(), 12);
+
+    // The primitives are taken from the cache.
+    for (const auto &pd : pds)
+        auto relu = primitive(pd);
+    ASSERT_EQ(get_primitive_cache_size(), 12);
+
+    // The primitives above the capacity evict the earlier ones.
+    set_primitive_cache_capacity(8);
+    warm_up_primitive_cache(pds);
+    ASSERT_EQ(get_primitive_cache_size(), 8);
+
+    ASSERT_EQ(dnnl_primitive_cache_warm_up(-1, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_primitive_cache_warm_up(1, nullptr),
+            dnnl_invalid_arguments);
+}
 #endif
 
 } // namespace dnnl
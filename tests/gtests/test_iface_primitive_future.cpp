@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class primitive_future_test_t : public ::testing::Test {
+protected:
+    void SetUp() override { eng = engine(get_test_engine_kind(), 0); }
+
+    primitive_desc relu_pd(memory::dim n) const {
+        auto md = memory::desc(
+                {n, 8, 4, 4}, memory::data_type::f32, memory::format_tag::nchw);
+        return eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f, 0.f);
+    }
+
+    engine eng;
+};
+
+TEST_F(primitive_future_test_t, TestCreateAsync) {
+    primitive_future future(relu_pd(2));
+    auto prim = future.get_primitive();
+    ASSERT_EQ(prim.get_kind(), primitive::kind::eltwise);
+    ASSERT_TRUE(future.is_ready());
+
+    // The primitive can be obtained only once.
+    EXPECT_ANY_THROW(future.get_primitive());
+}
+
+TEST_F(primitive_future_test_t, TestExecute) {
+    auto pd = relu_pd(1);
+    primitive_future future(pd);
+    auto prim = future.get_primitive();
+
+    stream strm(eng);
+    auto mem = test::make_memory(pd.query_md(query::src_md), eng);
+    {
+        auto ptr = map_memory<float>(mem);
+        for (int i = 0; i < 8 * 4 * 4; i++)
+            ptr[i] = (i % 2) ? -1.f : 1.f;
+    }
+    prim.execute(strm, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    strm.wait();
+    {
+        auto ptr = map_memory<float>(mem);
+        for (int i = 0; i < 8 * 4 * 4; i++)
+            ASSERT_EQ(ptr[i], (i % 2) ? 0.f : 1.f);
+    }
+}
+
+TEST_F(primitive_future_test_t, TestDestroyPrimitiveDesc) {
+    // The future keeps a copy of the primitive descriptor.
+    auto pd = relu_pd(3);
+    dnnl_primitive_desc_t c_pd = nullptr;
+    ASSERT_EQ(dnnl_primitive_desc_clone(&c_pd, pd.get()), dnnl_success);
+    dnnl_primitive_future_t future = nullptr;
+    ASSERT_EQ(dnnl_primitive_create_async(&future, c_pd), dnnl_success);
+    ASSERT_EQ(dnnl_primitive_desc_destroy(c_pd), dnnl_success);
+
+    dnnl_primitive_t prim = nullptr;
+    ASSERT_EQ(dnnl_primitive_future_get(future, &prim), dnnl_success);
+    ASSERT_EQ(dnnl_primitive_future_destroy(future), dnnl_success);
+    ASSERT_EQ(primitive(prim).get_kind(), primitive::kind::eltwise);
+}
+
+TEST_F(primitive_future_test_t, TestDestroyWithoutGet) {
+    for (int i = 0; i < 4; i++) {
+        primitive_future future(relu_pd(i + 1));
+    }
+}
+
+TEST_F(primitive_future_test_t, TestCreateBatch) {
+    std::vector<primitive_desc> pds;
+    for (int i = 0; i < 16; i++)
+        pds.push_back(relu_pd(i + 1));
+
+    auto prims = create_primitives(pds);
+    ASSERT_EQ(prims.size(), pds.size());
+    for (const auto &prim : prims)
+        ASSERT_EQ(prim.get_kind(), primitive::kind::eltwise);
+
+    ASSERT_TRUE(create_primitives({}).empty());
+}
+
+TEST_F(primitive_future_test_t, TestInvalidArguments) {
+    dnnl_primitive_future_t future = nullptr;
+    ASSERT_EQ(dnnl_primitive_create_async(&future, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_primitive_future_get(nullptr, nullptr),
+            dnnl_invalid_arguments);
+
+    dnnl_primitive_t prim = nullptr;
+    ASSERT_EQ(dnnl_primitive_create_batch(&prim, -1, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_primitive_create_batch(nullptr, 1, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_primitive_create_batch(nullptr, 0, nullptr), dnnl_success);
+}
+
+} // namespace dnnl
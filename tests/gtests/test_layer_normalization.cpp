@@ -104,6 +104,16 @@ protected:
         Forward(inference, flags::use_global_stats);
         Forward(inference, flags::use_scale | flags::use_shift);
 
+        // RMS normalization is only supported on CPU
+        const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
+        if (is_cpu) {
+            Forward(training, flags::rms_norm);
+            Forward(training, flags::rms_norm | flags::use_scale);
+            Forward(inference,
+                    flags::rms_norm | flags::use_scale
+                            | flags::use_global_stats);
+        }
+
         if (!impl::utils::one_of(p.dst_dt, memory::data_type::f16,
                     memory::data_type::s8, memory::data_type::u8)) {
             diff_src_md = std::make_shared<memory::desc>(
@@ -117,6 +127,11 @@ protected:
             Backward(prop_kind::backward,
                     flags::use_scale | flags::use_shift
                             | flags::use_global_stats);
+            if (is_cpu) {
+                Backward(prop_kind::backward_data, flags::rms_norm);
+                Backward(prop_kind::backward,
+                        flags::rms_norm | flags::use_scale);
+            }
         }
     }
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2019-2023 Intel Corporation
+* Copyright 2019-2024 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 
 #include "oneapi/dnnl/dnnl.hpp"
 
+#include <cfloat>
+#include <cmath>
 #include <vector>
 
 namespace dnnl {
@@ -684,4 +686,411 @@ INSTANTIATE_TEST_SUITE_P(TensorDims, attr_test_t,
                         memory::dims {2, 10, 10, 10}, tag::abcd,
                         memory::data_type::f16, 4)));
 
+struct gated_matmul_test_t
+    : public ::testing::TestWithParam<std::tuple<memory::dims, memory::dim,
+              memory::data_type, algorithm, bool>> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(gated_matmul_test_t, TestGatedMatmul) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Engine does not support the gating attribute.");
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const auto &src_dims = std::get<0>(GetParam());
+    const memory::dim N = std::get<1>(GetParam());
+    const auto dt = std::get<2>(GetParam());
+    const auto alg = std::get<3>(GetParam());
+    const bool wei_any = std::get<4>(GetParam());
+    SKIP_IF(unsupported_data_type(dt),
+            "Engine does not support this data type.");
+
+    const int ndims = (int)src_dims.size();
+    const bool is_3d = ndims == 3;
+    const memory::dim MB = is_3d ? src_dims[0] : 1;
+    const memory::dim M = src_dims[ndims - 2];
+    const memory::dim K = src_dims[ndims - 1];
+    const auto plain_tag = is_3d ? tag::abc : tag::ab;
+    const memory::dims wei_dims = is_3d ? memory::dims {1, K, 2 * N}
+                                        : memory::dims {K, 2 * N};
+    const memory::dims dst_dims = is_3d ? memory::dims {MB, M, N}
+                                        : memory::dims {M, N};
+
+    const memory::desc src_md(src_dims, dt, plain_tag);
+    const memory::desc wei_md(wei_dims, dt, wei_any ? tag::any : plain_tag);
+    const memory::desc dst_md(dst_dims, dt, plain_tag);
+
+    const float alpha = alg == algorithm::eltwise_swish ? 1.f : 0.f;
+    primitive_attr attr;
+    attr.set_gating(alg, alpha);
+
+    // The weights hold the gate and the up projections.
+    EXPECT_ANY_THROW(matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+    EXPECT_ANY_THROW(matmul::primitive_desc(eng, src_md,
+            memory::desc(wei_dims, dt, plain_tag),
+            memory::desc(wei_dims, dt, plain_tag), attr));
+    // The bias is not supported with the gating.
+    EXPECT_ANY_THROW(matmul::primitive_desc(eng, src_md, wei_md,
+            memory::desc({1, N}, dt, tag::ab), dst_md, attr));
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    algorithm q_alg;
+    float q_alpha, q_beta;
+    pd.get_primitive_attr().get_gating(q_alg, q_alpha, q_beta);
+    ASSERT_EQ(q_alg, alg);
+    ASSERT_EQ(q_alpha, alpha);
+    auto prim = matmul(pd);
+
+    // The values are exact in bf16 and the products are exact in f32.
+    const auto fill = [&](const memory::dims &adims, size_t seed) {
+        const memory::desc f32_md(adims, data_type::f32, plain_tag);
+        auto mem_f32 = test::make_memory(f32_md, eng);
+        auto ptr = map_memory<float>(mem_f32);
+        const size_t nelems = f32_md.get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = (float)((int)((i * seed) % 13) - 6) / 8.f;
+        return mem_f32;
+    };
+    auto mem_src = test::make_memory(pd.src_desc(), eng);
+    auto mem_wei = test::make_memory(pd.weights_desc(), eng);
+    auto mem_dst = test::make_memory(pd.dst_desc(), eng);
+    auto mem_src_f32 = fill(src_dims, 7);
+    auto mem_wei_f32 = fill(wei_dims, 5);
+    reorder(mem_src_f32, mem_src).execute(strm, mem_src_f32, mem_src);
+    reorder(mem_wei_f32, mem_wei).execute(strm, mem_wei_f32, mem_wei);
+
+    prim.execute(strm,
+            {{DNNL_ARG_SRC, mem_src}, {DNNL_ARG_WEIGHTS, mem_wei},
+                    {DNNL_ARG_DST, mem_dst}});
+
+    auto mem_dst_f32 = test::make_memory(
+            memory::desc(dst_dims, data_type::f32, plain_tag), eng);
+    reorder(mem_dst, mem_dst_f32).execute(strm, mem_dst, mem_dst_f32);
+    strm.wait();
+
+    const auto src = map_memory<float>(mem_src_f32);
+    const auto wei = map_memory<float>(mem_wei_f32);
+    const auto dst = map_memory<float>(mem_dst_f32);
+
+    const auto act = [&](float x) {
+        if (alg == algorithm::eltwise_swish)
+            return x / (1.f + std::exp(-alpha * x));
+        if (alg == algorithm::eltwise_gelu_erf)
+            return 0.5f * x * (1.f + std::erf(x / std::sqrt(2.f)));
+        return x > 0.f ? x : 0.f;
+    };
+    const float eps = dt == data_type::f32 ? 1e-5f : 1e-2f;
+    for_(memory::dim mb = 0; mb < MB; mb++)
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        float gate = 0.f, up = 0.f;
+        for (memory::dim k = 0; k < K; k++) {
+            const float s = src[(mb * M + m) * K + k];
+            gate += s * wei[k * 2 * N + n];
+            up += s * wei[k * 2 * N + N + n];
+        }
+        const float expected = act(gate) * up;
+        const float got = dst[(mb * M + m) * N + n];
+        ASSERT_NEAR(got, expected, eps * std::max(1.f, std::fabs(expected)))
+                << "mb " << mb << " m " << m << " n " << n;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GatedMatmul, gated_matmul_test_t,
+        ::testing::Values(
+                // {src dims, N, data type, activation, any weights format}
+                std::make_tuple(memory::dims {1, 64}, 128, data_type::f32,
+                        algorithm::eltwise_swish, true),
+                std::make_tuple(memory::dims {2, 37, 96}, 192, data_type::f32,
+                        algorithm::eltwise_gelu_erf, true),
+                std::make_tuple(memory::dims {45, 40}, 100, data_type::f32,
+                        algorithm::eltwise_swish, false),
+                std::make_tuple(memory::dims {33, 128}, 64, data_type::bf16,
+                        algorithm::eltwise_swish, true),
+                std::make_tuple(memory::dims {3, 7, 40}, 128, data_type::bf16,
+                        algorithm::eltwise_relu, true),
+                std::make_tuple(memory::dims {5, 30}, 24, data_type::bf16,
+                        algorithm::eltwise_gelu_erf, false)));
+
+struct dyn_quant_matmul_test_t
+    : public ::testing::TestWithParam<std::tuple<memory::dims, memory::dim,
+              memory::data_type, memory::data_type, int>> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(dyn_quant_matmul_test_t, TestDynQuantMatmul) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Engine does not support the dynamic quantization attribute.");
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const auto &src_dims = std::get<0>(GetParam());
+    const memory::dim N = std::get<1>(GetParam());
+    const auto src_dt = std::get<2>(GetParam());
+    const auto dst_dt = std::get<3>(GetParam());
+    // The weights scales mask, -1 stands for no scales.
+    const int wei_mask = std::get<4>(GetParam());
+    SKIP_IF(unsupported_data_type(src_dt) || unsupported_data_type(dst_dt),
+            "Engine does not support this data type.");
+
+    const int ndims = (int)src_dims.size();
+    const bool is_3d = ndims == 3;
+    const memory::dim MB = is_3d ? src_dims[0] : 1;
+    const memory::dim M = src_dims[ndims - 2];
+    const memory::dim K = src_dims[ndims - 1];
+    const auto plain_tag = is_3d ? tag::abc : tag::ab;
+    const memory::dims wei_dims
+            = is_3d ? memory::dims {1, K, N} : memory::dims {K, N};
+    const memory::dims dst_dims
+            = is_3d ? memory::dims {MB, M, N} : memory::dims {M, N};
+
+    const memory::desc src_md(src_dims, src_dt, plain_tag);
+    const memory::desc wei_md(wei_dims, data_type::s8, tag::any);
+    const memory::desc dst_md(dst_dims, dst_dt, plain_tag);
+
+    const auto make_attr = [&]() {
+        primitive_attr a;
+        a.set_src_dynamic_quantization(data_type::s8);
+        if (wei_mask >= 0) a.set_scales_mask(DNNL_ARG_WEIGHTS, wei_mask);
+        return a;
+    };
+    primitive_attr attr = make_attr();
+
+    // The source scales are computed by the primitive.
+    primitive_attr attr_src_scales = make_attr();
+    attr_src_scales.set_scales_mask(DNNL_ARG_SRC, 0);
+    EXPECT_ANY_THROW(matmul::primitive_desc(
+            eng, src_md, wei_md, dst_md, attr_src_scales));
+    // The weights must be int8.
+    EXPECT_ANY_THROW(matmul::primitive_desc(eng, src_md,
+            memory::desc(wei_dims, src_dt, tag::any), dst_md, attr));
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    ASSERT_EQ(pd.get_primitive_attr().get_src_dynamic_quantization(),
+            data_type::s8);
+    auto prim = matmul(pd);
+
+    // The source values are exact in bf16.
+    const memory::desc src_f32_md(src_dims, data_type::f32, plain_tag);
+    auto mem_src_f32 = test::make_memory(src_f32_md, eng);
+    {
+        auto ptr = map_memory<float>(mem_src_f32);
+        for (memory::dim i = 0; i < MB * M * K; i++)
+            ptr[i] = (float)((int)((i * 7) % 29) - 14) / 8.f;
+    }
+    const memory::desc wei_s8_md(wei_dims, data_type::s8, plain_tag);
+    auto mem_wei_s8 = test::make_memory(wei_s8_md, eng);
+    {
+        auto ptr = map_memory<int8_t>(mem_wei_s8);
+        for (memory::dim i = 0; i < K * N; i++)
+            ptr[i] = (int8_t)((int)((i * 5) % 23) - 11);
+    }
+    const memory::dim n_scales = wei_mask > 0 ? N : 1;
+    auto mem_wei_scales = test::make_memory(
+            memory::desc({n_scales}, data_type::f32, tag::a), eng);
+    {
+        auto ptr = map_memory<float>(mem_wei_scales);
+        for (memory::dim n = 0; n < n_scales; n++)
+            ptr[n] = 0.25f + (float)(n % 5) / 16.f;
+    }
+
+    auto mem_src = test::make_memory(pd.src_desc(), eng);
+    auto mem_wei = test::make_memory(pd.weights_desc(), eng);
+    auto mem_dst = test::make_memory(pd.dst_desc(), eng);
+    reorder(mem_src_f32, mem_src).execute(strm, mem_src_f32, mem_src);
+    reorder(mem_wei_s8, mem_wei).execute(strm, mem_wei_s8, mem_wei);
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_src},
+            {DNNL_ARG_WEIGHTS, mem_wei}, {DNNL_ARG_DST, mem_dst}};
+    if (wei_mask >= 0)
+        args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, mem_wei_scales});
+    prim.execute(strm, args);
+
+    // The user weights in the blocked format come without the compensation
+    // of the reorder, which is then computed by the primitive.
+    const memory::desc wei_blocked_md(wei_dims, data_type::s8,
+            is_3d ? tag::aCB16b64c4b : tag::BA16a64b4a);
+    auto pd_blocked
+            = matmul::primitive_desc(eng, src_md, wei_blocked_md, dst_md, attr);
+    auto mem_wei_blocked = test::make_memory(wei_blocked_md, eng);
+    auto mem_dst_blocked = test::make_memory(pd_blocked.dst_desc(), eng);
+    reorder(mem_wei_s8, mem_wei_blocked)
+            .execute(strm, mem_wei_s8, mem_wei_blocked);
+    args[DNNL_ARG_WEIGHTS] = mem_wei_blocked;
+    args[DNNL_ARG_DST] = mem_dst_blocked;
+    matmul(pd_blocked).execute(strm, args);
+
+    auto mem_dst_f32 = test::make_memory(
+            memory::desc(dst_dims, data_type::f32, plain_tag), eng);
+    auto mem_dst_blocked_f32 = test::make_memory(
+            memory::desc(dst_dims, data_type::f32, plain_tag), eng);
+    reorder(mem_dst, mem_dst_f32).execute(strm, mem_dst, mem_dst_f32);
+    reorder(mem_dst_blocked, mem_dst_blocked_f32)
+            .execute(strm, mem_dst_blocked, mem_dst_blocked_f32);
+    strm.wait();
+
+    const auto src = map_memory<float>(mem_src_f32);
+    const auto wei = map_memory<int8_t>(mem_wei_s8);
+    const auto wei_scales = map_memory<float>(mem_wei_scales);
+    const auto dst = map_memory<float>(mem_dst_f32);
+    const auto dst_blocked = map_memory<float>(mem_dst_blocked_f32);
+
+    // Each source row is quantized with the scale of its maximum absolute
+    // value, so the reference follows the same steps.
+    const float eps = dst_dt == data_type::f32 ? 1e-5f : 1e-2f;
+    std::vector<int> qsrc(K);
+    for_(memory::dim mb = 0; mb < MB; mb++)
+    for (memory::dim m = 0; m < M; m++) {
+        const float *s = &src[(mb * M + m) * K];
+        float amax = FLT_MIN;
+        for (memory::dim k = 0; k < K; k++)
+            amax = std::max(amax, std::fabs(s[k]));
+        const float qscale = 127.f / amax;
+        for (memory::dim k = 0; k < K; k++)
+            qsrc[k] = (int)std::nearbyint(s[k] * qscale);
+
+        for (memory::dim n = 0; n < N; n++) {
+            int acc = 0;
+            for (memory::dim k = 0; k < K; k++)
+                acc += qsrc[k] * wei[k * N + n];
+            float expected = (float)acc * (amax / 127.f);
+            if (wei_mask >= 0) expected *= wei_scales[wei_mask > 0 ? n : 0];
+            const float got = dst[(mb * M + m) * N + n];
+            ASSERT_NEAR(got, expected, eps * std::max(1.f, std::fabs(expected)))
+                    << "mb " << mb << " m " << m << " n " << n;
+            ASSERT_EQ(dst_blocked[(mb * M + m) * N + n], got)
+                    << "mb " << mb << " m " << m << " n " << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(DynQuantMatmul, dyn_quant_matmul_test_t,
+        ::testing::Values(
+                // {src dims, N, src data type, dst data type, weights scales
+                // mask}
+                std::make_tuple(memory::dims {1, 64}, 128, data_type::f32,
+                        data_type::f32, 2),
+                std::make_tuple(memory::dims {37, 96}, 100, data_type::f32,
+                        data_type::f32, 0),
+                std::make_tuple(memory::dims {2, 45, 40}, 64, data_type::f32,
+                        data_type::f32, 4),
+                std::make_tuple(memory::dims {33, 128}, 192, data_type::bf16,
+                        data_type::bf16, 2),
+                std::make_tuple(memory::dims {3, 7, 36}, 24, data_type::bf16,
+                        data_type::f32, -1),
+                std::make_tuple(memory::dims {70, 256}, 130, data_type::bf16,
+                        data_type::bf16, 2)));
+
+struct fp8_weights_matmul_test_t
+    : public ::testing::TestWithParam<std::tuple<memory::dims, memory::dim,
+              memory::data_type, memory::data_type, bool, int>> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(fp8_weights_matmul_test_t, TestFp8Weights) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Engine does not support bf16 source with fp8 weights.");
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const auto &src_dims = std::get<0>(GetParam());
+    const memory::dim N = std::get<1>(GetParam());
+    const auto wei_dt = std::get<2>(GetParam());
+    const auto dst_dt = std::get<3>(GetParam());
+    const bool wei_any = std::get<4>(GetParam());
+    // The weights scales mask, -1 stands for no scales.
+    const int wei_mask = std::get<5>(GetParam());
+    SKIP_IF(unsupported_data_type(data_type::bf16)
+                    || unsupported_data_type(wei_dt),
+            "Engine does not support this data type.");
+
+    const int ndims = (int)src_dims.size();
+    const bool is_3d = ndims == 3;
+    const memory::dim MB = is_3d ? src_dims[0] : 1;
+    const memory::dim M = src_dims[ndims - 2];
+    const memory::dim K = src_dims[ndims - 1];
+    const auto plain_tag = is_3d ? tag::abc : tag::ab;
+    const memory::dims wei_dims
+            = is_3d ? memory::dims {1, K, N} : memory::dims {K, N};
+    const memory::dims dst_dims
+            = is_3d ? memory::dims {MB, M, N} : memory::dims {M, N};
+
+    const memory::desc src_md(src_dims, data_type::bf16, plain_tag);
+    const memory::desc wei_md(wei_dims, wei_dt, wei_any ? tag::any : plain_tag);
+    const memory::desc dst_md(dst_dims, dst_dt, plain_tag);
+
+    primitive_attr attr;
+    if (wei_mask >= 0) attr.set_scales_mask(DNNL_ARG_WEIGHTS, wei_mask);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    auto prim = matmul(pd);
+
+    // The values are exact in bf16 and in both fp8 data types.
+    const auto fill = [&](const memory::dims &adims, size_t seed, float div) {
+        const memory::desc f32_md(adims, data_type::f32, plain_tag);
+        auto mem_f32 = test::make_memory(f32_md, eng);
+        auto ptr = map_memory<float>(mem_f32);
+        const size_t nelems = f32_md.get_size() / sizeof(float);
+        for (size_t i = 0; i < nelems; i++)
+            ptr[i] = (float)((int)((i * seed) % 13) - 6) / div;
+        return mem_f32;
+    };
+    auto mem_src_f32 = fill(src_dims, 7, 8.f);
+    auto mem_wei_f32 = fill(wei_dims, 5, 4.f);
+    const memory::dim n_scales = wei_mask > 0 ? N : 1;
+    auto mem_wei_scales = test::make_memory(
+            memory::desc({n_scales}, data_type::f32, tag::a), eng);
+    {
+        auto ptr = map_memory<float>(mem_wei_scales);
+        for (memory::dim n = 0; n < n_scales; n++)
+            ptr[n] = 0.5f + (float)(n % 3) / 4.f;
+    }
+
+    auto mem_src = test::make_memory(pd.src_desc(), eng);
+    auto mem_wei = test::make_memory(pd.weights_desc(), eng);
+    auto mem_dst = test::make_memory(pd.dst_desc(), eng);
+    reorder(mem_src_f32, mem_src).execute(strm, mem_src_f32, mem_src);
+    reorder(mem_wei_f32, mem_wei).execute(strm, mem_wei_f32, mem_wei);
+
+    std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_src},
+            {DNNL_ARG_WEIGHTS, mem_wei}, {DNNL_ARG_DST, mem_dst}};
+    if (wei_mask >= 0)
+        args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, mem_wei_scales});
+    prim.execute(strm, args);
+
+    auto mem_dst_f32 = test::make_memory(
+            memory::desc(dst_dims, data_type::f32, plain_tag), eng);
+    reorder(mem_dst, mem_dst_f32).execute(strm, mem_dst, mem_dst_f32);
+    strm.wait();
+
+    const auto src = map_memory<float>(mem_src_f32);
+    const auto wei = map_memory<float>(mem_wei_f32);
+    const auto wei_scales = map_memory<float>(mem_wei_scales);
+    const auto dst = map_memory<float>(mem_dst_f32);
+
+    const float eps = dst_dt == data_type::f32 ? 1e-5f : 1e-2f;
+    for_(memory::dim mb = 0; mb < MB; mb++)
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        float expected = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            expected += src[(mb * M + m) * K + k] * wei[k * N + n];
+        if (wei_mask >= 0) expected *= wei_scales[wei_mask > 0 ? n : 0];
+        const float got = dst[(mb * M + m) * N + n];
+        ASSERT_NEAR(got, expected, eps * std::max(1.f, std::fabs(expected)))
+                << "mb " << mb << " m " << m << " n " << n;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Fp8WeightsMatmul, fp8_weights_matmul_test_t,
+        ::testing::Values(
+                // {src dims, N, weights data type, dst data type, any weights
+                // format, weights scales mask}
+                std::make_tuple(memory::dims {1, 64}, 128, data_type::f8_e4m3,
+                        data_type::f32, true, 2),
+                std::make_tuple(memory::dims {37, 96}, 100,
+                        data_type::f8_e4m3, data_type::bf16, false, 0),
+                std::make_tuple(memory::dims {2, 45, 40}, 64,
+                        data_type::f8_e4m3, data_type::f32, true, 4),
+                std::make_tuple(memory::dims {33, 128}, 192,
+                        data_type::f8_e5m2, data_type::bf16, true, -1),
+                std::make_tuple(memory::dims {3, 7, 36}, 24,
+                        data_type::f8_e5m2, data_type::f32, false, 4),
+                std::make_tuple(memory::dims {70, 256}, 130,
+                        data_type::f8_e5m2, data_type::f32, true, 2)));
+
 } // namespace dnnl
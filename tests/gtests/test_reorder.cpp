@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2016-2023 Intel Corporation
+* Copyright 2016-2024 Intel Corporation
 * Copyright 2023 Arm Ltd. and affiliates
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
@@ -15,6 +15,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <utility>
 
@@ -351,6 +353,18 @@ CPU_INSTANTIATE_TEST_SUITE_P(Simple, reorder_simple_test_s8_s8,
                 cfg_s8 {fmt::goihw, fmt::gOIhw4i16o4i, {2, 64, 64, 3, 3}},
                 cfg_s8 {fmt::gOIhw4i16o4i, fmt::goihw, {2, 64, 64, 3, 3}}));
 
+// Large 2D weights with a few large dimensions, which are split to
+// distribute the work among the threads.
+CPU_INSTANTIATE_TEST_SUITE_P(LargeWeights_2d, reorder_simple_test_f32_f32,
+        ::testing::Values(cfg_f32 {fmt::ab, fmt::ab, {2048, 4001}},
+                cfg_f32 {fmt::ab, fmt::ba, {1024, 8191}},
+                cfg_f32 {fmt::ba, fmt::AB16b64a, {1000, 8192}},
+                cfg_f32 {fmt::ab, fmt::BA16a64b4a, {4096, 1500}}));
+
+CPU_INSTANTIATE_TEST_SUITE_P(LargeWeights_2d, reorder_simple_test_f32_bf16,
+        ::testing::Values(cfg_bf16 {fmt::ab, fmt::ab, {4096, 2003}},
+                cfg_bf16 {fmt::ab, fmt::BA16a64b4a, {2048, 4000}}));
+
 GPU_INSTANTIATE_TEST_SUITE_P(Data, reorder_simple_test_f32_f32,
         ::testing::Values(cfg_f32 {fmt::nchw, fmt::nhwc, {2, 48, 5, 4}},
                 cfg_f32 {fmt::nchw, fmt::NChw16n16c, {64, 32, 5, 6}},
@@ -415,4 +429,111 @@ GPU_INSTANTIATE_TEST_SUITE_P(PaddedWeights, reorder_simple_test_f32_f32,
         ::testing::Values(cfg_f32 {fmt::oihw, fmt::IOhw16i16o, {17, 23, 2, 1}},
                 cfg_f32 {fmt::goihw, fmt::gOIhw16o16i, {2, 17, 23, 1, 2}}));
 
+struct reorder_dyn_quant_test_t
+    : public ::testing::TestWithParam<std::tuple<memory::dim, memory::dim,
+              memory::data_type, int, bool>> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(reorder_dyn_quant_test_t, TestDynQuantWeights) {
+    SKIP_IF(!DNNL_X64 || get_test_engine_kind() != engine::kind::cpu,
+            "Engine does not support the dynamic quantization attribute.");
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const memory::dim K = std::get<0>(GetParam());
+    const memory::dim N = std::get<1>(GetParam());
+    const auto src_dt = std::get<2>(GetParam());
+    const int mask = std::get<3>(GetParam());
+    // The destination is either the transposed plain weights or the int8
+    // matmul weights in the layout chosen by the implementation.
+    const bool is_blocked = std::get<4>(GetParam());
+    SKIP_IF(unsupported_data_type(src_dt),
+            "Engine does not support this data type.");
+
+    const memory::dims dims {K, N};
+    const memory::desc src_md(dims, src_dt, fmt::ab);
+    memory::desc dst_md(dims, memory::data_type::s8, fmt::ba);
+    if (is_blocked) {
+        const memory::desc a_md({16, K}, memory::data_type::s8, fmt::ab);
+        const memory::desc c_md({16, N}, memory::data_type::f32, fmt::ab);
+        const memory::desc b_md(dims, memory::data_type::s8, fmt::any);
+        dst_md = matmul::primitive_desc(eng, a_md, b_md, c_md).weights_desc();
+    }
+
+    primitive_attr attr;
+    attr.set_dst_dynamic_quantization(memory::data_type::s8);
+    // The destination scales are required to define their granularity.
+    EXPECT_ANY_THROW(reorder::primitive_desc(eng, src_md, eng, dst_md, attr));
+    attr.set_scales_mask(DNNL_ARG_DST, mask);
+    auto pd = reorder::primitive_desc(eng, src_md, eng, dst_md, attr);
+    ASSERT_EQ(pd.get_primitive_attr().get_dst_dynamic_quantization(),
+            memory::data_type::s8);
+
+    // The source values are exact in bf16.
+    const memory::desc src_f32_md(dims, memory::data_type::f32, fmt::ab);
+    auto mem_src_f32 = test::make_memory(src_f32_md, eng);
+    {
+        auto ptr = map_memory<float>(mem_src_f32);
+        for (memory::dim i = 0; i < K * N; i++)
+            ptr[i] = (float)((int)((i * 7) % 31) - 15) / 8.f;
+        // An all-zero column gets the unit scale.
+        for (memory::dim k = 0; k < K; k++)
+            ptr[k * N] = 0.f;
+    }
+    auto mem_src = test::make_memory(src_md, eng);
+    reorder(mem_src_f32, mem_src).execute(strm, mem_src_f32, mem_src);
+
+    const memory::dim n_scales = mask ? N : 1;
+    const memory::desc scales_md({n_scales}, memory::data_type::f32, fmt::a);
+    auto mem_scales = test::make_memory(scales_md, eng);
+    auto mem_dst = test::make_memory(dst_md, eng);
+    reorder(pd).execute(strm,
+            {{DNNL_ARG_FROM, mem_src}, {DNNL_ARG_TO, mem_dst},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_TO, mem_scales}});
+
+    // The regular reorder with the computed scales produces the same
+    // weights, including the compensation.
+    primitive_attr attr_ref;
+    attr_ref.set_scales_mask(DNNL_ARG_DST, mask);
+    auto mem_dst_ref = test::make_memory(dst_md, eng);
+    reorder(reorder::primitive_desc(eng, src_md, eng, dst_md, attr_ref))
+            .execute(strm,
+                    {{DNNL_ARG_FROM, mem_src}, {DNNL_ARG_TO, mem_dst_ref},
+                            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_TO, mem_scales}});
+    strm.wait();
+
+    const auto src = map_memory<float>(mem_src_f32);
+    const auto scales = map_memory<float>(mem_scales);
+    for (memory::dim n = 0; n < n_scales; n++) {
+        float amax = 0.f;
+        for_(memory::dim k = 0; k < K; k++)
+        for (memory::dim j = mask ? n : 0; j < (mask ? n + 1 : N); j++)
+            amax = std::max(amax, std::fabs(src[k * N + j]));
+        const float expected = amax > 0.f ? amax / 127.f : 1.f;
+        ASSERT_FLOAT_EQ(scales[n], expected) << "n " << n;
+    }
+
+    const auto dst = map_memory<int8_t>(mem_dst);
+    const auto dst_ref = map_memory<int8_t>(mem_dst_ref);
+    for (size_t i = 0; i < dst_md.get_size(); i++)
+        ASSERT_EQ(dst[i], dst_ref[i]) << "byte " << i;
+
+    if (!is_blocked) {
+        for_(memory::dim k = 0; k < K; k++)
+        for (memory::dim n = 0; n < N; n++) {
+            const float q = src[k * N + n] / scales[mask ? n : 0];
+            ASSERT_NEAR(dst[n * K + k], std::nearbyint(q), 1)
+                    << "k " << k << " n " << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(DynQuantWeights, reorder_dyn_quant_test_t,
+        ::testing::Values(
+                // {K, N, src data type, dst scales mask, blocked dst}
+                std::make_tuple(64, 48, memory::data_type::f32, 2, false),
+                std::make_tuple(37, 19, memory::data_type::f32, 0, false),
+                std::make_tuple(128, 96, memory::data_type::f32, 2, true),
+                std::make_tuple(64, 64, memory::data_type::bf16, 2, true),
+                std::make_tuple(45, 33, memory::data_type::bf16, 2, false)));
+
 } // namespace dnnl
@@ -0,0 +1,229 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct rope_test_params_t {
+    algorithm aalgorithm;
+    memory::dims dims;
+    bool with_tables;
+    float base;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class rope_test_t : public ::testing::TestWithParam<rope_test_params_t> {
+private:
+    rope_test_params_t p;
+    memory::data_type data_dt;
+
+protected:
+    void SetUp() override {
+        data_dt = data_traits<data_t>::data_type;
+
+        p = ::testing::TestWithParam<rope_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(data_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using pd_t = rope::primitive_desc;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const int ndims = (int)p.dims.size();
+        const memory::dim S = p.dims[ndims - 2];
+        const memory::dim D = p.dims[ndims - 1];
+
+        memory::dims strides(ndims, 1);
+        for (int d = ndims - 2; d >= 0; d--)
+            strides[d] = strides[d + 1] * p.dims[d + 1];
+
+        auto desc_src = memory::desc(p.dims, data_dt, strides);
+        auto desc_dst = memory::desc(p.dims, data_dt, tag::any);
+        auto desc_table
+                = memory::desc({S, D / 2}, memory::data_type::f32, tag::ab);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        if (p.with_tables)
+            pd = pd_t(eng, p.aalgorithm, desc_src, desc_table, desc_table,
+                    desc_dst);
+        else
+            pd = pd_t(eng, p.aalgorithm, desc_src, desc_dst, p.base);
+
+        EXPECT_ANY_THROW(rope(pd, {}));
+        // default primitive ctor
+        auto prim = rope();
+        // regular primitive ctor
+        prim = rope(pd);
+
+        const auto dst_desc = pd.dst_desc();
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_0)
+                == pd.src_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == dst_desc);
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        if (p.with_tables) {
+            ASSERT_TRUE(pd.cos_desc() == desc_table);
+            ASSERT_TRUE(pd.sin_desc() == desc_table);
+        } else {
+            ASSERT_TRUE(pd.cos_desc().is_zero());
+            ASSERT_TRUE(pd.sin_desc().is_zero());
+        }
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = memory(desc_src, test_engine);
+        auto mem_dst = memory(dst_desc, test_engine);
+        auto mem_cos = memory(desc_table, test_engine);
+        auto mem_sin = memory(desc_table, test_engine);
+
+        fill_data<data_t>(desc_src.get_size() / sizeof(data_t), mem_src);
+        {
+            // The angles of the user tables don't match any base, so that
+            // the test fails if the tables are not used.
+            auto cos = map_memory<float>(mem_cos);
+            auto sin = map_memory<float>(mem_sin);
+            for (memory::dim s = 0; s < S; s++)
+                for (memory::dim i = 0; i < D / 2; i++) {
+                    const float angle = 0.3f * s - 0.7f * i;
+                    cos[s * D / 2 + i] = std::cos(angle);
+                    sin[s * D / 2 + i] = std::sin(angle);
+                }
+        }
+
+        std::unordered_map<int, memory> args
+                = {{DNNL_ARG_SRC_0, mem_src}, {DNNL_ARG_DST, mem_dst}};
+        if (p.with_tables) {
+            args.insert({DNNL_ARG_SRC_1, mem_cos});
+            args.insert({DNNL_ARG_SRC_2, mem_sin});
+        }
+
+        prim.execute(strm, args);
+        strm.wait();
+
+        check_result(mem_src, mem_cos, mem_sin, mem_dst);
+    }
+
+    void check_result(const memory &src, const memory &cos, const memory &sin,
+            const memory &dst) const {
+        const auto src_data = map_memory<data_t>(src);
+        const auto cos_data = map_memory<float>(cos);
+        const auto sin_data = map_memory<float>(sin);
+        const auto dst_data = map_memory<data_t>(dst);
+
+        const int ndims = (int)p.dims.size();
+        const memory::dim S = p.dims[ndims - 2];
+        const memory::dim D = p.dims[ndims - 1];
+        memory::dim rows = 1;
+        for (int d = 0; d < ndims - 1; d++)
+            rows *= p.dims[d];
+
+        const bool is_interleaved = p.aalgorithm == algorithm::rope_interleaved;
+        const float eps = data_dt == memory::data_type::f32 ? 1e-5f : 2e-2f;
+
+        for (memory::dim r = 0; r < rows; r++) {
+            const memory::dim s = r % S;
+            for (memory::dim i = 0; i < D / 2; i++) {
+                float c, sn;
+                if (p.with_tables) {
+                    c = cos_data[s * D / 2 + i];
+                    sn = sin_data[s * D / 2 + i];
+                } else {
+                    const float inv_freq
+                            = 1.f / std::pow(p.base, 2.f * i / (float)D);
+                    c = std::cos(s * inv_freq);
+                    sn = std::sin(s * inv_freq);
+                }
+
+                const memory::dim i0 = is_interleaved ? 2 * i : i;
+                const memory::dim i1 = is_interleaved ? 2 * i + 1 : i + D / 2;
+                const float x0 = (float)src_data[r * D + i0];
+                const float x1 = (float)src_data[r * D + i1];
+                const float y0 = x0 * c - x1 * sn;
+                const float y1 = x1 * c + x0 * sn;
+
+                ASSERT_NEAR((float)dst_data[r * D + i0], y0,
+                        eps * std::max(1.f, std::abs(y0)))
+                        << "row " << r << ", element " << i0;
+                ASSERT_NEAR((float)dst_data[r * D + i1], y1,
+                        eps * std::max(1.f, std::abs(y1)))
+                        << "row " << r << ", element " << i1;
+            }
+        }
+    }
+
+    using tag = memory::format_tag;
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // not supported alg_kind
+            rope_test_params_t {algorithm::eltwise_relu, {2, 4, 8}, true,
+                    10000.f, true, dnnl_invalid_arguments},
+            // odd head size
+            rope_test_params_t {algorithm::rope_half_split, {2, 4, 7}, false,
+                    10000.f, true, dnnl_invalid_arguments},
+            // non-positive base
+            rope_test_params_t {algorithm::rope_interleaved, {2, 4, 8}, false,
+                    0.f, true, dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            rope_test_params_t {
+                    algorithm::rope_half_split, {2, 3, 5, 16}, true, 0.f},
+            rope_test_params_t {
+                    algorithm::rope_interleaved, {2, 3, 5, 16}, true, 0.f},
+            rope_test_params_t {
+                    algorithm::rope_half_split, {2, 3, 5, 16}, false, 10000.f},
+            rope_test_params_t {
+                    algorithm::rope_interleaved, {2, 3, 5, 16}, false, 500.f},
+            rope_test_params_t {algorithm::rope_half_split, {7, 64}, true, 0.f},
+            rope_test_params_t {
+                    algorithm::rope_interleaved, {1, 128}, false, 10000.f});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsRoPE) {} \
+    INSTANTIATE_TEST_SUITE_P(TestRoPEEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestRoPESimple, test, simple_cases());
+
+using rope_test_f32 = rope_test_t<float>;
+using rope_test_bf16 = rope_test_t<bfloat16_t>;
+
+INST_TEST_CASE(rope_test_f32)
+INST_TEST_CASE(rope_test_bf16)
+
+} // namespace dnnl
@@ -0,0 +1,208 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct top_k_test_params_t {
+    algorithm aalgorithm;
+    memory::dims dims;
+    int axis;
+    memory::dim k;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class top_k_test_t : public ::testing::TestWithParam<top_k_test_params_t> {
+private:
+    top_k_test_params_t p;
+    memory::data_type data_dt;
+
+protected:
+    void SetUp() override {
+        data_dt = data_traits<data_t>::data_type;
+
+        p = ::testing::TestWithParam<top_k_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(data_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using pd_t = top_k::primitive_desc;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const int ndims = (int)p.dims.size();
+        memory::dims strides(ndims, 1);
+        for (int d = ndims - 2; d >= 0; d--)
+            strides[d] = strides[d + 1] * p.dims[d + 1];
+
+        memory::dims dst_dims = p.dims;
+        if (p.axis >= 0 && p.axis < ndims) dst_dims[p.axis] = p.k;
+
+        auto desc_src = memory::desc(p.dims, data_dt, strides);
+        auto desc_dst = memory::desc(dst_dims, data_dt, tag::any);
+        auto desc_indices
+                = memory::desc(dst_dims, memory::data_type::s32, tag::any);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        pd = pd_t(eng, p.aalgorithm, desc_src, desc_dst, desc_indices, p.axis);
+
+        EXPECT_ANY_THROW(top_k(pd, {}));
+        // default primitive ctor
+        auto prim = top_k();
+        // regular primitive ctor
+        prim = top_k(pd);
+
+        const auto dst_desc = pd.dst_desc();
+        const auto indices_desc = pd.indices_desc();
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_SRC) == pd.src_desc());
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_DST_0) == dst_desc);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST_1)
+                == indices_desc);
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_EQ(pd.get_axis(), p.axis);
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = memory(desc_src, test_engine);
+        auto mem_dst = memory(dst_desc, test_engine);
+        auto mem_indices = memory(indices_desc, test_engine);
+
+        // The values repeat to check the order of the equal elements.
+        {
+            auto src = map_memory<data_t>(mem_src);
+            const memory::dim nelems = desc_src.get_size() / sizeof(data_t);
+            for (memory::dim i = 0; i < nelems; i++)
+                src[i] = data_t(((i * 37) % 101) * 0.25f - 12.f);
+        }
+
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, mem_src}, {DNNL_ARG_DST_0, mem_dst},
+                        {DNNL_ARG_DST_1, mem_indices}});
+        strm.wait();
+
+        check_result(mem_src, mem_dst, mem_indices);
+    }
+
+    void check_result(const memory &src, const memory &dst,
+            const memory &indices) const {
+        const auto src_data = map_memory<data_t>(src);
+        const auto dst_data = map_memory<data_t>(dst);
+        const auto indices_data = map_memory<int32_t>(indices);
+
+        const int ndims = (int)p.dims.size();
+        const memory::dim N = p.dims[p.axis];
+        memory::dim inner = 1;
+        for (int d = p.axis + 1; d < ndims; d++)
+            inner *= p.dims[d];
+        memory::dim outer = 1;
+        for (int d = 0; d < p.axis; d++)
+            outer *= p.dims[d];
+
+        const bool is_max = p.aalgorithm == algorithm::reduction_max;
+        const memory::desc dst_md = dst.get_desc();
+        const memory::desc indices_md = indices.get_desc();
+        ASSERT_TRUE(dst_md.get_strides() == indices_md.get_strides());
+
+        std::vector<std::pair<float, memory::dim>> row(N);
+        for (memory::dim o = 0; o < outer; o++)
+            for (memory::dim i = 0; i < inner; i++) {
+                for (memory::dim n = 0; n < N; n++)
+                    row[n] = {(float)src_data[(o * N + n) * inner + i], n};
+                std::stable_sort(row.begin(), row.end(),
+                        [&](const std::pair<float, memory::dim> &a,
+                                const std::pair<float, memory::dim> &b) {
+                            return is_max ? a.first > b.first
+                                          : a.first < b.first;
+                        });
+
+                for (memory::dim j = 0; j < p.k; j++) {
+                    const memory::dim off = (o * p.k + j) * inner + i;
+                    ASSERT_EQ((float)dst_data[off], row[j].first)
+                            << "row " << o << ":" << i << ", element " << j;
+                    ASSERT_EQ(indices_data[off], row[j].second)
+                            << "row " << o << ":" << i << ", element " << j;
+                }
+            }
+    }
+
+    using tag = memory::format_tag;
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // not supported alg_kind
+            top_k_test_params_t {algorithm::reduction_sum, {2, 16}, 1, 4, true,
+                    dnnl_invalid_arguments},
+            // k is larger than the axis
+            top_k_test_params_t {algorithm::reduction_max, {2, 16}, 1, 17,
+                    true, dnnl_invalid_arguments},
+            // axis is out of range
+            top_k_test_params_t {algorithm::reduction_min, {2, 16}, 2, 4, true,
+                    dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            top_k_test_params_t {algorithm::reduction_max, {3, 50}, 1, 5},
+            top_k_test_params_t {algorithm::reduction_min, {3, 50}, 1, 5},
+            top_k_test_params_t {algorithm::reduction_max, {4, 7}, 1, 7},
+            top_k_test_params_t {algorithm::reduction_max, {2, 30, 3}, 1, 4},
+            top_k_test_params_t {algorithm::reduction_min, {5, 2, 3}, 0, 2},
+            top_k_test_params_t {algorithm::reduction_max, {1, 1000}, 1, 1});
+};
+
+// A single long row is split between the threads.
+static auto long_row_cases = []() {
+    return ::testing::Values(
+            top_k_test_params_t {algorithm::reduction_max, {1, 100000}, 1, 50},
+            top_k_test_params_t {algorithm::reduction_min, {2, 70000}, 1, 8});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsTopK) {} \
+    INSTANTIATE_TEST_SUITE_P(TestTopKEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopKSimple, test, simple_cases()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopKLongRow, test, long_row_cases());
+
+using top_k_test_f32 = top_k_test_t<float>;
+using top_k_test_bf16 = top_k_test_t<bfloat16_t>;
+
+INST_TEST_CASE(top_k_test_f32)
+INST_TEST_CASE(top_k_test_bf16)
+
+} // namespace dnnl